@@ -0,0 +1,101 @@
+//============================================================================
+//                                  I B E X
+// File        : bench-eval.cpp
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex.h"
+
+#include <cstdlib>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Throughput of the batch evaluation (BatchEval) compared to
+ * the standard evaluation (one forward pass per box).
+ *
+ * Usage: bench-eval [nb_boxes] [block_size]
+ */
+namespace {
+
+double run_scalar(Function& f, const IntervalMatrix& boxes, IntervalVector& res) {
+	Timer::start();
+	for (int i=0; i<boxes.nb_rows(); i++)
+		res[i]=f.eval(boxes[i]);
+	Timer::stop();
+	return Timer::VIRTUAL_TIMELAPSE();
+}
+
+double run_batch(BatchEval& e, const IntervalMatrix& boxes, IntervalVector& res) {
+	Timer::start();
+	res=e.eval(boxes);
+	Timer::stop();
+	return Timer::VIRTUAL_TIMELAPSE();
+}
+
+void bench(const char* name, Function& f, int nb_boxes, int block_size) {
+
+	IntervalMatrix boxes(nb_boxes,f.nb_var());
+
+	srand(1);
+	for (int i=0; i<nb_boxes; i++)
+		for (int j=0; j<f.nb_var(); j++) {
+			double x=-2+4*((double) rand())/RAND_MAX;
+			double w=0.01*((double) rand())/RAND_MAX;
+			boxes[i][j]=Interval(x,x+w);
+		}
+
+	BatchEval e(f,block_size);
+
+	IntervalVector res1(nb_boxes);
+	IntervalVector res2(nb_boxes);
+
+	double t1=run_scalar(f,boxes,res1);
+	double t2=run_batch(e,boxes,res2);
+
+	int nb_diff=0;
+	for (int i=0; i<nb_boxes; i++)
+		if (res1[i]!=res2[i]) nb_diff++;
+
+	cout << name << (e.vectorized()? "" : " (not vectorized)") << endl;
+	cout << "  scalar:  " << t1 << "s (" << (t1>0? nb_boxes/t1 : 0) << " boxes/s)" << endl;
+	cout << "  batch:   " << t2 << "s (" << (t2>0? nb_boxes/t2 : 0) << " boxes/s)" << endl;
+	cout << "  speedup: " << (t2>0? t1/t2 : 0) << endl;
+	if (nb_diff>0)
+		cout << "  " << nb_diff << " different results!" << endl;
+}
+
+} // end anonymous namespace
+
+int main(int argc, char** argv) {
+
+	int nb_boxes=argc>1? atoi(argv[1]) : 100000;
+	int block_size=argc>2? atoi(argv[2]) : BatchEval::DEFAULT_BLOCK_SIZE;
+
+	cout << nb_boxes << " boxes, blocks of " << block_size << " boxes" << endl << endl;
+
+	// polynomial (only SIMD kernels)
+	const int n=10;
+	const ExprSymbol& x=ExprSymbol::new_("x",Dim::col_vec(n));
+	const ExprNode* e=&(100*sqr(x[1]-sqr(x[0]))+sqr(1-x[0]));
+	for (int i=1; i<n-1; i++)
+		e=&(*e+100*sqr(x[i+1]-sqr(x[i]))+sqr(1-x[i]));
+	Function rosenbrock(x,*e);
+	bench("Rosenbrock (n=10)",rosenbrock,nb_boxes,block_size);
+
+	// polynomial with products of intervals
+	Variable a,b,c;
+	Function poly(a,b,c,a*b*c-a*b+b*c-a*c+a*a*b-c*c*a+3*a-2*b+c-1);
+	bench("Polynomial (n=3)",poly,nb_boxes,block_size);
+
+	// with transcendental functions (evaluated box by box)
+	Variable u,v;
+	Function trig(u,v,sin(u*v)+exp(u)*cos(v)+sqr(u)-u*v);
+	bench("Transcendental (n=2)",trig,nb_boxes,block_size);
+
+	return 0;
+}
@@ -0,0 +1,122 @@
+//============================================================================
+//                                  I B E X
+// File        : bench-flatset.cpp
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex.h"
+#include "ibex_FlatSet.h"
+#include "ibex_SetBisect.h"
+
+#include <cstdlib>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Compact representation of sets (FlatSet) compared to
+ * the pointer-based tree (Set).
+ *
+ * Usage: bench-flatset [eps]
+ */
+namespace {
+
+class LeafCounter : public SetVisitor {
+public:
+	LeafCounter() : n(0) { }
+	void visit_leaf(const IntervalVector& nodebox, BoolInterval status) { n++; }
+	int n;
+};
+
+double elapsed() {
+	Timer::stop();
+	return Timer::VIRTUAL_TIMELAPSE();
+}
+
+template<class S>
+void bench(const char* name, const S& set, const vector<Vector>& pts, const vector<IntervalVector>& boxes) {
+	double t[4];
+
+	Timer::start();
+	LeafCounter c;
+	for (int k=0; k<10; k++) set.visit(c);
+	t[0]=elapsed();
+
+	Timer::start();
+	int nb_yes=0;
+	for (size_t i=0; i<boxes.size(); i++)
+		if (set.is_superset(boxes[i])==YES) nb_yes++;
+	t[1]=elapsed();
+
+	Timer::start();
+	double d=0;
+	for (size_t i=0; i<pts.size(); i++)
+		d+=set.dist(pts[i],true);
+	t[2]=elapsed();
+
+	cout << name << " visit(x10): " << t[0] << "s  is_superset: " << t[1] << "s (" << nb_yes
+			<< ")  dist: " << t[2] << "s (" << d << ")" << endl;
+}
+
+}
+
+int main(int argc, char** argv) {
+
+	double eps = argc>1 ? atof(argv[1]) : 0.001;
+
+	Variable x,y;
+	Function f(x,y,sqr(x)+sqr(y)+0.3*sin(5*x*y));
+	SepFwdBwd sep(f,Interval(1,4));
+
+	Timer::start();
+	Set set(IntervalVector(2,Interval(-3,3)));
+	sep.contract(set,eps);
+	cout << "set built in " << elapsed() << "s" << endl;
+
+	FlatSet flat(set);
+
+	int nb_leaves=flat.nb_leaves();
+	// each leaf of the tree has a bisection node as father (except the root)
+	size_t tree_mem=nb_leaves*sizeof(SetLeaf)+(nb_leaves-1)*sizeof(SetBisect);
+	cout << "leaves: " << nb_leaves << endl;
+	cout << "memory: Set=" << tree_mem << " bytes (without allocator overhead)  FlatSet="
+			<< flat.memory() << " bytes (ratio=" << ((double) tree_mem)/flat.memory() << ")" << endl;
+
+	srand(1);
+	vector<Vector> pts;
+	vector<IntervalVector> boxes;
+	for (int i=0; i<10000; i++) {
+		Vector pt(2);
+		pt[0]=-4+8*((double) rand())/RAND_MAX;
+		pt[1]=-4+8*((double) rand())/RAND_MAX;
+		pts.push_back(pt);
+		IntervalVector box(pt);
+		box.inflate(0.05);
+		boxes.push_back(box);
+	}
+
+	bench("Set    ", set, pts, boxes);
+	bench("FlatSet", flat, pts, boxes);
+
+	Timer::start();
+	set.save("bench-flatset.set");
+	double ts=elapsed();
+	Timer::start();
+	Set set2("bench-flatset.set");
+	double tl=elapsed();
+	cout << "Set     save: " << ts << "s  load: " << tl << "s" << endl;
+
+	Timer::start();
+	flat.save("bench-flatset.set");
+	ts=elapsed();
+	Timer::start();
+	FlatSet flat2("bench-flatset.set");
+	tl=elapsed();
+	cout << "FlatSet save: " << ts << "s  load: " << tl << "s" << endl;
+
+	remove("bench-flatset.set");
+	return 0;
+}
@@ -0,0 +1,115 @@
+//============================================================================
+//                                  I B E X
+// File        : bench-interval.cpp
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex.h"
+
+#include <cstdlib>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Throughput of the basic interval operations, to compare
+ * the interval libraries (see the option --interval-lib).
+ *
+ * Each line gives the time (in seconds) of rep*n operations on
+ * arrays of n intervals. The operands of the "mixed" lines have
+ * random signs, which is the worst case for the multiplication
+ * and the division (the case analysis cannot be predicted).
+ *
+ * Usage: bench-interval [n] [rep]
+ */
+namespace {
+
+double elapsed() {
+	Timer::stop();
+	return Timer::VIRTUAL_TIMELAPSE();
+}
+
+void print(const char* op, double t) {
+	cout.width(20); cout << left << op;
+	cout << t << endl;
+}
+
+// intervals with positive bounds or random signs
+Interval* rand_array(int n, bool mixed) {
+	Interval* x=new Interval[n];
+	for (int i=0; i<n; i++) {
+		double a=mixed? RNG::rand(-10,10) : RNG::rand(0.5,10);
+		x[i]=Interval(a,a+RNG::rand(0,1));
+	}
+	return x;
+}
+
+}
+
+int main(int argc, char** argv) {
+
+	int n   = argc>1 ? atoi(argv[1]) : 1000;
+	int rep = argc>2 ? atoi(argv[2]) : 10000;
+
+	RNG::srand(1);
+
+	Interval* x=rand_array(n,false);
+	Interval* y=rand_array(n,false);
+	Interval* mx=rand_array(n,true);
+	Interval* my=rand_array(n,true);
+	Interval* z=new Interval[n];
+
+	cout << "interval library: " << _IBEX_INTERVAL_LIB_ << " n=" << n << " rep=" << rep << endl;
+
+	double s=0;
+
+	Timer::start();
+	for (int k=0; k<rep; k++) { for (int i=0; i<n; i++) z[i]=x[i]+y[i]; s+=z[k%n].lb(); }
+	print("x+y",elapsed());
+
+	Timer::start();
+	for (int k=0; k<rep; k++) { for (int i=0; i<n; i++) z[i]=x[i]-y[i]; s+=z[k%n].lb(); }
+	print("x-y",elapsed());
+
+	Timer::start();
+	for (int k=0; k<rep; k++) { for (int i=0; i<n; i++) z[i]=x[i]*y[i]; s+=z[k%n].lb(); }
+	print("x*y",elapsed());
+
+	Timer::start();
+	for (int k=0; k<rep; k++) { for (int i=0; i<n; i++) z[i]=mx[i]*my[i]; s+=z[k%n].lb(); }
+	print("x*y (mixed)",elapsed());
+
+	Timer::start();
+	for (int k=0; k<rep; k++) { for (int i=0; i<n; i++) z[i]=x[i]/y[i]; s+=z[k%n].lb(); }
+	print("x/y",elapsed());
+
+	Timer::start();
+	for (int k=0; k<rep; k++) { for (int i=0; i<n; i++) z[i]=mx[i]/y[i]; s+=z[k%n].lb(); }
+	print("x/y (mixed)",elapsed());
+
+	Timer::start();
+	for (int k=0; k<rep; k++) { for (int i=0; i<n; i++) z[i]=sqr(mx[i]); s+=z[k%n].lb(); }
+	print("sqr(x) (mixed)",elapsed());
+
+	Timer::start();
+	for (int k=0; k<rep; k++) { for (int i=0; i<n; i++) z[i]=sqrt(x[i]); s+=z[k%n].lb(); }
+	print("sqrt(x)",elapsed());
+
+	// x^3-2xy+y^2 (Horner-like dependent operations)
+	Timer::start();
+	for (int k=0; k<rep; k++) { for (int i=0; i<n; i++) z[i]=(mx[i]*mx[i]-2*my[i])*mx[i]+sqr(my[i]); s+=z[k%n].lb(); }
+	print("polynomial (mixed)",elapsed());
+
+	// prevent the loops from being optimized away
+	if (s==POS_INFINITY) cout << s << endl;
+
+	delete[] x;
+	delete[] y;
+	delete[] mx;
+	delete[] my;
+	delete[] z;
+	return 0;
+}
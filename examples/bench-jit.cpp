@@ -0,0 +1,118 @@
+//============================================================================
+//                                  I B E X
+// File        : bench-jit.cpp
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex.h"
+#include "ibex_JitFunction.h"
+
+#include <cstdlib>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Native code of functions (JitFunction) compared to the
+ * standard algorithms (evaluation, HC4 projection and gradient).
+ *
+ * Usage: bench-jit [nb_boxes]
+ */
+namespace {
+
+void bench(const char* name, Function& f, int nb_boxes) {
+
+	Timer::start();
+	JitFunction jit(f);
+	Timer::stop();
+	double tc=Timer::VIRTUAL_TIMELAPSE();
+
+	cout << name << " (" << f.nb_nodes() << " nodes)";
+	if (!jit.compiled()) {
+		cout << ": not compiled" << endl;
+		return;
+	}
+	cout << endl << "  generation+compilation: " << tc << "s (process time, the compiler is not counted)" << endl;
+
+	IntervalMatrix boxes(nb_boxes,f.nb_var());
+
+	srand(1);
+	for (int i=0; i<nb_boxes; i++)
+		for (int j=0; j<f.nb_var(); j++) {
+			double x=-2+4*((double) rand())/RAND_MAX;
+			double w=0.1*((double) rand())/RAND_MAX;
+			boxes[i][j]=Interval(x,x+w);
+		}
+
+	double t[2][3];
+	int nb_diff=0;
+	IntervalVector g1(f.nb_var()), g2(f.nb_var());
+
+	for (int k=0; k<2; k++) {
+		Timer::start();
+		for (int i=0; i<nb_boxes; i++)
+			if (k==0) f.eval(boxes[i]); else jit.eval(boxes[i]);
+		Timer::stop();
+		t[k][0]=Timer::VIRTUAL_TIMELAPSE();
+
+		Timer::start();
+		for (int i=0; i<nb_boxes; i++) {
+			IntervalVector box(boxes[i]);
+			if (k==0) f.backward(Interval::ZERO,box); else jit.backward(Interval::ZERO,box);
+		}
+		Timer::stop();
+		t[k][1]=Timer::VIRTUAL_TIMELAPSE();
+
+		Timer::start();
+		for (int i=0; i<nb_boxes; i++)
+			if (k==0) f.gradient(boxes[i],g1); else jit.gradient(boxes[i],g2);
+		Timer::stop();
+		t[k][2]=Timer::VIRTUAL_TIMELAPSE();
+	}
+
+	for (int i=0; i<nb_boxes; i++) {
+		IntervalVector box1(boxes[i]), box2(boxes[i]);
+		f.backward(Interval::ZERO,box1);
+		jit.backward(Interval::ZERO,box2);
+		f.gradient(boxes[i],g1);
+		jit.gradient(boxes[i],g2);
+		if (f.eval(boxes[i])!=jit.eval(boxes[i]) || box1!=box2 || g1!=g2) nb_diff++;
+	}
+
+	const char* algo[3] = { "eval:    ", "hc4:     ", "gradient:" };
+	for (int j=0; j<3; j++)
+		cout << "  " << algo[j] << " standard " << t[0][j] << "s, native " << t[1][j] << "s, speedup "
+		     << (t[1][j]>0? t[0][j]/t[1][j] : 0) << endl;
+	if (nb_diff>0)
+		cout << "  " << nb_diff << " different results!" << endl;
+}
+
+} // end anonymous namespace
+
+int main(int argc, char** argv) {
+
+	int nb_boxes=argc>1? atoi(argv[1]) : 100000;
+
+	cout << nb_boxes << " boxes" << endl << endl;
+
+	const int n=10;
+	const ExprSymbol& x=ExprSymbol::new_("x",Dim::col_vec(n));
+	const ExprNode* e=&(100*sqr(x[1]-sqr(x[0]))+sqr(1-x[0]));
+	for (int i=1; i<n-1; i++)
+		e=&(*e+100*sqr(x[i+1]-sqr(x[i]))+sqr(1-x[i]));
+	Function rosenbrock(x,*e);
+	bench("Rosenbrock (n=10)",rosenbrock,nb_boxes);
+
+	Variable a,b,c;
+	Function poly(a,b,c,a*b*c-a*b+b*c-a*c+a*a*b-c*c*a+3*a-2*b+c-1);
+	bench("Polynomial (n=3)",poly,nb_boxes);
+
+	Variable u,v;
+	Function trig(u,v,sin(u*v)+exp(u)*cos(v)+sqr(u)-u*v);
+	bench("Transcendental (n=2)",trig,nb_boxes);
+
+	return 0;
+}
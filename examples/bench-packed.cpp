@@ -0,0 +1,210 @@
+//============================================================================
+//                                  I B E X
+// File        : bench-packed.cpp
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex.h"
+#include "ibex_PackedInterval.h"
+
+#include <cstdlib>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Vector and matrix operations with packed bounds (PackedIntervalVector
+ * and PackedIntervalMatrix) compared to the arrays of intervals
+ * (IntervalVector and IntervalMatrix).
+ *
+ * The "interval" column gives the time of the operation made interval
+ * by interval (as in the generic implementation) and the "packed" column
+ * the time with packed operands (the packing is not counted).
+ *
+ * Usage: bench-packed [n] [rep]
+ */
+namespace {
+
+double elapsed() {
+	Timer::stop();
+	return Timer::VIRTUAL_TIMELAPSE();
+}
+
+void print(const char* op, double t1, double t2) {
+	cout.width(20); cout << left << op;
+	cout.width(12); cout << t1;
+	cout.width(12); cout << t2;
+	cout << (t2>0 ? t1/t2 : 0) << endl;
+}
+
+IntervalVector rand_vector(int n, double rad) {
+	IntervalVector x(n);
+	for (int i=0; i<n; i++) {
+		double a=RNG::rand(-10,10);
+		x[i]=Interval(a,a+RNG::rand(0,rad));
+	}
+	return x;
+}
+
+IntervalMatrix rand_matrix(int m, int n) {
+	IntervalMatrix M(m,n);
+	for (int i=0; i<m; i++)
+		M[i]=rand_vector(n,1);
+	return M;
+}
+
+// products interval by interval
+IntervalVector naive_mul(const Matrix& m, const IntervalVector& x) {
+	IntervalVector y(m.nb_rows());
+	for (int i=0; i<m.nb_rows(); i++) {
+		y[i]=0;
+		for (int j=0; j<m.nb_cols(); j++)
+			y[i]+=m[i][j]*x[j];
+	}
+	return y;
+}
+
+IntervalVector naive_mul(const IntervalMatrix& m, const IntervalVector& x) {
+	IntervalVector y(m.nb_rows());
+	for (int i=0; i<m.nb_rows(); i++) {
+		y[i]=0;
+		for (int j=0; j<m.nb_cols(); j++)
+			y[i]+=m[i][j]*x[j];
+	}
+	return y;
+}
+
+template<class M1, class M2>
+IntervalMatrix naive_mul(const M1& m1, const M2& m2) {
+	IntervalMatrix m3(m1.nb_rows(),m2.nb_cols());
+	for (int i=0; i<m1.nb_rows(); i++)
+		for (int j=0; j<m2.nb_cols(); j++) {
+			m3[i][j]=0;
+			for (int k=0; k<m1.nb_cols(); k++)
+				m3[i][j]+=m1[i][k]*m2[k][j];
+		}
+	return m3;
+}
+
+}
+
+int main(int argc, char** argv) {
+
+	int n   = argc>1 ? atoi(argv[1]) : 20;
+	int rep = argc>2 ? atoi(argv[2]) : 100000;
+
+	RNG::srand(1);
+
+	IntervalVector x=rand_vector(n,1);
+	IntervalVector y=rand_vector(n,1e-3);
+	IntervalVector z=x;
+	z[n/2]=Interval(z[n/2].lb(),z[n/2].mid());
+	Vector v=y.mid();
+
+	PackedIntervalVector px(x), py(y), pz(z);
+
+	cout << "n=" << n << " rep=" << rep << endl;
+	cout.width(20); cout << left << "operation";
+	cout.width(12); cout << "interval";
+	cout.width(12); cout << "packed";
+	cout << "speedup" << endl;
+
+	double t1,t2,s=0;
+	bool b=true;
+
+	Timer::start();
+	for (int k=0; k<rep; k++) s+=x.diam()[k%n];
+	t1=elapsed();
+	Timer::start();
+	for (int k=0; k<rep; k++) s+=px.diam()[k%n];
+	t2=elapsed();
+	print("diam",t1,t2);
+
+	Timer::start();
+	for (int k=0; k<rep; k++) s+=x.max_diam();
+	t1=elapsed();
+	Timer::start();
+	for (int k=0; k<rep; k++) s+=px.max_diam();
+	t2=elapsed();
+	print("max_diam",t1,t2);
+
+	Timer::start();
+	for (int k=0; k<rep; k++) s+=x.extr_diam_index(k%2);
+	t1=elapsed();
+	Timer::start();
+	for (int k=0; k<rep; k++) s+=px.extr_diam_index(k%2);
+	t2=elapsed();
+	print("extr_diam_index",t1,t2);
+
+	Timer::start();
+	for (int k=0; k<rep; k++) b&=z.is_subset(x);
+	t1=elapsed();
+	Timer::start();
+	for (int k=0; k<rep; k++) b&=pz.is_subset(px);
+	t2=elapsed();
+	print("is_subset",t1,t2);
+
+	Timer::start();
+	for (int k=0; k<rep; k++) { z+=y; z-=y; }
+	t1=elapsed();
+	Timer::start();
+	for (int k=0; k<rep; k++) { pz+=py; pz-=py; }
+	t2=elapsed();
+	print("+= -= (x2)",t1,t2);
+
+	Timer::start();
+	for (int k=0; k<rep; k++) { z+=v; z-=v; }
+	t1=elapsed();
+	Timer::start();
+	for (int k=0; k<rep; k++) { pz+=v; pz-=v; }
+	t2=elapsed();
+	print("+= -= Vector (x2)",t1,t2);
+
+	int rep2 = rep/n>0 ? rep/n : 1;
+
+	Matrix C=Matrix::rand(n);
+	IntervalMatrix A=rand_matrix(n,n);
+	PackedIntervalMatrix PA(A);
+
+	Timer::start();
+	for (int k=0; k<rep2; k++) s+=naive_mul(C,x)[0].lb();
+	t1=elapsed();
+	Timer::start();
+	for (int k=0; k<rep2; k++) s+=(C*px)[0].lb();
+	t2=elapsed();
+	print("Matrix*vector",t1,t2);
+
+	Timer::start();
+	for (int k=0; k<rep2; k++) s+=naive_mul(A,x)[0].lb();
+	t1=elapsed();
+	Timer::start();
+	for (int k=0; k<rep2; k++) s+=(PA*px)[0].lb();
+	t2=elapsed();
+	print("matrix*vector",t1,t2);
+
+	int rep3 = rep2/n>0 ? rep2/n : 1;
+
+	Timer::start();
+	for (int k=0; k<rep3; k++) s+=naive_mul(C,A)[0][0].lb();
+	t1=elapsed();
+	Timer::start();
+	for (int k=0; k<rep3; k++) s+=(C*PA).lb(0)[0];
+	t2=elapsed();
+	print("Matrix*matrix",t1,t2);
+
+	Timer::start();
+	for (int k=0; k<rep3; k++) s+=naive_mul(A,A)[0][0].lb();
+	t1=elapsed();
+	Timer::start();
+	for (int k=0; k<rep3; k++) s+=(PA*PA).lb(0)[0];
+	t2=elapsed();
+	print("matrix*matrix",t1,t2);
+
+	// prevent the loops from being optimized away
+	if (!b) cout << s << endl;
+
+	return 0;
+}
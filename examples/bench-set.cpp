@@ -0,0 +1,125 @@
+//============================================================================
+//                                  I B E X
+// File        : bench-set.cpp
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex.h"
+#include "ibex_SepPolygon.h"
+
+#include <cstdlib>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Multi-threaded set operations (Set::contract, Set::inter, Set::union_)
+ * compared to the sequential ones, on the polygon of the ENSTA robotics
+ * plugin tests (requires --with-ensta-robotics).
+ *
+ * Usage: bench-set [nb_threads] [eps]
+ */
+namespace {
+
+// the polygon of TestSepPolygon (a non-convex polygon with a hole)
+void polygon(vector<double>& ax, vector<double>& ay, vector<double>& bx, vector<double>& by, double dx) {
+	double p[9][4] = {
+			{ 6,-6, 7, 9}, { 7, 9, 0, 5}, { 0, 5,-9, 8}, {-9, 8,-8,-9}, {-8,-9, 6,-6},
+			{-2, 3, 3.5, 2}, {3.5, 2, 3,-4}, { 3,-4,-3,-3}, {-3,-3,-2, 3} };
+
+	for (int i=0; i<9; i++) {
+		ax.push_back(p[i][0]+dx); ay.push_back(p[i][1]);
+		bx.push_back(p[i][2]+dx); by.push_back(p[i][3]);
+	}
+}
+
+// number of leaves
+class LeafCounter : public SetVisitor {
+public:
+	LeafCounter() : n(0) { }
+	void visit_leaf(const IntervalVector& nodebox, BoolInterval status) { n++; }
+	int n;
+};
+
+int nb_leaves(const Set& set) {
+	LeafCounter c;
+	set.visit(c);
+	return c.n;
+}
+
+double elapsed() {
+	Timer::stop(Timer::__REAL);
+	return Timer::REAL_TIMELAPSE();
+}
+
+}
+
+int main(int argc, char** argv) {
+
+	int nb_threads = argc>1 ? atoi(argv[1]) : max_threads();
+	double eps = argc>2 ? atof(argv[2]) : 0.01;
+
+	IntervalVector box(2,Interval(-10,10));
+
+	// separators are not thread-safe: one per thread
+	vector<double> ax,ay,bx,by;
+	polygon(ax,ay,bx,by,0);
+
+	Array<Sep> seps(nb_threads);
+	for (int t=0; t<nb_threads; t++)
+		seps.set_ref(t,*new SepPolygon(ax,ay,bx,by));
+
+	cout << "threads=" << nb_threads << " eps=" << eps << endl;
+
+	// ================== separator ====================
+	Timer::start();
+	Set s0(box);
+	seps[0].contract(s0,eps);
+	double t0=elapsed();
+	cout << "contract   sequential:       " << t0 << "s (" << nb_leaves(s0) << " leaves)" << endl;
+
+	double grains[] = { 4, 1, 0.25 };
+	for (int g=0; g<3; g++) {
+		Timer::start();
+		Set s(box);
+		s.contract(seps,eps,grains[g]);
+		double t=elapsed();
+		cout << "contract   grain=" << grains[g] << ":\t" << t << "s (" << nb_leaves(s) << " leaves, speedup=" << t0/t << ")" << endl;
+	}
+
+	// =============== explicit sets ===================
+	// a second polygon, shifted
+	vector<double> ax2,ay2,bx2,by2;
+	polygon(ax2,ay2,bx2,by2,1.5);
+	SepPolygon sep2(ax2,ay2,bx2,by2);
+	Set other(box);
+	sep2.contract(other,eps);
+
+	for (int op=0; op<2; op++) {
+		const char* name = op==0 ? "inter      " : "union      ";
+
+		Set a(box);
+		seps[0].contract(a,eps);
+		Timer::start();
+		if (op==0) a &= other; else a |= other;
+		double t1=elapsed();
+		cout << name << "sequential:       " << t1 << "s (" << nb_leaves(a) << " leaves)" << endl;
+
+		for (int g=0; g<3; g++) {
+			Set b(box);
+			seps[0].contract(b,eps);
+			Timer::start();
+			if (op==0) b.inter(other,nb_threads,grains[g]); else b.union_(other,nb_threads,grains[g]);
+			double t=elapsed();
+			cout << name << "grain=" << grains[g] << ":\t" << t << "s (" << nb_leaves(b) << " leaves, speedup=" << t1/t << ")" << endl;
+		}
+	}
+
+	for (int t=0; t<nb_threads; t++)
+		delete &seps[t];
+
+	return 0;
+}
@@ -60,19 +60,20 @@ void CtcSegment::contract(IntervalVector &box) {
 		ctc_g->contract(box);
 	}
 	else {
-		X_with_params[0] = box[0];
-		X_with_params[1] = box[1];
-		//        X_with_params=cart_prod(box,)
+		// work on a copy: the parameters would be lost
+		// if the contraction resulted in an empty box
+		IntervalVector X(X_with_params);
+		X[0] = box[0];
+		X[1] = box[1];
 
-		ctc_f->contract(X_with_params);
-		if (X_with_params.is_empty()) { box.set_empty(); return; }
+		ctc_f->contract(X);
+		if (X.is_empty()) { box.set_empty(); return; }
 
-		ctc_g->contract(X_with_params);
-		if (X_with_params.is_empty()) { box.set_empty(); return; }
+		ctc_g->contract(X);
+		if (X.is_empty()) { box.set_empty(); return; }
 
-		//        box = X_with_params.subvector(0,1);
-		box[0] = X_with_params[0];
-		box[1] = X_with_params[1];
+		box[0] = X[0];
+		box[1] = X[1];
 	}
 }
 
@@ -0,0 +1,1178 @@
+/* ============================================================================
+ * I B E X - Implementation of the Interval class with error-free transformations
+ * ============================================================================
+ * Copyright   : IMT Atlantique (France)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "ibex_Exception.h"
+#include <cassert>
+#include <float.h>
+#include <fenv.h>
+#include <stdint.h>
+#include <iostream>
+#include <cmath>
+#include <climits>
+
+/*
+ * The FPU is never switched by the interval operations: everything is
+ * computed in the default rounding mode (to nearest). The rounding error
+ * of the result of each arithmetic operation is computed exactly with an
+ * error-free transformation (TwoSum for the addition, a fused multiply-add
+ * for the multiplication, the division and the square root) and the sign
+ * of this error tells whether the result has to be moved to the previous
+ * (or next) float. So the bounds are the same as with directed rounding.
+ *
+ * The arithmetic is only valid in the rounding mode to nearest: a code
+ * that calls fpu_round_up() or fpu_round_down() must restore it
+ * (see fpu_round_near()).
+ *
+ * The elementary functions (exp, log, sin, etc.) call the mathematical
+ * library, whose results are assumed to be accurate to within 2 ulps (this
+ * is the case of the GNU libm in the rounding mode to nearest).
+ */
+
+#ifndef __FP_FAST_FMA
+#error "The interval library eft requires a fused multiply-add (e.g., compile with -mfma)."
+#endif
+
+#ifdef __AVX__
+#include <immintrin.h>
+#endif
+
+namespace ibex {
+
+inline void fpu_round_down() {
+	fesetround(FE_DOWNWARD);
+}
+
+inline void fpu_round_up() {
+	fesetround(FE_UPWARD);
+}
+
+inline void fpu_round_near() {
+	fesetround(FE_TONEAREST);
+}
+
+inline void fpu_round_zero() {
+	fesetround(FE_TOWARDZERO);
+}
+
+/* Lower bound of the results of the multiplication, the division and the
+ * square root for which the error term given by the fused multiply-add is
+ * exact (there is no underflow above 2^-969). */
+const double EFT_MIN_EXACT = 2*DBL_MIN/DBL_EPSILON;
+
+inline double eft_fma(double a, double b, double c) {
+	return __builtin_fma(a,b,c);
+}
+
+/* x if e>=0, the previous float otherwise.
+ * x must be finite (or +oo) and nonzero if e<0. The integer representation
+ * of a double is monotonic in the absolute value, hence the branchless
+ * version (the signs of the error terms are not predictable). */
+inline double eft_down(double x, double e) {
+	union { double d; int64_t i; } u;
+	u.d=x;
+	u.i-=((u.i>>63)|1) & -(int64_t) (e<0);
+	return u.d;
+}
+
+/* x if e<=0, the next float otherwise.
+ * x must be finite (or -oo) and nonzero if e>0. */
+inline double eft_up(double x, double e) {
+	union { double d; int64_t i; } u;
+	u.d=x;
+	u.i+=((u.i>>63)|1) & -(int64_t) (e>0);
+	return u.d;
+}
+
+inline double previous_float(double x) {
+	if (x==NEG_INFINITY) return x;
+	else if (x==0) return -DBL_MIN*DBL_EPSILON;
+	else return eft_down(x,-1);
+}
+
+inline double next_float(double x) {
+	if (x==POS_INFINITY) return x;
+	else if (x==0) return DBL_MIN*DBL_EPSILON;
+	else return eft_up(x,1);
+}
+
+/* The error of s=a+b (TwoSum). */
+inline double eft_add_err(double a, double b, double s) {
+	double bb=s-a;
+	return (a-(s-bb))+(b-bb);
+}
+
+inline double eft_add_down(double a, double b) {
+	double s=a+b;
+	if (fabs(s)<=DBL_MAX)
+		return eft_down(s,eft_add_err(a,b,s));
+	else if (s==POS_INFINITY && a!=POS_INFINITY && b!=POS_INFINITY)
+		return DBL_MAX; // overflow
+	else
+		return s;
+}
+
+inline double eft_add_up(double a, double b) {
+	double s=a+b;
+	if (fabs(s)<=DBL_MAX)
+		return eft_up(s,eft_add_err(a,b,s));
+	else if (s==NEG_INFINITY && a!=NEG_INFINITY && b!=NEG_INFINITY)
+		return -DBL_MAX; // overflow
+	else
+		return s;
+}
+
+/* Product p=a*b out of the range where the error is exact
+ * (overflow, underflow or infinite operand). */
+inline double eft_mul_down_special(double a, double b, double p) {
+	if (p==POS_INFINITY)
+		return fabs(a)==POS_INFINITY || fabs(b)==POS_INFINITY ? p : DBL_MAX;
+	else if (p==NEG_INFINITY || a==0 || b==0 || p!=p)
+		return p;
+	else if (p==0) // underflow
+		return (a>0)==(b>0) ? p : previous_float(p);
+	else
+		// the sign of the (rounded) error is still correct if nonzero
+		return eft_fma(a,b,-p)>0 ? p : previous_float(p);
+}
+
+inline double eft_mul_up_special(double a, double b, double p) {
+	if (p==NEG_INFINITY)
+		return fabs(a)==POS_INFINITY || fabs(b)==POS_INFINITY ? p : -DBL_MAX;
+	else if (p==POS_INFINITY || a==0 || b==0 || p!=p)
+		return p;
+	else if (p==0)
+		return (a>0)!=(b>0) ? p : next_float(p);
+	else
+		return eft_fma(a,b,-p)<0 ? p : next_float(p);
+}
+
+inline double eft_mul_down(double a, double b) {
+	double p=a*b;
+	if (fabs(p)>=EFT_MIN_EXACT && fabs(p)<=DBL_MAX)
+		return eft_down(p,eft_fma(a,b,-p));
+	else
+		return eft_mul_down_special(a,b,p);
+}
+
+inline double eft_mul_up(double a, double b) {
+	double p=a*b;
+	if (fabs(p)>=EFT_MIN_EXACT && fabs(p)<=DBL_MAX)
+		return eft_up(p,eft_fma(a,b,-p));
+	else
+		return eft_mul_up_special(a,b,p);
+}
+
+/* Quotient q=a/b out of the range where the remainder is exact.
+ * b must be nonzero. */
+inline double eft_div_down_special(double a, double b, double q) {
+	if (q==POS_INFINITY)
+		return fabs(a)==POS_INFINITY ? q : DBL_MAX;
+	else if (q==NEG_INFINITY || a==0 || fabs(b)==POS_INFINITY || q!=q)
+		return q;
+	else {
+		double r=eft_fma(-q,b,a);
+		return (b>0? r : -r)>0 ? q : previous_float(q);
+	}
+}
+
+inline double eft_div_up_special(double a, double b, double q) {
+	if (q==NEG_INFINITY)
+		return fabs(a)==POS_INFINITY ? q : -DBL_MAX;
+	else if (q==POS_INFINITY || a==0 || fabs(b)==POS_INFINITY || q!=q)
+		return q;
+	else {
+		double r=eft_fma(-q,b,a);
+		return (b>0? r : -r)<0 ? q : next_float(q);
+	}
+}
+
+inline double eft_div_down(double a, double b) {
+	double q=a/b;
+	if (fabs(q)>=EFT_MIN_EXACT && fabs(q)<=DBL_MAX && fabs(a)>=EFT_MIN_EXACT) {
+		double r=eft_fma(-q,b,a); // r=a-q*b, the sign of a/b-q is the sign of r/b
+		return eft_down(q,b>0? r : -r);
+	} else
+		return eft_div_down_special(a,b,q);
+}
+
+inline double eft_div_up(double a, double b) {
+	double q=a/b;
+	if (fabs(q)>=EFT_MIN_EXACT && fabs(q)<=DBL_MAX && fabs(a)>=EFT_MIN_EXACT) {
+		double r=eft_fma(-q,b,a);
+		return eft_up(q,b>0? r : -r);
+	} else
+		return eft_div_up_special(a,b,q);
+}
+
+/* a must be positive or zero. */
+inline double eft_sqrt_down(double a) {
+	double s=::sqrt(a);
+	if (a>=EFT_MIN_EXACT && a<=DBL_MAX)
+		return eft_down(s,eft_fma(-s,s,a));
+	else if (a==0 || a==POS_INFINITY)
+		return s;
+	else
+		return eft_fma(-s,s,a)>0 ? s : previous_float(s);
+}
+
+inline double eft_sqrt_up(double a) {
+	double s=::sqrt(a);
+	if (a>=EFT_MIN_EXACT && a<=DBL_MAX)
+		return eft_up(s,eft_fma(-s,s,a));
+	else if (a==0 || a==POS_INFINITY)
+		return s;
+	else
+		return eft_fma(-s,s,a)<0 ? s : next_float(s);
+}
+
+/* a^n by binary exponentiation (a>=0, n>=0).
+ * The rounding is monotonic so the result is a lower bound. */
+inline double eft_pow_down(double a, int n) {
+	double r=1.0;
+	while (n>0) {
+		if (n%2) r=eft_mul_down(r,a);
+		n/=2;
+		if (n>0) a=eft_mul_down(a,a);
+	}
+	return r;
+}
+
+inline double eft_pow_up(double a, int n) {
+	double r=1.0;
+	while (n>0) {
+		if (n%2) r=eft_mul_up(r,a);
+		n/=2;
+		if (n>0) a=eft_mul_up(a,a);
+	}
+	return r;
+}
+
+/* Lower bound of a^(1/n) (a>=0, n>0). The value of the mathematical
+ * library is decreased until its n-th power is checked to be below a. */
+inline double eft_root_down(double a, int n) {
+	double r=::pow(a,1.0/n);
+	double h=r*DBL_EPSILON>DBL_MIN*DBL_EPSILON? r*DBL_EPSILON : DBL_MIN*DBL_EPSILON;
+	while (r>0 && eft_pow_up(r,n)>a) {
+		r-=h;
+		h*=2;
+	}
+	return r>0 ? r : 0;
+}
+
+inline double eft_root_up(double a, int n) {
+	double r=::pow(a,1.0/n);
+	double h=r*DBL_EPSILON>DBL_MIN*DBL_EPSILON? r*DBL_EPSILON : DBL_MIN*DBL_EPSILON;
+	while (eft_pow_down(r,n)<a) {
+		r+=h;
+		h*=2;
+	}
+	return r;
+}
+
+/* Bounds of a value of the mathematical library
+ * (an infinite value of a finite argument is an overflow). */
+inline double eft_libm_down(double y) {
+	return y==POS_INFINITY ? DBL_MAX : previous_float(previous_float(y));
+}
+
+inline double eft_libm_up(double y) {
+	return y==NEG_INFINITY ? -DBL_MAX : next_float(next_float(y));
+}
+
+#ifdef __AVX__
+/*
+ * Vector versions of the operations with finite bounds. The four products
+ * (or quotients) are calculated at once, so there is no case analysis on
+ * the signs of the bounds. The next (or previous) float of a float x
+ * with |x|>=EFT_MIN_EXACT is x+phi|x| (Rump, Zimmermann, Boldo and Melquiond),
+ * which is simpler with vectors than the integer representation. Under
+ * this threshold, x+max(phi|x|,DBL_MIN) is only an upper bound. Note: the
+ * constant eta=DBL_MIN*DBL_EPSILON of the original formula is not used
+ * because subnormal operands are very slow on most processors.
+ *
+ * The functions return false in the cases with infinite bounds, overflows
+ * and underflows (the scalar versions must be called instead).
+ */
+const double EFT_PHI = 0.5*DBL_EPSILON*(1+DBL_EPSILON);
+
+/* Return x+max(phi|x|,DBL_MIN) for the lanes where e>0. */
+inline __m256d eft_vec_up(__m256d x, __m256d absx, __m256d e) {
+	__m256d d=_mm256_max_pd(_mm256_mul_pd(absx,_mm256_set1_pd(EFT_PHI)),_mm256_set1_pd(DBL_MIN));
+	return _mm256_add_pd(x,_mm256_and_pd(d,_mm256_cmp_pd(e,_mm256_setzero_pd(),_CMP_GT_OQ)));
+}
+
+/* Return x-max(phi|x|,DBL_MIN) for the lanes where e<0. */
+inline __m256d eft_vec_down(__m256d x, __m256d absx, __m256d e) {
+	__m256d d=_mm256_max_pd(_mm256_mul_pd(absx,_mm256_set1_pd(EFT_PHI)),_mm256_set1_pd(DBL_MIN));
+	return _mm256_sub_pd(x,_mm256_and_pd(d,_mm256_cmp_pd(e,_mm256_setzero_pd(),_CMP_LT_OQ)));
+}
+
+/* z=[min(l),max(u)] */
+inline void eft_vec_hull(__m256d l, __m256d u, EFT_INTERVAL& z) {
+	__m128d l2=_mm_min_pd(_mm256_castpd256_pd128(l),_mm256_extractf128_pd(l,1));
+	__m128d u2=_mm_max_pd(_mm256_castpd256_pd128(u),_mm256_extractf128_pd(u,1));
+	l2=_mm_min_sd(l2,_mm_unpackhi_pd(l2,l2));
+	u2=_mm_max_sd(u2,_mm_unpackhi_pd(u2,u2));
+	_mm_storeu_pd(&z.inf,_mm_unpacklo_pd(l2,u2));
+}
+
+/* z=x+y (or x-y). The lower bound is negated so that both bounds are rounded upward. */
+inline bool eft_vec_add(const EFT_INTERVAL& x, const EFT_INTERVAL& y, EFT_INTERVAL& z, bool sub) {
+	const __m128d sign=_mm_set_pd(0.0,-0.0);
+	__m128d a=_mm_xor_pd(_mm_loadu_pd(&x.inf),sign);
+	__m128d b=_mm_loadu_pd(&y.inf);
+	b=sub? _mm_xor_pd(_mm_shuffle_pd(b,b,1),_mm_set_pd(-0.0,0.0)) : _mm_xor_pd(b,sign);
+	__m128d s=_mm_add_pd(a,b);
+	// -oo is an overflow of a lower bound (resp. upper bound) rounded downward (resp. upward)
+	if (_mm_movemask_pd(_mm_cmp_pd(s,_mm_set1_pd(NEG_INFINITY),_CMP_EQ_OQ))) return false;
+	__m128d bb=_mm_sub_pd(s,a);
+	__m128d e=_mm_add_pd(_mm_sub_pd(a,_mm_sub_pd(s,bb)),_mm_sub_pd(b,bb));
+	__m128d abss=_mm_andnot_pd(_mm_set1_pd(-0.0),s);
+	__m128d d=_mm_max_pd(_mm_mul_pd(abss,_mm_set1_pd(EFT_PHI)),_mm_set1_pd(DBL_MIN));
+	s=_mm_add_pd(s,_mm_and_pd(d,_mm_cmp_pd(e,_mm_setzero_pd(),_CMP_GT_OQ)));
+	_mm_storeu_pd(&z.inf,_mm_xor_pd(s,sign));
+	return true;
+}
+
+/* z=x*y. */
+inline bool eft_vec_mul(const EFT_INTERVAL& x, const EFT_INTERVAL& y, EFT_INTERVAL& z) {
+	__m128d xv=_mm_loadu_pd(&x.inf);
+	__m128d yv=_mm_loadu_pd(&y.inf);
+	__m256d u=_mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_unpacklo_pd(xv,xv)),_mm_unpackhi_pd(xv,xv),1);
+	__m256d v=_mm256_insertf128_pd(_mm256_castpd128_pd256(yv),yv,1);
+	__m256d p=_mm256_mul_pd(u,v);
+	__m256d absp=_mm256_andnot_pd(_mm256_set1_pd(-0.0),p);
+	// the error is exact if |p|>=EFT_MIN_EXACT or if p=0 with a zero operand
+	__m256d zero=_mm256_setzero_pd();
+	__m256d exact=_mm256_or_pd(_mm256_cmp_pd(absp,_mm256_set1_pd(EFT_MIN_EXACT),_CMP_GE_OQ),
+			_mm256_or_pd(_mm256_cmp_pd(u,zero,_CMP_EQ_OQ),_mm256_cmp_pd(v,zero,_CMP_EQ_OQ)));
+	__m256d ok=_mm256_and_pd(exact,_mm256_cmp_pd(absp,_mm256_set1_pd(DBL_MAX),_CMP_LE_OQ));
+	if (_mm256_movemask_pd(ok)!=0xF) return false;
+	__m256d e=_mm256_fmsub_pd(u,v,p);
+	eft_vec_hull(eft_vec_down(p,absp,e),eft_vec_up(p,absp,e),z);
+	return true;
+}
+
+/* z=x/y, where y does not contain 0. */
+inline bool eft_vec_div(const EFT_INTERVAL& x, const EFT_INTERVAL& y, EFT_INTERVAL& z) {
+	__m128d xv=_mm_loadu_pd(&x.inf);
+	__m128d yv=_mm_loadu_pd(&y.inf);
+	__m256d u=_mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_unpacklo_pd(xv,xv)),_mm_unpackhi_pd(xv,xv),1);
+	__m256d v=_mm256_insertf128_pd(_mm256_castpd128_pd256(yv),yv,1);
+	__m256d q=_mm256_div_pd(u,v);
+	__m256d absq=_mm256_andnot_pd(_mm256_set1_pd(-0.0),q);
+	__m256d absu=_mm256_andnot_pd(_mm256_set1_pd(-0.0),u);
+	__m256d min=_mm256_set1_pd(EFT_MIN_EXACT);
+	// the remainder is exact if |q|>=EFT_MIN_EXACT and |u|>=EFT_MIN_EXACT, or if u=0
+	__m256d exact=_mm256_or_pd(_mm256_and_pd(_mm256_cmp_pd(absq,min,_CMP_GE_OQ),_mm256_cmp_pd(absu,min,_CMP_GE_OQ)),
+			_mm256_cmp_pd(u,_mm256_setzero_pd(),_CMP_EQ_OQ));
+	__m256d ok=_mm256_and_pd(exact,_mm256_cmp_pd(absq,_mm256_set1_pd(DBL_MAX),_CMP_LE_OQ));
+	if (_mm256_movemask_pd(ok)!=0xF) return false;
+	// u/v-q has the sign of r/v, where r=u-q*v
+	__m256d r=_mm256_fnmadd_pd(q,v,u);
+	__m256d e=_mm256_xor_pd(r,_mm256_and_pd(v,_mm256_set1_pd(-0.0)));
+	eft_vec_hull(eft_vec_down(q,absq,e),eft_vec_up(q,absq,e),z);
+	return true;
+}
+#endif
+
+inline Interval::Interval(const EFT_INTERVAL& x) : itv(x) {
+
+}
+
+inline Interval& Interval::operator=(const EFT_INTERVAL& x) {
+	this->itv = x;
+	return *this;
+}
+
+inline Interval& Interval::operator+=(double d) {
+	if (!is_empty()) {
+		if (d==NEG_INFINITY || d==POS_INFINITY) set_empty();
+		else if (d!=0) *this=Interval(EFT_INTERVAL(eft_add_down(lb(),d),eft_add_up(ub(),d)));
+	}
+	return *this;
+}
+
+inline Interval& Interval::operator-=(double d) {
+	if (!is_empty()) {
+		if (d==NEG_INFINITY || d==POS_INFINITY) set_empty();
+		else if (d!=0) *this=Interval(EFT_INTERVAL(eft_add_down(lb(),-d),eft_add_up(ub(),-d)));
+	}
+	return *this;
+}
+
+inline Interval& Interval::operator*=(double d) {
+	return ((*this)*=Interval(d));
+}
+
+inline Interval& Interval::operator/=(double d) {
+	return ((*this)/=Interval(d));
+}
+
+inline Interval& Interval::operator+=(const Interval& x) {
+	if (is_empty()) return *this;
+	else if (x.is_empty()) {
+		set_empty();
+		return *this;
+	}
+#ifdef __AVX__
+	else if (eft_vec_add(itv,x.itv,itv,false))
+		return *this;
+#endif
+	else {
+		*this=Interval(EFT_INTERVAL(eft_add_down(lb(),x.lb()),eft_add_up(ub(),x.ub())));
+		return *this;
+	}
+}
+
+inline Interval& Interval::operator-=(const Interval& x) {
+	if (is_empty()) return *this;
+	else if (x.is_empty()) {
+		set_empty();
+		return *this;
+	}
+#ifdef __AVX__
+	else if (eft_vec_add(itv,x.itv,itv,true))
+		return *this;
+#endif
+	else {
+		*this=Interval(EFT_INTERVAL(eft_add_down(lb(),-x.ub()),eft_add_up(ub(),-x.lb())));
+		return *this;
+	}
+}
+
+inline Interval& Interval::operator*=(const Interval& y) {
+
+	if (is_empty()) return *this;
+	if (y.is_empty()) { *this=Interval::EMPTY_SET; return *this; }
+
+#ifdef __AVX__
+	if (eft_vec_mul(itv,y.itv,itv)) return *this;
+#endif
+
+	const double a(lb());
+	const double b(ub());
+	const double c(y.lb());
+	const double d(y.ub());
+
+	if ((a==0 && b==0) || (c==0 && d==0)) { *this=Interval(0.0); return *this; }
+
+	if (((a<0) && (b>0)) && (c==NEG_INFINITY || d==POS_INFINITY)) { *this=Interval(NEG_INFINITY, POS_INFINITY); return *this; }
+
+	if (((c<0) && (d>0)) && (a==NEG_INFINITY || b==POS_INFINITY)) { *this=Interval(NEG_INFINITY, POS_INFINITY); return *this; }
+
+	// [-inf, _] x [_ 0] ou [0,_] x [_, +inf]
+	if (((a==NEG_INFINITY) && (d==0)) || ((d==POS_INFINITY) && (a==0))) {
+		if ((b<=0) || (c>=0)) { *this=Interval(0.0, POS_INFINITY); return *this; }
+		else {
+			*this=Interval(eft_mul_down(b,c), POS_INFINITY);
+			return *this;
+		}
+	}
+
+	// [-inf, _] x [0, _] ou [0, _] x [-inf, _]
+	if (((a==NEG_INFINITY) && (c==0)) || ((c==NEG_INFINITY) && (a==0))) {
+		if ((b<=0) || (d<=0)) { *this=Interval(NEG_INFINITY, 0.0); return *this; }
+		else {
+			*this=Interval(NEG_INFINITY,eft_mul_up(b,d));
+			return *this;
+		}
+	}
+
+	// [_,0] x [-inf, _] ou [_, +inf] x [0,_]
+	if (((c==NEG_INFINITY) && (b==0)) || ((b==POS_INFINITY) && (c==0))) {
+		if ((d<=0) || (a>=0)) { *this=Interval(0.0, POS_INFINITY); return *this; }
+		else {
+			*this=Interval(eft_mul_down(a,d), POS_INFINITY);
+			return *this;
+		}
+	}
+
+	// [_, +inf] x [_,0] ou [_,0] x [_, +inf]
+	if (((b==POS_INFINITY) && (d==0)) || ((d==POS_INFINITY) && (b==0))) {
+		if ((a>=0) || (c>=0)) { *this=Interval(NEG_INFINITY, 0.0); return *this; }
+		else {
+			*this=Interval(NEG_INFINITY, eft_mul_up(a,c));
+			return *this;
+		}
+	}
+
+	if (a>=0) {
+		if (c>=0) {
+			itv=EFT_INTERVAL(eft_mul_down(a,c),eft_mul_up(b,d));
+		}
+		else {
+			if (d<=0) itv=EFT_INTERVAL(eft_mul_down(b,c),eft_mul_up(a,d));
+			else itv=EFT_INTERVAL(eft_mul_down(b,c),eft_mul_up(b,d));
+		}
+	} else {
+		if (b<=0) {
+			if (c>=0) itv=EFT_INTERVAL(eft_mul_down(a,d),eft_mul_up(b,c));
+			else if (d<=0) itv=EFT_INTERVAL(eft_mul_down(b,d),eft_mul_up(a,c));
+			else itv=EFT_INTERVAL(eft_mul_down(a,d),eft_mul_up(a,c));
+		} else {
+			if (c>=0) itv=EFT_INTERVAL(eft_mul_down(a,d),eft_mul_up(b,d));
+			else if (d<=0) itv=EFT_INTERVAL(eft_mul_down(b,c),eft_mul_up(a,c));
+			else {
+				double l1=eft_mul_down(a,d), l2=eft_mul_down(b,c);
+				double u1=eft_mul_up(a,c), u2=eft_mul_up(b,d);
+				itv=EFT_INTERVAL(l1<l2? l1 : l2, u1>u2? u1 : u2);
+			}
+		}
+	}
+	return *this;
+}
+
+inline Interval& Interval::operator/=(const Interval& y) {
+
+	if (is_empty()) return *this;
+	if (y.is_empty()) { *this=Interval::EMPTY_SET; return *this; }
+
+	const double a(lb());
+	const double b(ub());
+	const double c(y.lb());
+	const double d(y.ub());
+
+#ifdef __AVX__
+	if ((c>0 || d<0) && eft_vec_div(itv,y.itv,itv)) return *this;
+#endif
+
+	if (c==0 && d==0) {
+		*this=Interval::EMPTY_SET;
+		return *this;
+	}
+
+	if (a==0 && b==0) {
+		return *this;
+	}
+
+	if (c>0) {
+		if (a>=0) {
+			itv=EFT_INTERVAL(eft_div_down(a,d), eft_div_up(b,c));
+		}
+		else if (b<0) {
+			itv=EFT_INTERVAL(eft_div_down(a,c), eft_div_up(b,d));
+		}
+		else {
+			itv=EFT_INTERVAL(eft_div_down(a,c), eft_div_up(b,c));
+		}
+		return *this;
+	}
+
+	if (d<0) {
+		if (a>=0) {
+			itv=EFT_INTERVAL(eft_div_down(b,d), eft_div_up(a,c));
+		}
+		else if (b<0) {
+			itv=EFT_INTERVAL(eft_div_down(b,c), eft_div_up(a,d));
+		}
+		else {
+			itv=EFT_INTERVAL(eft_div_down(b,d), eft_div_up(a,d));
+		}
+		return *this;
+	}
+
+	if ((b<=0) && d==0) {
+		*this=Interval(eft_div_down(b,c), POS_INFINITY);
+		return *this;
+	}
+
+	if (b<=0 && c<0 && d>0) {
+		*this=Interval(NEG_INFINITY, POS_INFINITY);
+		return *this;
+	}
+
+	if (b<=0 && c==0) {
+		*this=Interval(NEG_INFINITY, eft_div_up(b,d));
+		return *this;
+	}
+
+	if (a>=0 && d==0) {
+		*this=Interval(NEG_INFINITY, eft_div_up(a,c));
+		return *this;
+	}
+
+	if (a>=0 && c<0 && d>0) {
+		*this=Interval(NEG_INFINITY, POS_INFINITY);
+		return *this;
+	}
+
+	if (a>=0 && c==0) {
+		*this=Interval(eft_div_down(a,d), POS_INFINITY);
+		return *this;
+	}
+
+	*this=Interval(NEG_INFINITY, POS_INFINITY); // a<0<b et c<=0<=d
+	return *this;
+}
+
+inline Interval Interval:: operator-() const {
+	if (is_empty()) return *this;
+	return Interval(EFT_INTERVAL(-ub(),-lb()));
+}
+
+inline Interval& Interval::div2_inter(const Interval& x, const Interval& y) {
+	Interval out2;
+	div2_inter(x,y,out2);
+	*this |= out2;
+	return *this;
+}
+
+inline void Interval::set_empty() {
+	itv=EFT_INTERVAL();
+}
+
+inline Interval& Interval::operator&=(const Interval& x) {
+	if (is_empty()) return *this;
+	if (x.is_empty()) { set_empty(); return *this; }
+
+	if ((lb()>x.ub()) || (x.lb()>ub())) {
+		set_empty();
+		return *this;
+	}
+	if (lb()<x.lb()) itv.inf=x.lb();
+	if (ub()>x.ub()) itv.sup=x.ub();
+	return *this;
+}
+
+inline Interval& Interval::operator|=(const Interval& x) {
+	if (is_empty()) { *this=x; return *this; }
+	if (x.is_empty()) return *this;
+
+	if (lb()>x.lb()) itv.inf=x.lb();
+	if (ub()<x.ub()) itv.sup=x.ub();
+	return *this;
+}
+
+inline double Interval::lb() const {
+	return itv.inf;
+}
+
+inline double Interval::ub() const {
+	return itv.sup;
+}
+
+inline double Interval::mid() const {
+	if (lb()==NEG_INFINITY)
+		if (ub()==POS_INFINITY) return 0;
+		else return -DBL_MAX;
+	else if (ub()==POS_INFINITY) return DBL_MAX;
+	else {
+		double m=0.5*(lb()+ub());
+		if (fabs(m)>DBL_MAX) m=0.5*lb()+0.5*ub(); // overflow
+		if (m<lb()) m=lb(); // watch dog
+		else if (m>ub()) m=ub();
+		return m;
+	}
+}
+
+inline bool Interval::is_empty() const {
+	return itv.inf>itv.sup;
+}
+
+inline bool Interval::is_degenerated() const {
+	return is_empty() || lb()==ub();
+}
+
+inline bool Interval::is_unbounded() const {
+	if (is_empty()) return false;
+	return lb()==NEG_INFINITY || ub()==POS_INFINITY;
+}
+
+inline double Interval::diam() const {
+	return is_empty()? 0 : eft_add_up(ub(),-lb());
+}
+
+inline double Interval::mig() const {
+	if (lb()>0)      return lb();
+	else if (ub()<0) return -ub();
+	else             return 0;
+}
+
+inline double Interval::mag() const {
+	return (fabs(lb())>fabs(ub())) ? fabs(lb()) : fabs(ub());
+}
+
+inline Interval operator&(const Interval& x1, const Interval& x2) {
+	Interval res(x1);
+	res &= x2;
+	return res;
+}
+
+inline Interval operator|(const Interval& x1, const Interval& x2) {
+	Interval res(x1);
+	res |= x2;
+	return res;
+}
+
+inline Interval operator+(const Interval& x, double d) {
+	Interval r(x);
+	r += d;
+	return r;
+}
+
+inline Interval operator-(const Interval& x, double d) {
+	Interval r(x);
+	r -= d;
+	return r;
+}
+
+inline Interval operator*(const Interval& x, double d) {
+	if (x.is_empty()) return x;
+	else if (d==NEG_INFINITY || d==POS_INFINITY) return Interval::EMPTY_SET;
+	else {
+		Interval r(x);
+		r *= d;
+		return r;
+	}
+}
+
+inline Interval operator/(const Interval& x, double d) {
+	if (x.is_empty()) return x;
+	else if (d==NEG_INFINITY || d==POS_INFINITY) return Interval::EMPTY_SET;
+	else {
+		Interval r(x);
+		r /= d;
+		return r;
+	}
+}
+
+inline Interval operator+(double d,const Interval& x) {
+	return x+d;
+}
+
+inline Interval operator-(double d, const Interval& x) {
+	if (x.is_empty()) return x;
+	else if (d==NEG_INFINITY || d==POS_INFINITY) return Interval::EMPTY_SET;
+	else {
+		Interval r(d);
+		r -= x;
+		return r;
+	}
+}
+
+inline Interval operator*(double d, const Interval& x) {
+	return x*d;
+}
+
+inline Interval operator/(double d, const Interval& x) {
+	return Interval(d)/x;
+}
+
+inline Interval operator+(const Interval& x1, const Interval& x2) {
+	Interval r(x1);
+	r += x2;
+	return r;
+}
+
+inline Interval operator-(const Interval& x1, const Interval& x2) {
+	Interval r(x1);
+	r -= x2;
+	return r;
+}
+
+inline Interval operator*(const Interval& x, const Interval& y) {
+	return (Interval(x)*=y);
+}
+
+inline Interval operator/(const Interval& x, const Interval& y) {
+	return (Interval(x)/=y);
+}
+
+inline Interval sqr(const Interval& x) {
+	if (x.is_empty()) return Interval::EMPTY_SET;
+	else {
+		double a1=x.lb(), a2=x.ub();
+		if (a1>=0) return Interval(EFT_INTERVAL(eft_mul_down(a1,a1),eft_mul_up(a2,a2)));
+		if (a2<=0) return Interval(EFT_INTERVAL(eft_mul_down(a2,a2),eft_mul_up(a1,a1)));
+		if (fabs(a1)>fabs(a2)) return Interval(EFT_INTERVAL(0,eft_mul_up(a1,a1)));
+		else                   return Interval(EFT_INTERVAL(0,eft_mul_up(a2,a2)));
+	}
+}
+
+inline Interval sqrt(const Interval& x) {
+	if (x.is_empty() || x.ub()<0) return Interval::EMPTY_SET;
+	return Interval(EFT_INTERVAL(x.lb()>0 ? eft_sqrt_down(x.lb()) : 0, eft_sqrt_up(x.ub())));
+}
+
+inline Interval pow(const Interval& x, int n) {
+	if (x.is_empty()) return Interval::EMPTY_SET;
+	else if (n==0)	  return Interval::ONE;
+	else if (n<0)	  return 1.0/pow(x,-n);
+	else if (n==1)	  return x;
+	else if (n%2!=0) {
+		double l=x.lb()>=0 ? eft_pow_down(x.lb(),n) : -eft_pow_up(-x.lb(),n);
+		double u=x.ub()>=0 ? eft_pow_up(x.ub(),n) : -eft_pow_down(-x.ub(),n);
+		return Interval(EFT_INTERVAL(l,u));
+	}
+	else {
+		double a1=x.mig();
+		double a2=x.mag();
+		return Interval(EFT_INTERVAL(eft_pow_down(a1,n),eft_pow_up(a2,n)));
+	}
+}
+
+inline Interval pow(const Interval& x, double d) {
+	if (d==NEG_INFINITY || d==POS_INFINITY)
+		return Interval::EMPTY_SET;
+	else if (d==0)
+		return Interval::ONE;
+	else if (d<0)
+		return 1.0/pow(x,-d);
+	else
+		return pow(x,Interval(d));
+}
+
+inline Interval pow(const Interval &x, const Interval &y) {
+	if (x.is_empty()) return Interval::EMPTY_SET;
+	else return exp(y * log(x));
+}
+
+inline Interval root(const Interval& x, int den) {
+	if (x.is_empty()) return Interval::EMPTY_SET;
+	if (den<0) return Interval(1.0)/root(x,-den);
+	if (den==1) return x;
+	if (den%2==0) {
+		if (x.ub()<0) return Interval::EMPTY_SET;
+		return Interval(EFT_INTERVAL(x.lb()>0 ? eft_root_down(x.lb(),den) : 0, eft_root_up(x.ub(),den)));
+	} else {
+		double l=x.lb()>=0 ? eft_root_down(x.lb(),den) : -eft_root_up(-x.lb(),den);
+		double u=x.ub()>=0 ? eft_root_up(x.ub(),den) : -eft_root_down(-x.ub(),den);
+		return Interval(EFT_INTERVAL(l,u));
+	}
+}
+
+inline Interval exp(const Interval& x) {
+	if (x.is_empty()) return Interval::EMPTY_SET;
+	double l=eft_libm_down(::exp(x.lb()));
+	return Interval(EFT_INTERVAL(l>0? l : 0, eft_libm_up(::exp(x.ub()))));
+}
+
+inline Interval log(const Interval& x) {
+	if (x.is_empty() || x.ub()<=0) return Interval::EMPTY_SET;
+	return Interval(EFT_INTERVAL(x.lb()>0 ? eft_libm_down(::log(x.lb())) : NEG_INFINITY, eft_libm_up(::log(x.ub()))));
+}
+
+inline Interval cos(const Interval& x) {
+	if (x.is_empty()) return Interval::EMPTY_SET;
+	else return sin(x+Interval::HALF_PI);
+}
+
+inline Interval sin(const Interval& x) {
+	if (x.is_empty()) return Interval::EMPTY_SET;
+	if (x.diam()>=Interval::TWO_PI.lb()) return Interval(-1,1);
+
+	// b=x-2kpi is an enclosure of x shifted near [0,2pi]
+	Interval b(x);
+	if (x.lb()<0 || x.lb()>=Interval::TWO_PI.lb()) {
+		b -= ::floor(x.lb()/Interval::TWO_PI.ub())*Interval::TWO_PI;
+		if (b.diam()>=Interval::TWO_PI.lb()) return Interval(-1,1);
+	}
+
+	double sin1=::sin(b.lb());
+	double sin2=::sin(b.ub());
+	double l=eft_libm_down(sin1<sin2 ? sin1 : sin2);
+	double u=eft_libm_up(sin1<sin2 ? sin2 : sin1);
+
+	// b is in [-pi,4pi]: the extrema are reached in (2k+1)pi/2, k=-1..3,
+	// which are also enclosed by intervals.
+	for (int k=-1; k<=3; k++) {
+		Interval crit=(2*k+1)*Interval::HALF_PI;
+		if (b.lb()<=crit.ub() && crit.lb()<=b.ub()) {
+			if (k%2==0) u=1;
+			else l=-1;
+		}
+	}
+	return Interval(EFT_INTERVAL(l<-1 ? -1 : l, u>1 ? 1 : u));
+}
+
+inline Interval tan(const Interval& x) {
+	if (x.is_empty()) return Interval::EMPTY_SET;
+	if (x.diam()>=Interval::PI.lb()) return Interval::ALL_REALS;
+
+	// b=x-kpi is an enclosure of x shifted near [0,pi]
+	Interval b(x);
+	if (x.lb()<0 || x.lb()>=Interval::PI.lb()) {
+		b -= ::floor(x.lb()/Interval::PI.ub())*Interval::PI;
+		if (b.diam()>=Interval::PI.lb()) return Interval::ALL_REALS;
+	}
+
+	// b is in [-pi,2pi]: the poles are (2k+1)pi/2, k=-1..1
+	for (int k=-1; k<=1; k++) {
+		Interval pole=(2*k+1)*Interval::HALF_PI;
+		if (b.lb()<=pole.ub() && pole.lb()<=b.ub())
+			return Interval::ALL_REALS;
+	}
+	return Interval(EFT_INTERVAL(eft_libm_down(::tan(b.lb())), eft_libm_up(::tan(b.ub()))));
+}
+
+inline Interval cosh(const Interval& x) {
+	if (x.is_empty()) return Interval::EMPTY_SET;
+	double l=x.mig()==0 ? 1 : eft_libm_down(::cosh(x.mig()));
+	return Interval(EFT_INTERVAL(l<1 ? 1 : l, eft_libm_up(::cosh(x.mag()))));
+}
+
+inline Interval acos(const Interval& x) {
+	if (x.is_empty() || x.ub()<-1.0 || x.lb()>1.0) return Interval::EMPTY_SET;
+	double l=x.ub()>=1 ? 0 : eft_libm_down(::acos(x.ub()));
+	double u=x.lb()<=-1 ? Interval::PI.ub() : eft_libm_up(::acos(x.lb()));
+	return Interval(EFT_INTERVAL(l<0 ? 0 : l, u>Interval::PI.ub() ? Interval::PI.ub() : u));
+}
+
+inline Interval asin(const Interval& x) {
+	if (x.is_empty() || x.ub()<-1.0 || x.lb()>1.0) return Interval::EMPTY_SET;
+	double m=Interval::HALF_PI.ub();
+	double l=x.lb()<=-1 ? -m : eft_libm_down(::asin(x.lb()));
+	double u=x.ub()>=1 ? m : eft_libm_up(::asin(x.ub()));
+	return Interval(EFT_INTERVAL(l<-m ? -m : l, u>m ? m : u));
+}
+
+inline Interval atan(const Interval& x) {
+	if (x.is_empty()) return Interval::EMPTY_SET;
+	double m=Interval::HALF_PI.ub();
+	double l=eft_libm_down(::atan(x.lb()));
+	double u=eft_libm_up(::atan(x.ub()));
+	return Interval(EFT_INTERVAL(l<-m ? -m : l, u>m ? m : u));
+}
+
+inline Interval sinh(const Interval& x) {
+	if (x.is_empty()) return Interval::EMPTY_SET;
+	return Interval(EFT_INTERVAL(eft_libm_down(::sinh(x.lb())), eft_libm_up(::sinh(x.ub()))));
+}
+
+inline Interval tanh(const Interval& x) {
+	if (x.is_empty()) return Interval::EMPTY_SET;
+	double l=eft_libm_down(::tanh(x.lb()));
+	double u=eft_libm_up(::tanh(x.ub()));
+	return Interval(EFT_INTERVAL(l<-1 ? -1 : l, u>1 ? 1 : u));
+}
+
+inline Interval acosh(const Interval& x) {
+	if (x.is_empty() || x.ub()<1.0) return Interval::EMPTY_SET;
+	double l=x.lb()<=1 ? 0 : eft_libm_down(::acosh(x.lb()));
+	return Interval(EFT_INTERVAL(l<0 ? 0 : l, eft_libm_up(::acosh(x.ub()))));
+}
+
+inline Interval asinh(const Interval& x) {
+	if (x.is_empty()) return Interval::EMPTY_SET;
+	return Interval(EFT_INTERVAL(eft_libm_down(::asinh(x.lb())), eft_libm_up(::asinh(x.ub()))));
+}
+
+inline Interval atanh(const Interval& x) {
+	if (x.is_empty() || x.ub()<-1.0 || x.lb()>1.0) return Interval::EMPTY_SET;
+	double l=x.lb()<=-1 ? NEG_INFINITY : eft_libm_down(::atanh(x.lb()));
+	double u=x.ub()>=1 ? POS_INFINITY : eft_libm_up(::atanh(x.ub()));
+	return Interval(EFT_INTERVAL(l,u));
+}
+
+inline Interval abs(const Interval &x) {
+	if (x.is_empty()) return Interval::EMPTY_SET;
+	else if (x.lb()>=0) return x;
+	else if (x.ub()<=0) return -x;
+	else return Interval(EFT_INTERVAL(0,x.mag()));
+}
+
+inline Interval max(const Interval& x, const Interval& y) {
+	if (x.is_empty() || y.is_empty()) return Interval::EMPTY_SET;
+	else return Interval(x.lb()>y.lb()? x.lb() : y.lb(), x.ub()>y.ub()? x.ub() : y.ub());
+}
+
+inline Interval min(const Interval& x, const Interval& y) {
+	if (x.is_empty() || y.is_empty()) return Interval::EMPTY_SET;
+	else return Interval(x.lb()<y.lb()? x.lb() : y.lb(), x.ub()<y.ub()? x.ub() : y.ub());
+}
+
+inline Interval integer(const Interval& x) {
+	if (x.is_empty()) return Interval::EMPTY_SET;
+	double l= (x.lb()==NEG_INFINITY? NEG_INFINITY : ceil(x.lb()));
+	double r= (x.ub()==POS_INFINITY? POS_INFINITY : floor(x.ub()));
+	if (l>r) return Interval::EMPTY_SET;
+	else return Interval(l,r);
+}
+
+inline bool bwd_mul(const Interval& y, Interval& x1, Interval& x2) {
+	if (y.contains(0)) {
+		if (!x2.contains(0))                           // if y and x2 contains 0, x1 can be any double number.
+			if (x1.div2_inter(y,x2).is_empty()) { x2.set_empty(); return false; }  // otherwise y=x1*x2 => x1=y/x2
+		if (x1.contains(0)) return true;
+		if (x2.div2_inter(y,x1).is_empty()) { x1.set_empty(); return false; }
+		else return true;
+	} else {
+		if (x1.div2_inter(y,x2).is_empty()) { x2.set_empty(); return false; }
+		if (x2.div2_inter(y,x1).is_empty()) { x1.set_empty(); return false; }
+		else return true;
+	}
+}
+
+inline bool bwd_sqr(const Interval& y, Interval& x) {
+
+	Interval proj=sqrt(y);
+	Interval pos_proj= proj & x;
+	Interval neg_proj = (-proj) & x;
+
+	x = pos_proj | neg_proj;
+
+	return !x.is_empty();
+}
+
+inline bool bwd_pow(const Interval& y, int expon, Interval& x) {
+
+	if (expon % 2 ==0) {
+		Interval proj=root(y,expon);
+		Interval pos_proj= proj & x;
+		Interval neg_proj = (-proj) & x;
+
+		x = pos_proj | neg_proj;
+
+		return !x.is_empty();
+
+	} else {
+
+		x &= root(y, expon);
+		return !x.is_empty();
+
+	}
+}
+
+inline bool bwd_pow(const Interval& , Interval& , Interval& ) {
+	not_implemented("warning: bwd_power(y,x1,x2) (with x1 and x2 intervals) not implemented yet with EFT");
+	return true;
+}
+
+/**
+ * ftype:
+ *   COS = 0
+ *   SIN = 1
+ *   TAN = 2
+ */
+inline bool bwd_trigo(const Interval& y, Interval& x, int ftype) {
+
+	const int COS=0;
+	const int SIN=1;
+	const int TAN=2;
+
+	Interval period_0, nb_period;
+
+	switch (ftype) {
+	case COS :
+		period_0 = acos(y); break;
+	case SIN :
+		period_0 = asin(y); break;
+	case TAN :
+		period_0 = atan(y); break;
+	default : 
+		assert(false); break;
+	} 
+
+	if (period_0.is_empty()) { x.set_empty(); return false; }
+
+	if (x.lb()==NEG_INFINITY || x.ub()==POS_INFINITY) return true; // infinity of periods
+
+	switch (ftype) {
+	case COS :
+		nb_period = x / Interval::PI; break;
+	case SIN :
+		nb_period = (x+Interval::HALF_PI) / Interval::PI; break;
+	case TAN :
+		nb_period = (x+Interval::HALF_PI) / Interval::PI; break;
+	default :
+		assert(false); break;
+	}
+	
+	if (nb_period.mag() > INT_MAX) return true;
+
+	int p1 = ((int) nb_period.lb())-1;
+	int p2 = ((int) nb_period.ub());
+	Interval tmp1, tmp2;
+
+	bool found = false;
+	int i = p1-1;
+
+	switch(ftype) {
+	case COS :
+		// should find in at most 2 turns.. but consider rounding !
+		while (++i<=p2 && !found) found = !(tmp1 = (x & (i%2==0? period_0 + i*Interval::PI : (i+1)*Interval::PI - period_0))).is_empty();
+		break;
+	case SIN :
+		while (++i<=p2 && !found) found = !(tmp1 = (x & (i%2==0? period_0 + i*Interval::PI : i*Interval::PI - period_0))).is_empty();
+		break;
+	case TAN :
+		while (++i<=p2 && !found) found = !(tmp1 = (x & (period_0 + i*Interval::PI))).is_empty();
+		break;
+	}
+
+	if (!found) { x.set_empty(); return false; }
+	found = false;
+	i=p2+1;
+
+	switch(ftype) {
+	case COS :
+		while (--i>=p1 && !found) found = !(tmp2 = (x & (i%2==0? period_0 + i*Interval::PI : (i+1)*Interval::PI - period_0))).is_empty();
+		break;
+	case SIN :
+		while (--i>=p1 && !found) found = !(tmp2 = (x & (i%2==0? period_0 + i*Interval::PI : i*Interval::PI - period_0))).is_empty();
+		break;
+	case TAN :
+		while (--i>=p1 && !found) found = !(tmp2 = (x & (period_0 + i*Interval::PI))).is_empty();
+		break;
+	}
+
+	if (!found) {  x.set_empty(); return false; }
+
+	x = tmp1 | tmp2;
+
+	return true;
+}
+
+inline bool bwd_cos(const Interval& y,  Interval& x) {
+	return bwd_trigo(y,x,0);
+}
+
+inline bool bwd_sin(const Interval& y,  Interval& x) {
+	return bwd_trigo(y,x,1);
+}
+
+inline bool bwd_tan(const Interval& y,  Interval& x) {
+	return bwd_trigo(y,x,2);
+}
+
+inline bool bwd_cosh(const Interval& y,  Interval& x) {
+
+	Interval proj=acosh(y);
+	if (proj.is_empty()) return false;
+	Interval pos_proj= proj & x;
+	Interval neg_proj = (-proj) & x;
+
+	x = pos_proj | neg_proj;
+
+	return !x.is_empty();
+}
+
+inline bool bwd_sinh(const Interval& y,  Interval& x) {
+	x &= asinh(y);
+	return !x.is_empty();
+}
+
+inline bool bwd_tanh(const Interval& y,  Interval& x) {
+	x &= atanh(y);
+	return !x.is_empty();
+}
+
+
+
+inline bool bwd_abs(const Interval& y,  Interval& x) {
+	Interval x1 = x & y;
+	Interval x2 = x & (-y);
+	x &= x1 | x2;
+	return !x.is_empty();
+}
+
+} // end namespace
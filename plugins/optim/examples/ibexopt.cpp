@@ -41,6 +41,11 @@ int main(int argc, char** argv) {
 	args::ValueFlag<double> random_seed(parser, "float", _random_seed.str(), {"random-seed"});
 	args::ValueFlag<double> eps_x(parser, "float", _eps_x.str(), {"eps-x"});
 	args::ValueFlag<double> initial_loup(parser, "float", "Intial \"loup\" (a priori known upper bound).", {"initial-loup"});
+	args::ValueFlag<string> checkpoint(parser, "filename", "Checkpoint file. The state of the search is periodically saved "
+			"in this file (and at time out). See --checkpoint-period and --resume.", {"checkpoint"});
+	args::ValueFlag<double> checkpoint_period(parser, "float", "CPU time between two checkpoints (in seconds). Default value is 600.", {"checkpoint-period"});
+	args::ValueFlag<string> resume(parser, "filename", "Resume the search from a checkpoint file. The same options must be given "
+			"(the timeout includes the time of the previous runs).", {"resume"});
 	args::Flag rigor(parser, "rigor", "Activate rigor mode (certify feasibility of equalities).", {"rigor"});
 	args::Flag trace(parser, "trace", "Activate trace. Updates of loup/uplo are printed while minimizing.", {"trace"});
 	args::Flag format(parser, "format", "Display the output format in quiet mode", {"format"});
@@ -181,6 +186,19 @@ int main(int argc, char** argv) {
 			o.trace=trace.Get();
 		}
 
+		// This option periodically saves the state of the search
+		if (checkpoint) {
+			if (!quiet)
+				cout << "  checkpoint:\t" << checkpoint.Get() << endl;
+			o.checkpoint_file=checkpoint.Get();
+		}
+
+		if (checkpoint_period) {
+			if (!quiet)
+				cout << "  checkpoint period:\t" << checkpoint_period.Get() << "s" << endl;
+			o.checkpoint_period=checkpoint_period.Get();
+		}
+
 		if (!inHC4) {
 			cerr << "\n  \033[33mwarning: inHC4 disabled\033[0m (does not support vector/matrix operations)" << endl;
 		}
@@ -196,7 +214,9 @@ int main(int argc, char** argv) {
 			cout << "running............" << endl << endl;
 
 		// Search for the optimum
-		if (initial_loup)
+		if (resume)
+			o.optimize(resume.Get().c_str());
+		else if (initial_loup)
 			o.optimize(sys.box, initial_loup.Get());
 		else
 			o.optimize(sys.box);
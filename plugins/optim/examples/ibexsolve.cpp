@@ -45,6 +45,8 @@ int main(int argc, char** argv) {
 	args::Flag format(parser, "format", "Show the output text format", {"format"});
 	args::Flag txt(parser, "txt", "Write the output manifold in a easy-to-parse text file. See --format", {"txt"});
 	args::Flag mma(parser, "mma", "Write the output manifold as a Mathematica list.", {"mma"});
+	args::Flag stream(parser, "stream", "Write the output boxes in the output file as and when they are found "
+			"(the memory used does not depend on the number of boxes). Not compatible with --txt/--mma.", {"stream"});
 	args::Flag trace(parser, "trace", "Activate trace. \"Solutions\" (output boxes) are displayed as and when they are found.", {"trace"});
 	args::ValueFlag<string> boundary_test_arg(parser, "true|full-rank|half-ball|false", "Boundary test strength. Possible values are:\n"
 			"\t\t* true:\talways satisfied. Set by default for under constrained problems (0<m<n).\n"
@@ -189,6 +191,24 @@ int main(int argc, char** argv) {
 			s.trace=trace.Get();
 		}
 
+		// This option streams the output boxes into the output file
+		ManifoldStream* output_stream=NULL;
+		if (stream) {
+			if (txt || mma) {
+				cerr << "\nError: --stream is not compatible with --txt/--mma\n";
+				exit(0);
+			}
+			if (input_file && input_file.Get()==output_manifold_file) {
+				cerr << "\nError: with --stream, the input and output files must be different\n";
+				exit(0);
+			}
+			if (!quiet)
+				cout << "  stream:		ON" << endl;
+			const Manifold& manif=s.get_manifold();
+			output_stream=new ManifoldStream(output_manifold_file.c_str(), manif.n, manif.m, manif.nb_ineq);
+			s.sink=output_stream;
+		}
+
 		if (!quiet) {
 			cout << "*****************************************************************" << endl << endl;
 		}
@@ -208,7 +228,11 @@ int main(int argc, char** argv) {
 
 		if (sols) cout << s.get_manifold() << endl;
 
-		if (txt || mma)
+		if (output_stream) {
+			output_stream->close();
+			delete output_stream;
+		}
+		else if (txt || mma)
 			s.get_manifold().write_txt(output_manifold_file.c_str(), mma);
 		else
 			s.get_manifold().write(output_manifold_file.c_str());
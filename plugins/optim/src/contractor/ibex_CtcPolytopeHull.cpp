@@ -10,6 +10,9 @@
 
 #include "ibex_CtcPolytopeHull.h"
 #include "ibex_LinearizerFixed.h"
+#include "ibex_Lock.h"
+
+#include <vector>
 
 using namespace std;
 
@@ -19,15 +22,34 @@ namespace {
 
 class PolytopeHullEmptyBoxException { };
 
+/*
+ * Load in lp the constraints A (rows nb_var...) and B of another linear solver
+ * and the bounds of the variables.
+ */
+void load_lp(LinearSolver& lp, const Matrix& A, const IntervalVector& B, const IntervalVector& box) {
+	int n=box.size();
+	lp.clean_ctrs();
+	lp.set_bounds(box);
+	for (int i=n; i<A.nb_rows(); i++) {
+		if (B[i].is_degenerated())
+			lp.add_constraint(A[i],EQ,B[i].lb());
+		else {
+			if (B[i].lb()>-LinearSolver::default_max_bound)
+				lp.add_constraint(A[i],GEQ,B[i].lb());
+			if (B[i].ub()<LinearSolver::default_max_bound)
+				lp.add_constraint(A[i],LEQ,B[i].ub());
+		}
+	}
 }
 
-#ifndef  _IBEX_WITH_NOLP_
+}
 
 CtcPolytopeHull::CtcPolytopeHull(Linearizer& lr, int max_iter, int time_out, double eps, Interval limit_diam) :
 		Ctc(lr.nb_var()), lr(lr),
 		limit_diam_box(eps>limit_diam.lb()? eps : limit_diam.lb(), limit_diam.ub()),
 		mylinearsolver(nb_var, max_iter, time_out, eps),
-		contracted_vars(BitSet::all(nb_var)), own_lr(false) {
+		contracted_vars(BitSet::all(nb_var)), nb_threads(1), solvers(NULL), own_lr(false),
+		max_iter(max_iter), time_out(time_out), eps(eps) {
 
 }
 
@@ -35,14 +57,36 @@ CtcPolytopeHull::CtcPolytopeHull(const Matrix& A, const Vector& b, int max_iter,
 		Ctc(A.nb_cols()), lr(*new LinearizerFixed(A,b)),
 		limit_diam_box(eps>limit_diam.lb()? eps : limit_diam.lb(), limit_diam.ub()),
 		mylinearsolver(nb_var, max_iter, time_out, eps),
-		contracted_vars(BitSet::all(nb_var)), own_lr(true) {
+		contracted_vars(BitSet::all(nb_var)), nb_threads(1), solvers(NULL), own_lr(true),
+		max_iter(max_iter), time_out(time_out), eps(eps) {
 
 }
 
 CtcPolytopeHull::~CtcPolytopeHull() {
+	set_nb_threads(1);
 	if (own_lr) delete &lr;
 }
 
+void CtcPolytopeHull::set_nb_threads(int n) {
+	assert(n>=1);
+
+	if (solvers) {
+		for (int t=1; t<nb_threads; t++)
+			delete solvers[t];
+		delete[] solvers;
+		solvers=NULL;
+	}
+
+	nb_threads=n;
+
+	if (nb_threads==1) return; // sequential algorithm
+
+	solvers = new LinearSolver*[nb_threads];
+	solvers[0] = &mylinearsolver;
+	for (int t=1; t<nb_threads; t++)
+		solvers[t] = new LinearSolver(nb_var, max_iter, time_out, eps);
+}
+
 void CtcPolytopeHull::contract(IntervalVector& box) {
 
 	if (!(limit_diam_box.contains(box.max_diam()))) return;
@@ -60,7 +104,10 @@ void CtcPolytopeHull::contract(IntervalVector& box) {
 
 		if (cont==0) return;
 
-		optimizer(box);
+		if (solvers)
+			optimizer_parallel(box);
+		else
+			optimizer(box);
 
 		//mylinearsolver.writeFile("LP.lp");
 		//system ("cat LP.lp");
@@ -211,6 +258,63 @@ void CtcPolytopeHull::optimizer(IntervalVector& box) {
 	delete[] sup_bound;
 }
 
+void CtcPolytopeHull::optimizer_parallel(IntervalVector& box) {
+
+	// The LPs: minimization (2i) and maximization (2i+1) of the ith contracted variable
+	vector<int> vars;
+	for (int i=0; i<nb_var; i++)
+		if (contracted_vars[i]) vars.push_back(i);
+
+	int nb_lp=2*vars.size();
+	vector<LinearSolver::Status_Sol> stat(nb_lp, LinearSolver::UNKNOWN);
+	vector<Interval> opt(nb_lp);
+
+	mylinearsolver.set_bounds(box);
+
+	// The polytope, to be copied in the linear solvers of the other threads
+	Matrix A(mylinearsolver.get_nb_rows(),nb_var);
+	IntervalVector B(mylinearsolver.get_nb_rows());
+	mylinearsolver.get_rows(A);
+	mylinearsolver.get_lhs_rhs(B);
+
+#pragma omp parallel num_threads(nb_threads)
+	{
+		LinearSolver& lp=*solvers[thread_num()];
+		bool loaded=true;
+
+		if (&lp!=&mylinearsolver) {
+			try {
+				load_lp(lp,A,B,box);
+			} catch(LPException&) {
+				loaded=false; // the LPs of this thread are not solved
+			}
+		}
+
+#pragma omp for schedule(dynamic,1)
+		for (int k=0; k<nb_lp; k++) {
+			if (loaded)
+				stat[k]=lp.solve_var(k%2==0? LinearSolver::MINIMIZE : LinearSolver::MAXIMIZE, vars[k/2], opt[k]);
+		}
+	}
+
+	// Combine the certified bounds
+	for (int k=0; k<nb_lp; k++) {
+		if (stat[k]==LinearSolver::INFEASIBLE_PROVED)
+			throw PolytopeHullEmptyBoxException();
+
+		if (stat[k]==LinearSolver::OPTIMAL_PROVED) {
+			int i=vars[k/2];
+			if (k%2==0)
+				box[i] &= Interval(opt[k].lb(),POS_INFINITY);
+			else
+				box[i] &= Interval(NEG_INFINITY,opt[k].ub());
+
+			if (box[i].is_empty())
+				throw PolytopeHullEmptyBoxException();
+		}
+	}
+}
+
 bool CtcPolytopeHull::choose_next_variable(IntervalVector & box, int & nexti, int & infnexti, int* inf_bound, int* sup_bound) {
 
 	bool found = false;
@@ -275,23 +379,4 @@ bool CtcPolytopeHull::choose_next_variable(IntervalVector & box, int & nexti, in
 	return found;
 }
 
-#else
-
-CtcPolytopeHull::CtcPolytopeHull(Linearizer& lr, int max_iter, int time_out, double eps, Interval limit_diam) :
-		Ctc(lr.nb_var()) { }
-
-CtcPolytopeHull::CtcPolytopeHull(const Matrix& A, const Vector& b, int max_iter, int time_out, double eps, Interval limit_diam) :
-		Ctc(A.nb_cols()) { }
-
-CtcPolytopeHull::~CtcPolytopeHull() { }
-
-void CtcPolytopeHull::set_contracted_vars(const BitSet& vars) { }
-
-void CtcPolytopeHull::contract(IntervalVector& box) { }
-
-#endif /// end _IBEX_WITH_NOLP_
-
-
-
-
 } // end namespace ibex
@@ -80,7 +80,26 @@ public:
 	 */
 	void set_contracted_vars(const BitSet& vars);
 
-#ifndef _IBEX_WITH_NOLP_
+	/**
+	 * \brief Solve the LPs with several threads.
+	 *
+	 * Once the polytope is built, the 2n LPs (minimization and maximization of
+	 * each contracted variable) are independent. In parallel mode, they are
+	 * solved concurrently, each thread relying on its own linear solver (a copy
+	 * of the polytope is loaded in each of them). Each bound is certified by the
+	 * Neumaier-Shcherbina postprocessing, as in the sequential mode.
+	 *
+	 * Contrary to the sequential mode, the bounds found by an LP are not
+	 * used by the other LPs of the same call and all the LPs are solved
+	 * (the Achterberg heuristic does not apply).
+	 *
+	 * \param nb_threads - the number of threads. If 1 (default),
+	 *                     the sequential algorithm is applied.
+	 *
+	 * \note Threads are only created if Ibex is compiled with OpenMP
+	 * (see the --with-openmp option).
+	 */
+	void set_nb_threads(int nb_threads);
 
 protected:
 
@@ -94,6 +113,11 @@ protected:
 	 */
 	void optimizer(IntervalVector &box);
 
+	/**
+	 * \brief Contract the box by solving all the LPs concurrently (parallel mode).
+	 */
+	void optimizer_parallel(IntervalVector &box);
+
 	/**
 	 * \brief The linearization technique
 	 */
@@ -114,10 +138,24 @@ protected:
 	 */
 	BitSet contracted_vars;
 
+	/**
+	 * \brief Number of threads (1 for the sequential algorithm).
+	 */
+	int nb_threads;
+
+	/**
+	 * \brief The linear solvers of the threads 1,2,... in parallel mode,
+	 * NULL otherwise (the thread 0 uses #mylinearsolver).
+	 */
+	LinearSolver** solvers;
+
 private:
 	bool own_lr; // for memory cleanup
 
-#endif /// end _IBEX_WITH_NOLP_
+	// parameters of the linear solvers
+	int max_iter;
+	int time_out;
+	double eps;
 };
 
 } // end namespace ibex
@@ -0,0 +1,683 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_DualSimplex.cpp
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_DualSimplex.h"
+
+#include <cmath>
+#include <ctime>
+#include <algorithm>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/* replaces an infinite bound of a variable */
+const double INF_BOUND = 1e20;
+
+/* relative part of the primal feasibility tolerance (rounding errors on large values) */
+const double TOL_PRIMAL_REL = 1e-12;
+
+/* dual feasibility tolerance */
+const double TOL_DUAL = 1e-9;
+
+/* the bound of a variable is shifted rather than declaring infeasibility if the
+ * violation is less than SHIFT x (the primal feasibility tolerance) */
+const double SHIFT = 1e3;
+
+/* a Farkas certificate is only accepted if it proves a violation greater than
+ * CERT_REL x (magnitude of the terms), so that it survives interval evaluation */
+const double CERT_REL = 1e-10;
+
+/* minimal magnitude of a pivot */
+const double TOL_PIVOT = 1e-9;
+
+/* minimal magnitude of a pivot in the factorization (relative to the largest entry) */
+const double TOL_SINGULAR = 1e-11;
+
+/* number of updates of the inverse before recalculation */
+const int REFACTOR = 100;
+
+/* number of checks of an optimal basis by a recalculation from scratch */
+const int MAX_CHECKS = 3;
+
+/* breakpoint of the dual ratio test */
+struct Breakpoint {
+	double ratio;
+	int j;
+	bool operator<(const Breakpoint& b) const { return ratio < b.ratio; }
+};
+
+}
+
+DualSimplex::DualSimplex(int n) : n(n), m(0), c(n,0.0), box_lb(n,NEG_INFINITY), box_ub(n,POS_INFINITY),
+		max_iter(1000), max_time(100), tol_primal(1e-12), binv_ok(false), nb_updates(0), iter(0), obj(0), status(UNKNOWN) {
+	assert(n>0);
+}
+
+void DualSimplex::set_obj(int j, double cj) {
+	assert(j>=0 && j<n);
+	c[j]=cj;
+}
+
+void DualSimplex::set_bounds(const IntervalVector& box) {
+	assert(box.size()==n);
+	for (int j=0; j<n; j++) {
+		box_lb[j]=box[j].lb();
+		box_ub[j]=box[j].ub();
+	}
+}
+
+void DualSimplex::set_bounds(int j, const Interval& bounds) {
+	assert(j>=0 && j<n);
+	box_lb[j]=bounds.lb();
+	box_ub[j]=bounds.ub();
+}
+
+void DualSimplex::set_row(int i, const Vector& a, double lhs, double rhs) {
+	assert(i>=0 && i<=m);
+	assert(a.size()==n);
+	assert(lhs>NEG_INFINITY || rhs<POS_INFINITY);
+
+	if (i==m) {
+		m++;
+		A.resize(m*n);
+		row_lb.resize(m);
+		row_ub.resize(m);
+	}
+	for (int j=0; j<n; j++)
+		A[i*n+j]=a[j];
+	row_lb[i]=lhs;
+	row_ub[i]=rhs;
+
+	binv_ok=false;
+}
+
+void DualSimplex::remove_rows(int i) {
+	assert(i>=0 && i<=m);
+	if (i==m) return;
+	m=i;
+	A.resize(m*n);
+	row_lb.resize(m);
+	row_ub.resize(m);
+	binv_ok=false;
+}
+
+void DualSimplex::reset_basis() {
+	stat.clear();
+	binv_ok=false;
+}
+
+void DualSimplex::primal_sol(Vector& sol) const {
+	assert(sol.size()==n);
+	// basic variables may violate their bounds (within the tolerance)
+	for (int j=0; j<n; j++)
+		sol[j]=x[j]<box_lb[j] ? box_lb[j] : (x[j]>box_ub[j] ? box_ub[j] : x[j]);
+}
+
+void DualSimplex::dual_sol(Vector& dual, Vector& red_cost) const {
+	assert(dual.size()==m && red_cost.size()==n);
+	// the reduced cost of the logical variable s_i is y_i
+	for (int i=0; i<m; i++)
+		dual[i]=d[n+i];
+	for (int j=0; j<n; j++)
+		red_cost[j]=d[j];
+}
+
+void DualSimplex::red_cost(Vector& red_cost) const {
+	assert(red_cost.size()==n);
+	for (int j=0; j<n; j++)
+		red_cost[j]=d[j];
+}
+
+void DualSimplex::infeasible_dir(Vector& dir) const {
+	assert(dir.size()==m);
+	for (int i=0; i<m; i++)
+		dir[i]=y[i];
+}
+
+void DualSimplex::init_bounds() {
+	lb.resize(n+m);
+	ub.resize(n+m);
+	art_lb.assign(n+m,false);
+	art_ub.assign(n+m,false);
+
+	for (int j=0; j<n; j++) {
+		if (box_lb[j]>-INF_BOUND) lb[j]=box_lb[j];
+		else { lb[j]=-INF_BOUND; art_lb[j]=true; }
+		if (box_ub[j]<INF_BOUND) ub[j]=box_ub[j];
+		else { ub[j]=INF_BOUND; art_ub[j]=true; }
+	}
+
+	for (int i=0; i<m; i++) {
+		int j=n+i;
+		lb[j]=row_lb[i];
+		ub[j]=row_ub[i];
+		if (row_lb[i]>NEG_INFINITY && row_ub[i]<POS_INFINITY) continue;
+
+		// Range of a_i.x on the box (outward rounding)
+		Interval act=Interval::ZERO;
+		for (int k=0; k<n; k++)
+			act+=A[i*n+k]*Interval(lb[k],ub[k]);
+
+		// The artificial bound is strictly redundant so that, at the
+		// optimum, the logical variable cannot be on it.
+		double margin=0.01*act.diam()+1e-6*(1+act.mag());
+
+		if (row_lb[i]==NEG_INFINITY) {
+			lb[j]=act.lb()-margin;
+			art_lb[j]=true;
+		}
+		if (row_ub[i]==POS_INFINITY) {
+			ub[j]=act.ub()+margin;
+			art_ub[j]=true;
+		}
+	}
+}
+
+void DualSimplex::slack_basis() {
+	stat.resize(n+m);
+	head.resize(m);
+	for (int j=0; j<n; j++)
+		stat[j]=AT_ZERO;
+	for (int i=0; i<m; i++) {
+		stat[n+i]=BASIC;
+		head[i]=n+i;
+	}
+	// the basis matrix is -I
+	binv.assign(m*m,0.0);
+	for (int i=0; i<m; i++)
+		binv[i*m+i]=-1.0;
+	weight.assign(m,1.0);
+	nb_updates=0;
+	binv_ok=true;
+}
+
+void DualSimplex::adapt_basis() {
+	if (stat.empty()) {
+		slack_basis();
+		return;
+	}
+
+	if ((int) stat.size()!=n+m) {
+		// The rows added are basic, the statuses of the removed ones are lost
+		stat.resize(n+m,BASIC);
+		binv_ok=false;
+	}
+
+	if (binv_ok) return;
+
+	int nb_basic=0;
+	for (int j=0; j<n+m; j++)
+		if (stat[j]==BASIC) nb_basic++;
+
+	// Adjust the number of basic variables by changing the status of the last rows
+	for (int j=n+m-1; j>=n && nb_basic!=m; j--) {
+		if (nb_basic>m && stat[j]==BASIC) {
+			stat[j]=AT_LB; // the right bound is set later (dual feasibility)
+			nb_basic--;
+		} else if (nb_basic<m && stat[j]!=BASIC) {
+			stat[j]=BASIC;
+			nb_basic++;
+		}
+	}
+
+	if (nb_basic!=m) {
+		slack_basis();
+		return;
+	}
+
+	head.resize(m);
+	int p=0;
+	for (int j=0; j<n+m; j++)
+		if (stat[j]==BASIC) head[p++]=j;
+}
+
+bool DualSimplex::factorize() {
+	// The basis matrix B (row-major) and the identity
+	vector<double> B(m*m,0.0);
+	binv.assign(m*m,0.0);
+
+	double max_entry=0;
+	for (int p=0; p<m; p++) {
+		int j=head[p];
+		if (j<n)
+			for (int i=0; i<m; i++) {
+				B[i*m+p]=A[i*n+j];
+				if (fabs(A[i*n+j])>max_entry) max_entry=fabs(A[i*n+j]);
+			}
+		else {
+			B[(j-n)*m+p]=-1.0;
+			if (max_entry<1) max_entry=1;
+		}
+		binv[p*m+p]=1.0;
+	}
+
+	// Gauss-Jordan elimination with partial pivoting
+	for (int k=0; k<m; k++) {
+		int r=k;
+		for (int i=k+1; i<m; i++)
+			if (fabs(B[i*m+k])>fabs(B[r*m+k])) r=i;
+
+		if (fabs(B[r*m+k])<=TOL_SINGULAR*max_entry)
+			return false;
+
+		if (r!=k)
+			for (int l=0; l<m; l++) {
+				swap(B[r*m+l],B[k*m+l]);
+				swap(binv[r*m+l],binv[k*m+l]);
+			}
+
+		double piv=B[k*m+k];
+		for (int l=0; l<m; l++) {
+			B[k*m+l]/=piv;
+			binv[k*m+l]/=piv;
+		}
+
+		for (int i=0; i<m; i++) {
+			if (i==k) continue;
+			double f=B[i*m+k];
+			if (f==0) continue;
+			for (int l=k; l<m; l++) B[i*m+l]-=f*B[k*m+l];
+			for (int l=0; l<m; l++) binv[i*m+l]-=f*binv[k*m+l];
+		}
+	}
+
+	weight.resize(m);
+	for (int p=0; p<m; p++) {
+		double w=0;
+		for (int l=0; l<m; l++) w+=binv[p*m+l]*binv[p*m+l];
+		weight[p]=w;
+	}
+
+	nb_updates=0;
+	binv_ok=true;
+	return true;
+}
+
+double DualSimplex::nonbasic_value(int j) const {
+	switch (stat[j]) {
+	case AT_UB:   return ub[j];
+	case AT_ZERO: return 0;
+	default:      return lb[j];
+	}
+}
+
+void DualSimplex::compute_primal() {
+	x.resize(n+m);
+
+	// work = N.x_N
+	work.assign(m,0.0);
+	for (int j=0; j<n+m; j++) {
+		if (stat[j]==BASIC) continue;
+		x[j]=nonbasic_value(j);
+		if (j<n) {
+			if (x[j]!=0)
+				for (int i=0; i<m; i++) work[i]+=A[i*n+j]*x[j];
+		} else
+			work[j-n]-=x[j];
+	}
+
+	// x_B = -B^{-1}.N.x_N
+	for (int p=0; p<m; p++) {
+		double v=0;
+		for (int l=0; l<m; l++) v+=binv[p*m+l]*work[l];
+		x[head[p]]=-v;
+	}
+}
+
+void DualSimplex::compute_dual() {
+	// y^T = c_B^T.B^{-1}
+	y.assign(m,0.0);
+	for (int p=0; p<m; p++) {
+		int j=head[p];
+		if (j<n && c[j]!=0)
+			for (int l=0; l<m; l++) y[l]+=c[j]*binv[p*m+l];
+	}
+
+	d.resize(n+m);
+	for (int j=0; j<n; j++) {
+		double v=c[j];
+		for (int i=0; i<m; i++) v-=y[i]*A[i*n+j];
+		d[j]=v;
+	}
+	for (int i=0; i<m; i++)
+		d[n+i]=y[i];
+
+	for (int p=0; p<m; p++)
+		d[head[p]]=0;
+}
+
+bool DualSimplex::fix_dual_infeasibilities() {
+	bool changed=false;
+	for (int j=0; j<n+m; j++) {
+		if (stat[j]==AT_LB && d[j]<-TOL_DUAL && lb[j]<ub[j]) {
+			stat[j]=AT_UB;
+			changed=true;
+		} else if (stat[j]==AT_UB && d[j]>TOL_DUAL && lb[j]<ub[j]) {
+			stat[j]=AT_LB;
+			changed=true;
+		} else if (stat[j]==AT_ZERO && (fabs(d[j])>TOL_DUAL || lb[j]>0 || ub[j]<0)) {
+			stat[j]=(d[j]>TOL_DUAL || (d[j]>=-TOL_DUAL && lb[j]>0)) ? AT_LB : AT_UB;
+			changed=true;
+		}
+	}
+	return changed;
+}
+
+void DualSimplex::ftran(int j, vector<double>& w) const {
+	w.resize(m);
+	if (j<n)
+		for (int p=0; p<m; p++) {
+			double v=0;
+			for (int i=0; i<m; i++) v+=binv[p*m+i]*A[i*n+j];
+			w[p]=v;
+		}
+	else
+		for (int p=0; p<m; p++)
+			w[p]=-binv[p*m+j-n];
+}
+
+void DualSimplex::refresh() {
+	if (!factorize())
+		slack_basis();
+	compute_dual();
+	fix_dual_infeasibilities();
+	compute_primal();
+}
+
+bool DualSimplex::farkas(const double* rho, double s) {
+	y.resize(m);
+	for (int i=0; i<m; i++) {
+		y[i]=-s*rho[i];
+		// a multiplier must not involve an infinite side of the row
+		if ((y[i]>0 && art_lb[n+i]) || (y[i]<0 && art_ub[n+i])) y[i]=0;
+	}
+
+	// max { y^T(Ax-s) } with the original bounds
+	double gap=0;
+	double mag=0;
+	for (int j=0; j<n; j++) {
+		double a=0;
+		for (int i=0; i<m; i++) a+=y[i]*A[i*n+j];
+		if (a==0) continue;
+		double b=a>0 ? box_ub[j] : box_lb[j];
+		if (b==NEG_INFINITY || b==POS_INFINITY) return false;
+		gap+=a*b;
+		mag+=fabs(a*b);
+	}
+	for (int i=0; i<m; i++) {
+		if (y[i]==0) continue;
+		double b=y[i]>0 ? row_lb[i] : row_ub[i];
+		gap-=y[i]*b;
+		mag+=fabs(y[i]*b);
+	}
+	return gap < -CERT_REL*mag;
+}
+
+bool DualSimplex::iterate() {
+
+	// ============= Pricing: leaving variable (dual steepest edge) =============
+	int p=-1;
+	double best=0;
+	for (int k=0; k<m; k++) {
+		int j=head[k];
+		double infeas;
+		if (x[j]<lb[j]-tol_primal-TOL_PRIMAL_REL*fabs(lb[j]))
+			infeas=lb[j]-x[j];
+		else if (x[j]>ub[j]+tol_primal+TOL_PRIMAL_REL*fabs(ub[j]))
+			infeas=x[j]-ub[j];
+		else
+			continue;
+		double score=infeas*infeas/weight[k];
+		if (score>best) {
+			best=score;
+			p=k;
+		}
+	}
+
+	if (p==-1) {
+		status=OPTIMAL;
+		return false;
+	}
+
+	int jl=head[p];
+	// s=1: the leaving variable goes to its lower bound, s=-1: to its upper bound
+	double s=x[jl]<lb[jl] ? 1 : -1;
+	double target=s>0 ? lb[jl] : ub[jl];
+
+	// ============= Pivot row: alpha_r = e_p^T.B^{-1}.[A -I] =============
+	const double* rho=&binv[p*m];
+	alpha_r.assign(n+m,0.0);
+	for (int i=0; i<m; i++) {
+		if (rho[i]==0) continue;
+		for (int j=0; j<n; j++) alpha_r[j]+=rho[i]*A[i*n+j];
+		alpha_r[n+i]=-rho[i];
+	}
+
+	// ============= Dual ratio test with bound flipping =============
+	vector<Breakpoint> bp;
+	for (int j=0; j<n+m; j++) {
+		if (stat[j]==BASIC || lb[j]==ub[j]) continue;
+		double a=alpha_r[j];
+		if (fabs(a)<TOL_PIVOT) continue;
+		Breakpoint b;
+		b.j=j;
+		if (stat[j]==AT_LB && s*a<0)
+			b.ratio=std::max(d[j],0.0)/fabs(a);
+		else if (stat[j]==AT_UB && s*a>0)
+			b.ratio=std::max(-d[j],0.0)/fabs(a);
+		else if (stat[j]==AT_ZERO)
+			b.ratio=0;
+		else
+			continue;
+		bp.push_back(b);
+	}
+	sort(bp.begin(),bp.end());
+
+	// pass the breakpoints as long as the slope of the dual objective remains positive
+	double slope=fabs(x[jl]-target);
+	int k=0;
+	while (k<(int) bp.size()) {
+		int j=bp[k].j;
+		if (stat[j]==AT_ZERO) break; // cannot be flipped
+		double step=fabs(alpha_r[j])*(ub[j]-lb[j]);
+		if (slope-step<=0) break;
+		slope-=step;
+		k++;
+	}
+
+	if (k==(int) bp.size()) {
+		// the dual is unbounded: the row p proves infeasibility...
+		if (fabs(x[jl]-target)>SHIFT*(tol_primal+TOL_PRIMAL_REL*fabs(target)) && farkas(rho,s)) {
+			status=INFEASIBLE;
+			return false;
+		}
+		// ... unless the violation is due to rounding errors (or to the pivot
+		// tolerance). The bound is shifted (the working bounds are restored
+		// at the next resolution).
+		if (s>0) lb[jl]=x[jl]; else ub[jl]=x[jl];
+		return true;
+	}
+
+	// Harris' ratio test among the remaining breakpoints: the
+	// largest pivot within the tolerance
+	double theta_max=POS_INFINITY;
+	for (int l=k; l<(int) bp.size(); l++) {
+		int j=bp[l].j;
+		double t=(fabs(d[j])+TOL_DUAL)/fabs(alpha_r[j]);
+		if (t<theta_max) theta_max=t;
+	}
+	int lq=k;
+	for (int l=k; l<(int) bp.size() && bp[l].ratio<=theta_max; l++)
+		if (fabs(alpha_r[bp[l].j])>fabs(alpha_r[bp[lq].j])) lq=l;
+
+	int q=bp[lq].j;
+	double theta_d=bp[lq].ratio;
+
+	// ============= Pivot column: alpha_q = B^{-1}.(qth column) =============
+	ftran(q,alpha_q);
+	double piv=alpha_q[p];
+
+	if (fabs(piv)<TOL_PIVOT || fabs(piv-alpha_r[q])>1e-7*(1+fabs(piv))) {
+		// numerical trouble
+		if (nb_updates==0) {
+			status=UNKNOWN;
+			return false;
+		}
+		refresh();
+		return true;
+	}
+
+	// ============= Update the reduced costs =============
+	for (int j=0; j<n+m; j++)
+		if (stat[j]!=BASIC && alpha_r[j]!=0)
+			d[j]+=s*theta_d*alpha_r[j];
+	for (int l=k; l<(int) bp.size() && bp[l].ratio<=theta_d; l++) {
+		// small infeasibilities due to Harris' tolerance
+		int j=bp[l].j;
+		if ((stat[j]==AT_LB && d[j]<0) || (stat[j]==AT_UB && d[j]>0) || stat[j]==AT_ZERO) d[j]=0;
+	}
+	d[jl]=s*theta_d;
+	d[q]=0;
+
+	// ============= Bound flips =============
+	if (k>0) {
+		work.assign(m,0.0);
+		for (int l=0; l<k; l++) {
+			int j=bp[l].j;
+			double delta;
+			if (stat[j]==AT_LB) {
+				stat[j]=AT_UB;
+				delta=ub[j]-lb[j];
+				x[j]=ub[j];
+			} else {
+				stat[j]=AT_LB;
+				delta=lb[j]-ub[j];
+				x[j]=lb[j];
+			}
+			if (j<n)
+				for (int i=0; i<m; i++) work[i]+=A[i*n+j]*delta;
+			else
+				work[j-n]-=delta;
+		}
+		for (int r=0; r<m; r++) {
+			double v=0;
+			for (int l=0; l<m; l++) v+=binv[r*m+l]*work[l];
+			x[head[r]]-=v;
+		}
+	}
+
+	// ============= Primal update =============
+	double theta_p=(x[jl]-target)/piv;
+	for (int r=0; r<m; r++)
+		x[head[r]]-=theta_p*alpha_q[r];
+	x[q]+=theta_p;
+	x[jl]=target;
+
+	stat[jl]=s>0 ? AT_LB : AT_UB;
+	stat[q]=BASIC;
+	head[p]=q;
+
+	// ============= Update of the inverse and the weights =============
+	double* rowp=&binv[p*m];
+	for (int l=0; l<m; l++) rowp[l]/=piv;
+	double wp=0;
+	for (int l=0; l<m; l++) wp+=rowp[l]*rowp[l];
+	weight[p]=wp;
+
+	for (int r=0; r<m; r++) {
+		if (r==p || alpha_q[r]==0) continue;
+		double f=alpha_q[r];
+		double* row=&binv[r*m];
+		double w=0;
+		for (int l=0; l<m; l++) {
+			row[l]-=f*rowp[l];
+			w+=row[l]*row[l];
+		}
+		weight[r]=w;
+	}
+
+	nb_updates++;
+	iter++;
+	return true;
+}
+
+DualSimplex::Status DualSimplex::solve() {
+
+	clock_t start=clock();
+	iter=0;
+	status=UNKNOWN;
+
+	init_bounds();
+
+	for (int j=0; j<n; j++)
+		if (lb[j]>ub[j]) return status;
+
+	// A row that cannot be satisfied in the box
+	for (int i=0; i<m; i++) {
+		if (lb[n+i]>ub[n+i]) {
+			y.assign(m,0.0);
+			y[i]=art_ub[n+i] ? 1 : -1;
+			return status=INFEASIBLE;
+		}
+	}
+
+	adapt_basis();
+
+	if (!binv_ok || nb_updates>=REFACTOR) {
+		if (!factorize()) slack_basis();
+	}
+
+	compute_dual();
+	fix_dual_infeasibilities();
+	compute_primal();
+
+	int checks=0;
+
+	while (true) {
+		if (iter>=max_iter) {
+			status=MAX_ITER;
+			break;
+		}
+
+		if (iter%10==0 && ((double) (clock()-start))/CLOCKS_PER_SEC>max_time) {
+			status=TIME_OUT;
+			break;
+		}
+
+		if (nb_updates>=REFACTOR)
+			refresh();
+
+		if (iterate()) continue;
+
+		if (status!=OPTIMAL || nb_updates==0 || ++checks==MAX_CHECKS) break;
+
+		// check the optimal basis with values calculated from scratch
+		refresh();
+	}
+
+	if (status==OPTIMAL) {
+		obj=0;
+		for (int j=0; j<n+m; j++) {
+			// the solution lies on an artificial bound: the LP is
+			// probably unbounded
+			if ((stat[j]==AT_LB && art_lb[j]) || (stat[j]==AT_UB && art_ub[j])) {
+				status=UNKNOWN;
+				break;
+			}
+			if (j<n) obj+=c[j]*x[j];
+		}
+	}
+
+	return status;
+}
+
+} // end namespace ibex
@@ -0,0 +1,339 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_DualSimplex.h
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_DUAL_SIMPLEX_H__
+#define __IBEX_DUAL_SIMPLEX_H__
+
+#include "ibex_Vector.h"
+#include "ibex_IntervalVector.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup numeric
+ *
+ * \brief Built-in bounded dual simplex.
+ *
+ * Solve a linear problem
+ *
+ *     Minimize c^T x
+ *     s.t. lhs <= Ax <= rhs
+ *           l  <= x <= u
+ *
+ * This is the LP engine of #ibex::LinearSolver when Ibex is built without
+ * third-party LP library. It is tuned for the small dense LPs built by the
+ * linearization techniques of Ibex (e.g., #ibex::LinearizerXTaylor),
+ * where all the variables are bounded (the box of the current node):
+ *
+ * - The matrix A and the inverse of the basis matrix are dense (the inverse
+ *   is updated at each pivot and periodically recalculated).
+ * - Each row is given a "logical" variable s_i=a_i.x with bounds [lhs_i,rhs_i].
+ *   An infinite bound of a row is replaced by the bound of a_i.x implied by
+ *   the box (slightly enlarged), so that all the variables are boxed: any basis
+ *   can be made dual feasible by setting each nonbasic variable on the
+ *   appropriate bound. So, the dual simplex can start from any basis
+ *   (no phase 1).
+ * - The dual ratio test is the "bound flipping" (long-step) ratio test, with
+ *   Harris' tolerance. The leaving variable is selected by dual steepest edge
+ *   (the weights are calculated exactly, since the inverse is explicit).
+ * - The basis is kept from one resolution to the next (warm start), including
+ *   when rows are overwritten by new ones (see #set_row(int, const Vector&, double, double)).
+ *
+ * The results are not certified; they are meant to be post-processed
+ * (see Neumaier-Shcherbina in #ibex::LinearSolver): the optimal dual
+ * solution and, in case of infeasibility, a Farkas certificate
+ * are provided for this purpose.
+ */
+class DualSimplex {
+public:
+
+	/**
+	 * \brief Return status of #solve().
+	 */
+	typedef enum { OPTIMAL, INFEASIBLE, MAX_ITER, TIME_OUT, UNKNOWN } Status;
+
+	/**
+	 * \brief Create an LP with n variables, no constraint and a null objective.
+	 *
+	 * The variables are unbounded.
+	 */
+	explicit DualSimplex(int n);
+
+	/**
+	 * \brief Number of variables.
+	 */
+	int nb_vars() const;
+
+	/**
+	 * \brief Number of rows (constraints other than bounds).
+	 */
+	int nb_rows() const;
+
+	/**
+	 * \brief Set the coefficient of x_j in the objective.
+	 */
+	void set_obj(int j, double c);
+
+	/**
+	 * \brief Set the bounds of the variables.
+	 */
+	void set_bounds(const IntervalVector& box);
+
+	/**
+	 * \brief Set the bounds of the jth variable.
+	 */
+	void set_bounds(int j, const Interval& bounds);
+
+	/**
+	 * \brief Set the ith row to lhs <= a.x <= rhs.
+	 *
+	 * If i is the number of rows, the row is appended.
+	 * Otherwise, the ith row is overwritten and the basis is kept: the
+	 * next resolution starts from the basis of the previous one
+	 * (typically, the previous LP is the same linearization on a different box).
+	 *
+	 * lhs (resp. rhs) can be -oo (resp. +oo) but not both.
+	 */
+	void set_row(int i, const Vector& a, double lhs, double rhs);
+
+	/**
+	 * \brief Remove all the rows from the ith one.
+	 */
+	void remove_rows(int i);
+
+	/**
+	 * \brief Coefficient (i,j) of the matrix A.
+	 */
+	double row_coef(int i, int j) const;
+
+	/**
+	 * \brief Left-hand side of the ith row.
+	 */
+	double lhs(int i) const;
+
+	/**
+	 * \brief Right-hand side of the ith row.
+	 */
+	double rhs(int i) const;
+
+	/**
+	 * \brief Set the maximal number of iterations of a resolution.
+	 */
+	void set_max_iter(int max_iter);
+
+	/**
+	 * \brief Set the time limit of a resolution (in seconds).
+	 */
+	void set_max_time(double max_time);
+
+	/**
+	 * \brief Set the primal feasibility tolerance (default: 1e-12).
+	 *
+	 * Maximal violation of a bound by the solution
+	 * (a small relative tolerance is added for large bounds).
+	 */
+	void set_tolerance(double eps);
+
+	/**
+	 * \brief Forget the current basis (the next resolution starts from scratch).
+	 */
+	void reset_basis();
+
+	/**
+	 * \brief Solve the LP.
+	 *
+	 * \return OPTIMAL, INFEASIBLE, MAX_ITER, TIME_OUT or UNKNOWN
+	 *         (numerical failure or unbounded variable reaching its "infinite" bound).
+	 */
+	Status solve();
+
+	/**
+	 * \brief Number of iterations of the last resolution.
+	 */
+	int nb_iter() const;
+
+	/**
+	 * \brief Optimal value (last resolution, if OPTIMAL).
+	 */
+	double obj_value() const;
+
+	/**
+	 * \brief Optimal solution x (last resolution, if OPTIMAL).
+	 *
+	 * The solution is projected on the bounds of the variables
+	 * (it may slightly violate them, within the tolerance).
+	 */
+	void primal_sol(Vector& x) const;
+
+	/**
+	 * \brief Optimal dual solution (last resolution, if OPTIMAL).
+	 *
+	 * The vector y contains the multipliers of the rows and d the
+	 * reduced costs of the variables (i.e., the multipliers of
+	 * the bound constraints), so that c = A^T y + d.
+	 * A multiplier is >=0 if the lower bound is active and <=0 if the
+	 * upper bound is active.
+	 */
+	void dual_sol(Vector& y, Vector& d) const;
+
+	/**
+	 * \brief Reduced costs of the variables (last resolution, if OPTIMAL).
+	 *
+	 * Same as the vector d of #dual_sol(Vector&,Vector&) const, but
+	 * also valid when the LP has no row.
+	 */
+	void red_cost(Vector& d) const;
+
+	/**
+	 * \brief Farkas certificate of infeasibility (last resolution, if INFEASIBLE).
+	 *
+	 * Multipliers y of the rows such that max { y^T(Ax-s), x in [l,u], s in [lhs,rhs] } < 0,
+	 * which proves that Ax=s has no solution. The bounds of the variables
+	 * are not multiplied (their multipliers are implicitly 0).
+	 */
+	void infeasible_dir(Vector& y) const;
+
+private:
+
+	/*
+	 * Status of a variable. A nonbasic variable can also be set to 0
+	 * (between its bounds) as long as its reduced cost is null; this is
+	 * the initial status of the variables: the solution of an LP with a
+	 * null objective is 0 (if it is feasible), not a corner of the box.
+	 */
+	typedef enum { BASIC, AT_LB, AT_UB, AT_ZERO } VarStatus;
+
+	/* Build the working bounds of the structural and logical variables */
+	void init_bounds();
+
+	/* Adapt the status vector to the current number of rows */
+	void adapt_basis();
+
+	/* Slack basis (all the logical variables are basic) */
+	void slack_basis();
+
+	/* Compute the inverse of the basis matrix. Return false if singular. */
+	bool factorize();
+
+	/* Set the nonbasic variables on their bounds and compute the basic ones. */
+	void compute_primal();
+
+	/* Compute the reduced costs and the dual solution. */
+	void compute_dual();
+
+	/* Put the nonbasic variables on the bound that makes them dual feasible. Return true if some variable has changed. */
+	bool fix_dual_infeasibilities();
+
+	/* Value of a nonbasic variable */
+	double nonbasic_value(int j) const;
+
+	/* w = B^{-1} * (jth column of [A -I]) */
+	void ftran(int j, std::vector<double>& w) const;
+
+	/* Recompute the inverse and all the values from scratch. */
+	void refresh();
+
+	/*
+	 * Set the Farkas certificate from the row rho of the inverse (s: direction
+	 * of the leaving variable). Return false if it does not prove infeasibility
+	 * in floating-point arithmetic.
+	 */
+	bool farkas(const double* rho, double s);
+
+	/*
+	 * One iteration of the dual simplex.
+	 * Return false if the current basis is optimal or if the LP is
+	 * proved infeasible (the status is set accordingly).
+	 */
+	bool iterate();
+
+	int n;                      // number of variables
+	int m;                      // number of rows
+
+	std::vector<double> c;      // objective
+	std::vector<double> box_lb; // bounds of the variables
+	std::vector<double> box_ub;
+	std::vector<double> A;      // matrix of the rows (row-major)
+	std::vector<double> row_lb; // lhs
+	std::vector<double> row_ub; // rhs
+
+	int max_iter;
+	double max_time;
+	double tol_primal;
+
+	/* ================ working data (variables are x_0...x_{n-1},s_0,...,s_{m-1}) ============= */
+	std::vector<double> lb;     // working lower bounds (finite)
+	std::vector<double> ub;     // working upper bounds (finite)
+	std::vector<bool> art_lb;   // lower bound is artificial
+	std::vector<bool> art_ub;   // upper bound is artificial
+	std::vector<VarStatus> stat;// status of each variable
+	std::vector<int> head;      // basic variable of each position of the basis
+	std::vector<double> binv;   // inverse of the basis matrix (row-major, m x m)
+	std::vector<double> weight; // dual steepest edge weights (squared norms of the rows of binv)
+	std::vector<double> x;      // value of each variable
+	std::vector<double> d;      // reduced cost of each variable
+	std::vector<double> y;      // dual solution / Farkas certificate
+	std::vector<double> alpha_r;// pivot row of the tableau
+	std::vector<double> alpha_q;// pivot column of the tableau
+	std::vector<double> work;   // temporary vector of size m
+	bool binv_ok;               // true if binv is the inverse of the current basis
+	int nb_updates;             // number of updates of binv since the last factorization
+	int iter;                   // number of iterations of the current resolution
+	double obj;                 // optimal value
+	Status status;
+	/* ========================================================================================= */
+};
+
+/*============================================ inline implementation ============================================ */
+
+inline int DualSimplex::nb_vars() const {
+	return n;
+}
+
+inline int DualSimplex::nb_rows() const {
+	return m;
+}
+
+inline double DualSimplex::row_coef(int i, int j) const {
+	return A[i*n+j];
+}
+
+inline double DualSimplex::lhs(int i) const {
+	return row_lb[i];
+}
+
+inline double DualSimplex::rhs(int i) const {
+	return row_ub[i];
+}
+
+inline void DualSimplex::set_max_iter(int max_iter) {
+	this->max_iter = max_iter;
+}
+
+inline void DualSimplex::set_max_time(double max_time) {
+	this->max_time = max_time;
+}
+
+inline void DualSimplex::set_tolerance(double eps) {
+	tol_primal = eps;
+}
+
+inline int DualSimplex::nb_iter() const {
+	return iter;
+}
+
+inline double DualSimplex::obj_value() const {
+	return obj;
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_DUAL_SIMPLEX_H__
@@ -265,14 +265,33 @@ void LinearSolver::add_constraint(const Matrix & A, CmpOp sign, const Vector& rh
 /////////////////////////////////////////////////////////////////////////////////////////////////TODO
 #ifdef _IBEX_WITH_SOPLEX_
 
+namespace {
+
+/*
+ * Status of a nonbasic row compatible with its current bounds
+ * (the row may have changed since the status was calculated).
+ */
+soplex::SPxSolver::VarStatus nonbasic_status(soplex::SPxSolver::VarStatus s, double lhs, double rhs) {
+	if (lhs==rhs) return soplex::SPxSolver::FIXED;
+	if (s==soplex::SPxSolver::ON_LOWER && lhs>-soplex::infinity) return s;
+	if (rhs<soplex::infinity) return soplex::SPxSolver::ON_UPPER;
+	if (lhs>-soplex::infinity) return soplex::SPxSolver::ON_LOWER;
+	return soplex::SPxSolver::ZERO;
+}
+
+}
 
 LinearSolver::LinearSolver(int nb_vars1, int max_iter, int max_time_out, double eps) :
 			nb_vars(nb_vars1), nb_rows(0), epsilon(eps), boundvar(nb_vars1) ,
 			obj_value(0.0), primal_solution(nb_vars1), dual_solution(1 /*tmp*/),
-			status_prim(soplex::SPxSolver::UNKNOWN), status_dual(soplex::SPxSolver::UNKNOWN){
+			status_prim(soplex::SPxSolver::UNKNOWN), status_dual(soplex::SPxSolver::UNKNOWN),
+			new_ctrs(false) {
 
 
-	mysoplex= new soplex::SoPlex();
+	mysoplex= new soplex::SPxSolver(soplex::SPxSolver::LEAVE, soplex::SPxSolver::COLUMN);
+	mysoplex->setSolver(new soplex::SLUFactor(), true);
+	mysoplex->setTester(new soplex::SPxFastRT(), true);
+	mysoplex->setPricer(new soplex::SPxSteepPR(), true);
 
 	mysoplex->changeSense(soplex::SPxLP::MINIMIZE);
 	mysoplex->setTerminationIter(max_iter);
@@ -306,7 +325,36 @@ LinearSolver::Status_Sol LinearSolver::solve() {
 	soplex::SPxSolver::Status stat = soplex::SPxSolver::UNKNOWN;
 
 	try{
-		stat = mysoplex->solve();
+		remove_old_rows();
+
+		bool warm = new_ctrs && !basis_rows.empty();
+		new_ctrs = false;
+		if (warm) load_basis();
+
+		try {
+			stat = mysoplex->solve();
+		} catch(soplex::SPxException&) {
+			if (!warm) throw;
+			stat = soplex::SPxSolver::SINGULAR;
+		}
+
+		if (warm && (stat==soplex::SPxSolver::SINGULAR || stat==soplex::SPxSolver::UNKNOWN)) {
+			// the adapted basis is singular: restart from the slack basis
+			mysoplex->reLoad();
+			stat = mysoplex->solve();
+		}
+
+		// save the basis for the next LP
+		if (stat==soplex::SPxSolver::OPTIMAL || stat==soplex::SPxSolver::INFEASIBLE
+				|| stat==soplex::SPxSolver::ABORT_ITER || stat==soplex::SPxSolver::ABORT_TIME) {
+			basis_rows.resize(nb_rows);
+			basis_cols.resize(nb_vars);
+			mysoplex->getBasis(&basis_rows[0], &basis_cols[0]);
+		} else {
+			basis_rows.clear();
+			basis_cols.clear();
+		}
+
 		switch (stat) {
 		case (soplex::SPxSolver::OPTIMAL) : {
 			obj_value = mysoplex->objValue();
@@ -355,6 +403,7 @@ LinearSolver::Status_Sol LinearSolver::solve() {
 
 void LinearSolver::write_file(const char* name) {
 	try {
+		remove_old_rows();
 		mysoplex->writeFile(name, NULL, NULL, NULL);
 	}
 	catch(...) {
@@ -484,12 +533,12 @@ void LinearSolver::clean_ctrs() {
 	try {
 		status_prim = soplex::SPxSolver::UNKNOWN;
 		status_dual = soplex::SPxSolver::UNKNOWN;
-		int status=0;
-		if ((nb_vars)<=  (nb_rows - 1))  {
-			mysoplex->removeRowRange(nb_vars, nb_rows-1);
-		}
+		// The rows are not removed: they will be overwritten by the
+		// next constraints (see add_constraint) and the remaining
+		// ones removed before the next resolution.
 		nb_rows = nb_vars;
 		obj_value = POS_INFINITY;
+		new_ctrs = true;
 	}
 	catch(...) {
 		throw LPException();
@@ -497,6 +546,48 @@ void LinearSolver::clean_ctrs() {
 	return ;
 
 }
+
+void LinearSolver::remove_old_rows() {
+	if (mysoplex->nRows() > nb_rows)
+		mysoplex->removeRowRange(nb_rows, mysoplex->nRows()-1);
+}
+
+void LinearSolver::load_basis() {
+	assert(mysoplex->nRows()==nb_rows);
+
+	// The rows added since the basis has been saved are basic
+	// (the others are assumed to be in the same order as before).
+	basis_rows.resize(nb_rows, soplex::SPxSolver::BASIC);
+
+	int nb_basic=0;
+
+	for (int j=0; j<nb_vars; j++)
+		if (basis_cols[j]==soplex::SPxSolver::BASIC) nb_basic++;
+
+	for (int i=0; i<nb_rows; i++) {
+		if (basis_rows[i]==soplex::SPxSolver::BASIC)
+			nb_basic++;
+		else
+			basis_rows[i]=nonbasic_status(basis_rows[i], mysoplex->lhs(i), mysoplex->rhs(i));
+	}
+
+	// Adjust the number of basic variables (must be equal to the number of rows)
+	// by changing the status of the last constraints.
+	for (int i=nb_rows-1; i>=nb_vars && nb_basic!=nb_rows; i--) {
+		if (nb_basic>nb_rows && basis_rows[i]==soplex::SPxSolver::BASIC) {
+			basis_rows[i]=nonbasic_status(basis_rows[i], mysoplex->lhs(i), mysoplex->rhs(i));
+			nb_basic--;
+		} else if (nb_basic<nb_rows && basis_rows[i]!=soplex::SPxSolver::BASIC) {
+			basis_rows[i]=soplex::SPxSolver::BASIC;
+			nb_basic++;
+		}
+	}
+
+	// otherwise, the slack basis is used
+	if (nb_basic==nb_rows)
+		mysoplex->setBasis(&basis_rows[0], &basis_cols[0]);
+}
+
 void LinearSolver::clean_all() {
 	// TODO
 	return ;
@@ -609,17 +700,27 @@ void LinearSolver::add_constraint(const ibex::Vector& row, CmpOp sign, double rh
 			row1.add(i, row[i]);
 		}
 
+		double lhs1, rhs1;
 		if (sign==LEQ || sign==LT) {
-			mysoplex->addRow(soplex::LPRow(-soplex::infinity, row1, rhs));
-			nb_rows++;
+			lhs1 = -soplex::infinity;
+			rhs1 = rhs;
 		}
 		else if (sign==GEQ || sign==GT) {
-			mysoplex->addRow(soplex::LPRow(rhs, row1, soplex::infinity));
-			nb_rows++;
+			lhs1 = rhs;
+			rhs1 = soplex::infinity;
 		}
 		else
 			throw LPException();
 
+		soplex::LPRow lprow(lhs1, row1, rhs1);
+
+		// overwrite a row of the previous LP, if any (see clean_ctrs)
+		if (nb_rows < mysoplex->nRows())
+			mysoplex->changeRow(nb_rows, lprow);
+		else
+			mysoplex->addRow(lprow);
+		nb_rows++;
+
 	}
 	catch(...) {
 		throw LPException();
@@ -2229,100 +2330,252 @@ LinearSolver::Status LinearSolver::addConstraint(const ibex::Vector& row, CmpOp
 
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-#ifdef _IBEX_WITH_NOLP_
-
+#ifdef _IBEX_WITH_BUILTIN_LP_
 
+LinearSolver::LinearSolver(int nb_vars1, int max_iter, int max_time_out, double eps) :
+			nb_vars(nb_vars1), nb_rows(nb_vars1), epsilon(eps), boundvar(nb_vars1),
+			obj_value(0.0), primal_solution(nb_vars1), dual_solution(1 /*tmp*/),
+			status_prim(DualSimplex::UNKNOWN), status_dual(DualSimplex::UNKNOWN),
+			obj(nb_vars1, 0.0), sense(MINIMIZE) {
 
-LinearSolver::LinearSolver(int nb_vars, int max_iter,
-	int max_time_out, double eps):
-	nb_vars(0), nb_rows(0), obj_value(0.0), epsilon(0),
-	primal_solution(1), dual_solution(1 /*tmp*/),
-	status_prim(0), status_dual(0), boundvar(1)
-{
-	ibex_warning("No Linear Solver available.");
+	// the bound constraints are not rows of the simplex but
+	// bounds of the variables.
+	mysimplex = new DualSimplex(nb_vars);
+	mysimplex->set_max_iter(max_iter);
+	mysimplex->set_max_time(max_time_out);
+	// the solution must satisfy the constraints accurately enough
+	// for inner linearizations (see LoupFinderXTaylor)
+	mysimplex->set_tolerance(1e-2*epsilon);
 }
 
 LinearSolver::~LinearSolver() {
+	delete mysimplex;
 }
 
 LinearSolver::Status_Sol LinearSolver::solve() {
-	return LinearSolver::UNKNOWN;
+
+	try {
+		// remove the rows of the previous LP that have not been overwritten
+		mysimplex->remove_rows(nb_rows-nb_vars);
+
+		DualSimplex::Status stat = mysimplex->solve();
+		status_prim = stat;
+		status_dual = stat;
+
+		switch (stat) {
+		case DualSimplex::OPTIMAL : {
+			obj_value = sense==MINIMIZE? mysimplex->obj_value() : -mysimplex->obj_value();
+
+			// the primal solution : used by choose_next_variable
+			mysimplex->primal_sol(primal_solution);
+
+			// the dual solution ; used by Neumaier Shcherbina test
+			// (first the bound constraints, then the other rows)
+			// (a Vector cannot be empty: if there is no row, only
+			// the reduced costs are retrieved)
+			Vector y(nb_rows>nb_vars ? nb_rows-nb_vars : 1);
+			Vector d(nb_vars);
+			if (nb_rows>nb_vars)
+				mysimplex->dual_sol(y,d);
+			else
+				mysimplex->red_cost(d);
+
+			dual_solution.resize(nb_rows);
+			double dual;
+			for (int i=0; i<nb_rows; i++) {
+				dual = i<nb_vars ? d[i] : y[i-nb_vars];
+				if (sense==MAXIMIZE) dual=-dual;
+				Interval b = i<nb_vars ? boundvar[i] : Interval(mysimplex->lhs(i-nb_vars), mysimplex->rhs(i-nb_vars));
+				if 	( ((b.ub() >=  default_max_bound) && (dual<=0)) ||
+						((b.lb() <= -default_max_bound) && (dual>=0))   ) {
+					dual_solution[i]=0;
+				}
+				else {
+					dual_solution[i]=dual;
+				}
+			}
+			return OPTIMAL;
+		}
+		case DualSimplex::INFEASIBLE : return INFEASIBLE;
+		case DualSimplex::TIME_OUT :   return TIME_OUT;
+		case DualSimplex::MAX_ITER :   return MAX_ITER;
+		default :                      return UNKNOWN;
+		}
+	} catch(...) {
+		return UNKNOWN;
+	}
 }
 
 void LinearSolver::write_file(const char* name) {
-	throw LPException();
+
+	// CPLEX LP format
+	FILE* fd = fopen(name, "w");
+	if (!fd) throw LPException();
+
+	mysimplex->remove_rows(nb_rows-nb_vars);
+
+	fprintf(fd, sense==MINIMIZE? "Minimize\n obj:" : "Maximize\n obj:");
+	for (int j=0; j<nb_vars; j++)
+		if (obj[j]!=0) fprintf(fd, " %+.17g x%d", obj[j], j);
+	fprintf(fd, "\nSubject To\n");
+	for (int i=0; i<nb_rows-nb_vars; i++) {
+		fprintf(fd, " c%d:", i);
+		for (int j=0; j<nb_vars; j++)
+			if (mysimplex->row_coef(i,j)!=0) fprintf(fd, " %+.17g x%d", mysimplex->row_coef(i,j), j);
+		if (mysimplex->lhs(i)>NEG_INFINITY)
+			fprintf(fd, " >= %.17g\n", mysimplex->lhs(i));
+		else
+			fprintf(fd, " <= %.17g\n", mysimplex->rhs(i));
+	}
+	fprintf(fd, "Bounds\n");
+	for (int j=0; j<nb_vars; j++) {
+		if (boundvar[j].lb()>NEG_INFINITY) fprintf(fd, " %.17g", boundvar[j].lb());
+		else fprintf(fd, " -inf");
+		fprintf(fd, " <= x%d <=", j);
+		if (boundvar[j].ub()<POS_INFINITY) fprintf(fd, " %.17g\n", boundvar[j].ub());
+		else fprintf(fd, " +inf\n");
+	}
+	fprintf(fd, "End\n");
+	fclose(fd);
 }
 
-void LinearSolver::get_rows(Matrix& A) {
-	throw LPException();
+void LinearSolver::get_coef_obj(Vector& obj) const {
+	obj = this->obj;
 }
 
-void LinearSolver::get_rows_trans(Matrix& A_trans) {
-	throw LPException();
+void LinearSolver::get_rows(Matrix &A) const {
+	for (int i=0; i<nb_rows; i++)
+		for (int j=0; j<nb_vars; j++)
+			A.row(i)[j] = i<nb_vars ? (i==j? 1.0 : 0.0) : mysimplex->row_coef(i-nb_vars,j);
 }
 
-void LinearSolver::get_lhs_rhs(IntervalVector& B) {
-	throw LPException();
+void LinearSolver::get_rows_trans(Matrix &A_trans) const {
+	for (int i=0; i<nb_rows; i++)
+		for (int j=0; j<nb_vars; j++)
+			A_trans.row(j)[i] = i<nb_vars ? (i==j? 1.0 : 0.0) : mysimplex->row_coef(i-nb_vars,j);
 }
 
-void LinearSolver::get_primal_sol(Vector& prim) {
-	throw LPException();
+void LinearSolver::get_lhs_rhs(IntervalVector& B) const {
+
+	// Get the bounds of the variables
+	for (int i=0; i<nb_vars; i++)
+		B[i]=boundvar[i];
+
+	// Get the bounds of the constraints
+	for (int i=nb_vars; i<nb_rows; i++) {
+		double lhs=mysimplex->lhs(i-nb_vars);
+		double rhs=mysimplex->rhs(i-nb_vars);
+		B[i]=Interval( 	(lhs>-default_max_bound)? lhs:-default_max_bound,
+						(rhs< default_max_bound)? rhs: default_max_bound   );
+	}
 }
 
-void LinearSolver::get_dual_sol(Vector& dual) {
-	throw LPException();
+void LinearSolver::get_primal_sol(Vector & solution_primal) const {
+	if (status_prim == DualSimplex::OPTIMAL)
+		for (int i=0; i< nb_vars ; i++)
+			solution_primal[i] = primal_solution[i];
 }
 
-void LinearSolver::get_infeasible_dir(Vector& sol) {
-	throw LPException();
+void LinearSolver::get_dual_sol(Vector & solution_dual) const {
+	if (status_dual == DualSimplex::OPTIMAL)
+		for (int i=0; i<nb_rows; i++)
+			solution_dual[i] = dual_solution[i];
+}
+
+void LinearSolver::get_infeasible_dir(Vector & sol) const {
+
+	if (status_prim != DualSimplex::INFEASIBLE) throw LPException();
+
+	// the bound constraints are not used by the certificate
+	for (int i=0; i<nb_vars; i++)
+		sol[i]=0.0;
+
+	// no row (and a Vector cannot be empty)
+	if (nb_rows==nb_vars) return;
+
+	Vector y(nb_rows-nb_vars);
+	mysimplex->infeasible_dir(y);
+
+	for (int i=nb_vars; i<nb_rows; i++) {
+		if (((mysimplex->lhs(i-nb_vars) <= -default_max_bound) && (y[i-nb_vars]>=0))||
+			((mysimplex->rhs(i-nb_vars) >=  default_max_bound) && (y[i-nb_vars]<=0))	) {
+			sol[i]=0.0;
+		}
+		else {
+			sol[i]=y[i-nb_vars];
+		}
+	}
 }
 
 void LinearSolver::clean_ctrs() {
-	throw LPException();
+	status_prim = DualSimplex::UNKNOWN;
+	status_dual = DualSimplex::UNKNOWN;
+	// The rows are not removed: they will be overwritten by the
+	// next constraints (see add_constraint) and the remaining
+	// ones removed before the next resolution.
+	nb_rows = nb_vars;
+	obj_value = POS_INFINITY;
 }
 
 void LinearSolver::clean_all() {
-	throw LPException();
+	// TODO
+	return ;
 }
 
 void LinearSolver::set_max_iter(int max) {
-	throw LPException();
+	mysimplex->set_max_iter(max);
 }
 
 void LinearSolver::set_max_time_out(int time) {
-	throw LPException();
+	mysimplex->set_max_time(time);
 }
 
 void LinearSolver::set_sense(Sense s) {
-	throw LPException();
-}
-
-void setObj(const Vector& coef) {
-	throw LPException();
+	sense = s;
+	for (int j=0; j<nb_vars; j++)
+		mysimplex->set_obj(j, sense==MINIMIZE? obj[j] : -obj[j]);
 }
 
 void LinearSolver::set_obj_var(int var, double coef) {
-	throw LPException();
+	obj[var] = coef;
+	mysimplex->set_obj(var, sense==MINIMIZE? coef : -coef);
 }
 
 void LinearSolver::set_bounds(const IntervalVector& bounds) {
-	throw LPException();
+	mysimplex->set_bounds(bounds);
+	boundvar = bounds;
 }
 
 void LinearSolver::set_bounds_var(int var, const Interval& bound) {
-	throw LPException();
+	mysimplex->set_bounds(var, bound);
+	boundvar[var] = bound;
 }
 
 void LinearSolver::set_epsilon(double eps) {
-	throw LPException();
+	mysimplex->set_tolerance(1e-2*eps);
+	epsilon = eps;
 }
 
-void LinearSolver::add_constraint(const Vector& row, CmpOp sign, double rhs) {
-	throw LPException();
-}
+void LinearSolver::add_constraint(const ibex::Vector& row, CmpOp sign, double rhs) {
+
+	double lhs1, rhs1;
+	if (sign==LEQ || sign==LT) {
+		lhs1 = NEG_INFINITY;
+		rhs1 = rhs;
+	}
+	else if (sign==GEQ || sign==GT) {
+		lhs1 = rhs;
+		rhs1 = POS_INFINITY;
+	}
+	else
+		throw LPException();
 
+	// overwrite a row of the previous LP, if any (see clean_ctrs)
+	mysimplex->set_row(nb_rows-nb_vars, row, lhs1, rhs1);
+	nb_rows++;
+}
 
-#endif //
+#endif  // END DEF with BUILTIN LP
 
 
 
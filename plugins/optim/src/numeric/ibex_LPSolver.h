@@ -25,6 +25,8 @@
 #include "ibex_Exception.h"
 #include "ibex_LPException.h"
 
+#include <vector>
+
 #ifdef _IBEX_WITH_SOPLEX_
 	#ifdef DEBUG
 		#undef DEBUG
@@ -49,8 +51,8 @@
 #include <ilcplex/ilocplex.h>
 // TODO not finish yet
 #else
-#ifdef _IBEX_WITH_NOLP_
-// nothing
+#ifdef _IBEX_WITH_BUILTIN_LP_
+#include "ibex_DualSimplex.h"
 #endif
 #endif
 #endif
@@ -74,6 +76,12 @@ namespace ibex {
  * as long as they all share the same number of variables.
  * The number of constraints may differ and the bounds of variables as well.
  *
+ * The LP is warm-started: each resolution starts from the basis of the
+ * previous one. This includes the first resolution after the constraints
+ * have been replaced (see #clean_ctrs()): in a search, the LP of a node
+ * usually differs only slightly from the LP of the previous node
+ * (typically, its parent).
+ *
  */
 
 class LinearSolver {
@@ -173,6 +181,10 @@ public:
 	 *
 	 * Do not modify the bound constraints
 	 * (use clean_bounds or set_bounds)
+	 *
+	 * The basis of the last LP is kept and the rows are overwritten
+	 * in place by the next calls to #add_constraint(const Vector&, CmpOp, double),
+	 * so that the next LP is warm-started.
 	 */
 	void clean_ctrs();
 
@@ -260,7 +272,34 @@ private:
 	/**===============================================================================*/
 
 #ifdef _IBEX_WITH_SOPLEX_
-	soplex::SoPlex *mysoplex;
+	/*
+	 * The solver is used directly (not through the soplex::SoPlex class
+	 * which copies the LP and recomputes the factorization of the basis
+	 * at each resolution).
+	 */
+	soplex::SPxSolver *mysoplex;
+
+	/*
+	 * Basis of the last LP solved (empty if none).
+	 */
+	std::vector<soplex::SPxSolver::VarStatus> basis_rows;
+	std::vector<soplex::SPxSolver::VarStatus> basis_cols;
+
+	/*
+	 * True if the constraints have been replaced since the last
+	 * resolution (the saved basis has to be loaded).
+	 */
+	bool new_ctrs;
+
+	/*
+	 * Remove the rows of the previous LP that have not been overwritten.
+	 */
+	void remove_old_rows();
+
+	/*
+	 * Load the saved basis, after its adaptation to the current rows.
+	 */
+	void load_basis();
 #endif
 
 #ifdef _IBEX_WITH_CPLEX_
@@ -286,6 +325,19 @@ private:
 	int * _col1Index;
 #endif
 
+#ifdef _IBEX_WITH_BUILTIN_LP_
+	/*
+	 * The built-in dual simplex (only contains the rows
+	 * that are not bound constraints).
+	 */
+	DualSimplex *mysimplex;
+
+	/* objective (as given by the user, i.e., regardless of the sense) */
+	Vector obj;
+
+	Sense sense;
+#endif
+
 };
 
 /** \brief Stream out \a x. */
@@ -83,7 +83,7 @@ int LinearizerXTaylor::linear_relax(const IntervalVector& box)  {
 	IntervalMatrix Df(ma,n); // derivatives over the box
 
 	if (slope == TAYLOR) { // compute derivatives once for all
-		Df=sys.f_ctrs.jacobian(box,active);
+		sys.f_ctrs.cached_jacobian(box,Df,active);
 		//Df=sys.active_ctrs_jacobian(box);  // --> better with SystemBox
 
 		if (Df.is_empty()) return -1;
@@ -98,7 +98,7 @@ int LinearizerXTaylor::linear_relax(const IntervalVector& box)  {
 			IntervalVector corner=get_corner_point(box);
 
 			// the evaluation of the constraints in the corner x_corner
-			IntervalVector g_corner(sys.f_ctrs.eval_vector(corner,active));
+			IntervalVector g_corner(sys.f_ctrs.cached_eval_vector(corner,active));
 
 			if (g_corner.is_empty()) continue; // skip this corner
 
@@ -158,13 +158,14 @@ int LinearizerXTaylor::linear_restrict(const IntervalVector& box) {
 		// the corner used -> typed IntervalVector just to have guaranteed computations
 		IntervalVector corner = get_corner_point(box);
 
-		IntervalMatrix J=sys.f_ctrs.jacobian(box,active);
+		IntervalMatrix J(active.size(),n);
+		sys.f_ctrs.cached_jacobian(box,J,active);
 		//IntervalMatrix J=sys.active_ctrs_jacobian(box);  // --> better with SystemBox
 
 		if (J.is_empty()) return -1; // note: no way to inform that the box is actually infeasible
 
 		// the evaluation of the constraints in the corner x_corner
-		IntervalVector g_corner(sys.f_ctrs.eval_vector(corner,active));
+		IntervalVector g_corner(sys.f_ctrs.cached_eval_vector(corner,active));
 		if (g_corner.is_empty()) return -1;
 
 		// total number of added constraint
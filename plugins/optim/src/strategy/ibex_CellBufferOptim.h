@@ -11,6 +11,9 @@
 #define __IBEX_CELL_BUFFER_OPTIM_H__
 
 #include "ibex_CellBuffer.h"
+#include "ibex_Exception.h"
+
+#include <vector>
 
 namespace ibex {
 
@@ -43,8 +46,23 @@ public:
 	 */
 	virtual void contract(double loup)=0;
 
+	/**
+	 * \brief Append all the cells of the buffer to a vector
+	 * (in no specific order).
+	 *
+	 * Used to save the buffer (see #ibex::Optimizer::checkpoint()).
+	 * Raises an error by default.
+	 */
+	virtual void cells(std::vector<Cell*>& cells) const;
+
 };
 
+/*============================================ inline implementation ============================================ */
+
+inline void CellBufferOptim::cells(std::vector<Cell*>& cells) const {
+	ibex_error("[CellBufferOptim]: cells() not implemented for this buffer");
+}
+
 } /* namespace ibex */
 
 #endif /* __IBEX_CELL_BUFFER_OPTIM_H__ */
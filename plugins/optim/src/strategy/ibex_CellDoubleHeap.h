@@ -84,6 +84,9 @@ public:
 	/** \brief Return the next box (but does not pop it).*/
 	Cell* top() const;
 
+	/** \brief Append all the cells of the buffer to a vector.*/
+	void cells(std::vector<Cell*>& cells) const;
+
 
 	std::ostream& print(std::ostream& os) const;
 
@@ -157,6 +160,8 @@ inline Cell* CellDoubleHeap::pop()                { return DoubleHeap<Cell>::pop
 
 inline Cell* CellDoubleHeap::top() const          { return DoubleHeap<Cell>::top(); }
 
+inline void CellDoubleHeap::cells(std::vector<Cell*>& cells) const { DoubleHeap<Cell>::elements(cells); }
+
 inline double CellDoubleHeap::minimum() const     { return DoubleHeap<Cell>::minimum(); }
 
  inline std::ostream& CellDoubleHeap::print(std::ostream& os) const
@@ -16,7 +16,11 @@
 
 #include <float.h>
 #include <stdlib.h>
+#include <stdint.h>
 #include <iomanip>
+#include <fstream>
+#include <cstdio>
+#include <cstring>
 
 using namespace std;
 
@@ -26,6 +30,45 @@ const double Optimizer::default_eps_x = 0;
 const double Optimizer::default_rel_eps_f = 1e-03;
 const double Optimizer::default_abs_eps_f = 1e-07;
 
+namespace {
+
+const int  CHECKPOINT_SIGNATURE_LENGTH = 20;
+const char* CHECKPOINT_SIGNATURE = "IBEX OPTIM CHECKPT\n";
+const int CHECKPOINT_VERSION = 1;
+
+// Number of cells read/written at once
+const int CHECKPOINT_CHUNK = 4096;
+
+void write_box(ofstream& f, const IntervalVector& box, vector<double>& buf) {
+	for (int i=0; i<box.size(); i++) {
+		buf[2*i]=box[i].lb();
+		buf[2*i+1]=box[i].ub();
+	}
+	f.write((char*) &buf[0], 2*box.size()*sizeof(double));
+}
+
+void read_box(ifstream& f, IntervalVector& box, vector<double>& buf) {
+	f.read((char*) &buf[0], 2*box.size()*sizeof(double));
+	if (f.fail()) ibex_error("[optimizer]: unexpected end of checkpoint file.");
+	for (int i=0; i<box.size(); i++)
+		box[i]=Interval(buf[2*i],buf[2*i+1]);
+}
+
+template<typename T>
+void write_value(ofstream& f, T x) {
+	f.write((char*) &x, sizeof(T));
+}
+
+template<typename T>
+T read_value(ifstream& f) {
+	T x;
+	f.read((char*) &x, sizeof(T));
+	if (f.fail()) ibex_error("[optimizer]: unexpected end of checkpoint file.");
+	return x;
+}
+
+}
+
 void Optimizer::write_ext_box(const IntervalVector& box, IntervalVector& ext_box) {
 	int i2=0;
 	for (int i=0; i<n; i++,i2++) {
@@ -48,18 +91,20 @@ Optimizer::Optimizer(int n, Ctc& ctc, Bsc& bsc, LoupFinder& finder,
                 				n(n), goal_var(goal_var),
                 				ctc(ctc), bsc(bsc), loup_finder(finder), buffer(buffer),
                 				eps_x(eps_x), rel_eps_f(rel_eps_f), abs_eps_f(abs_eps_f),
-                				trace(false), timeout(-1),
+                				trace(false), timeout(-1), checkpoint_period(600),
                 				status(SUCCESS),
                 				//kkt(normalized_user_sys),
 								uplo(NEG_INFINITY), uplo_of_epsboxes(POS_INFINITY), loup(POS_INFINITY),
-                				loup_point(n), initial_loup(POS_INFINITY), loup_changed(false),
-								time(0), nb_cells(0) {
+                				loup_point(n), initial_loup(POS_INFINITY), initial_box(n), next_checkpoint(0), loup_changed(false),
+								time(0), nb_cells(0), arena(new CellArena()) {
 
 	if (trace) cout.precision(12);
 }
 
 Optimizer::~Optimizer() {
-
+	// note: the memory is freed only when the
+	// last cell (possibly in the buffer) is deleted.
+	arena->release();
 }
 
 // compute the value ymax (decreasing the loup with the precision)
@@ -269,7 +314,7 @@ Optimizer::Status Optimizer::optimize(const IntervalVector& init_box, double obj
 
 	buffer.flush();
 
-	Cell* root=new Cell(IntervalVector(n+1));
+	Cell* root=new (*arena) Cell(IntervalVector(n+1),*arena);
 
 	write_ext_box(init_box,root->box);
 
@@ -287,13 +332,144 @@ Optimizer::Status Optimizer::optimize(const IntervalVector& init_box, double obj
 
 	loup_changed=false;
 	initial_loup=obj_init_bound;
+	initial_box=init_box;
 
 	// TODO: no loup-point if handle_cell contracts everything
 	loup_point=init_box;
 	time=0;
+	next_checkpoint=checkpoint_period;
 	Timer::start();
 	handle_cell(*root,init_box);
 
+	return run(init_box);
+}
+
+Optimizer::Status Optimizer::optimize(const char* filename) {
+
+	ifstream f;
+	f.open(filename, ios::in | ios::binary);
+
+	if (f.fail()) ibex_error("[optimizer]: cannot open checkpoint file.");
+
+	char sig[CHECKPOINT_SIGNATURE_LENGTH];
+	f.read(sig, CHECKPOINT_SIGNATURE_LENGTH);
+	if (f.fail() || strncmp(sig,CHECKPOINT_SIGNATURE,CHECKPOINT_SIGNATURE_LENGTH)!=0)
+		ibex_error("[optimizer]: not a checkpoint file.");
+
+	if (read_value<int>(f)!=CHECKPOINT_VERSION)
+		ibex_error("[optimizer]: bad checkpoint file version.");
+
+	if (read_value<int>(f)!=n || read_value<int>(f)!=goal_var)
+		ibex_error("[optimizer]: bad checkpoint file (number of variables does not match).");
+
+	nb_cells = read_value<int>(f);
+	time = read_value<double>(f);
+	loup = read_value<double>(f);
+	uplo = read_value<double>(f);
+	uplo_of_epsboxes = read_value<double>(f);
+	initial_loup = read_value<double>(f);
+	uint64_t nb_buffer = read_value<uint64_t>(f);
+
+	vector<double> buf(2*(n+1)*CHECKPOINT_CHUNK);
+	read_box(f, initial_box, buf);
+	read_box(f, loup_point, buf);
+
+	// Initialize the "loup" for the buffer (before
+	// the costs are calculated)
+	buffer.contract(loup==POS_INFINITY ? loup : compute_ymax());
+	buffer.flush();
+
+	// the boxes, then the bisected variables, by chunks
+	IntervalVector box(n+1);
+	vector<int> vars(CHECKPOINT_CHUNK);
+
+	for (uint64_t i=0; i<nb_buffer; i+=CHECKPOINT_CHUNK) {
+		int nb=nb_buffer-i<(uint64_t) CHECKPOINT_CHUNK ? (int) (nb_buffer-i) : CHECKPOINT_CHUNK;
+
+		f.read((char*) &buf[0], ((size_t) nb)*2*(n+1)*sizeof(double));
+		f.read((char*) &vars[0], nb*sizeof(int));
+
+		if (f.fail()) ibex_error("[optimizer]: unexpected end of checkpoint file.");
+
+		for (int k=0; k<nb; k++) {
+			const double* b=&buf[((size_t) k)*2*(n+1)];
+			for (int j=0; j<=n; j++)
+				box[j]=Interval(b[2*j],b[2*j+1]);
+
+			Cell* c=new (*arena) Cell(box,*arena);
+			bsc.add_backtrackable(*c);
+			buffer.add_backtrackable(*c);
+			if (c->has<BisectedVar>()) c->get<BisectedVar>().var=vars[k];
+
+			buffer.push(c);
+		}
+	}
+
+	f.close();
+
+	loup_changed=false;
+	next_checkpoint=time+checkpoint_period;
+	Timer::start();
+
+	return run(initial_box);
+}
+
+void Optimizer::checkpoint(const char* filename) const {
+
+	// write in a temporary file first
+	string tmp=string(filename)+".tmp";
+
+	ofstream f;
+	f.open(tmp.c_str(), ios::out | ios::binary);
+
+	if (f.fail()) ibex_error("[optimizer]: cannot create checkpoint file.");
+
+	f.write(CHECKPOINT_SIGNATURE, CHECKPOINT_SIGNATURE_LENGTH);
+	write_value<int>(f,CHECKPOINT_VERSION);
+	write_value<int>(f,n);
+	write_value<int>(f,goal_var);
+	write_value<int>(f,nb_cells);
+	write_value<double>(f,time);
+	write_value<double>(f,loup);
+	write_value<double>(f,uplo);
+	write_value<double>(f,uplo_of_epsboxes);
+	write_value<double>(f,initial_loup);
+
+	vector<Cell*> cells;
+	buffer.cells(cells);
+	write_value<uint64_t>(f,cells.size());
+
+	vector<double> buf(2*(n+1)*CHECKPOINT_CHUNK);
+	write_box(f, initial_box, buf);
+	write_box(f, loup_point, buf);
+
+	vector<int> vars(CHECKPOINT_CHUNK);
+
+	for (size_t i=0; i<cells.size(); i+=CHECKPOINT_CHUNK) {
+		int nb=cells.size()-i<(size_t) CHECKPOINT_CHUNK ? (int) (cells.size()-i) : CHECKPOINT_CHUNK;
+
+		for (int k=0; k<nb; k++) {
+			const Cell& c=*cells[i+k];
+			double* b=&buf[((size_t) k)*2*(n+1)];
+			for (int j=0; j<=n; j++) {
+				b[2*j]=c.box[j].lb();
+				b[2*j+1]=c.box[j].ub();
+			}
+			vars[k]=c.has<BisectedVar>() ? c.get<BisectedVar>().var : -1;
+		}
+
+		f.write((char*) &buf[0], ((size_t) nb)*2*(n+1)*sizeof(double));
+		f.write((char*) &vars[0], nb*sizeof(int));
+	}
+
+	f.close();
+
+	if (f.fail() || rename(tmp.c_str(), filename)!=0)
+		ibex_error("[optimizer]: cannot write checkpoint file.");
+}
+
+Optimizer::Status Optimizer::run(const IntervalVector& init_box) {
+
 	update_uplo();
 
 	try {
@@ -340,6 +516,7 @@ Optimizer::Status Optimizer::optimize(const IntervalVector& init_box, double obj
 				}
 				update_uplo();
 				time_limit_check(); // TODO: not reentrant
+				checkpoint_check();
 
 			}
 			catch (NoBisectableVariableException& ) {
@@ -353,6 +530,8 @@ Optimizer::Status Optimizer::optimize(const IntervalVector& init_box, double obj
 	}
 	catch (TimeOutException& ) {
 		status = TIME_OUT;
+		// the search can be resumed from the last state
+		if (!checkpoint_file.empty()) checkpoint(checkpoint_file.c_str());
 		return status;
 	}
 
@@ -434,6 +613,17 @@ void Optimizer::report(bool verbose) {
 	cout << " number of cells: " << nb_cells << endl;
 }
 
+void Optimizer::checkpoint_check() {
+	if (checkpoint_file.empty() || checkpoint_period<=0) return;
+	Timer::stop();
+	time += Timer::VIRTUAL_TIMELAPSE();
+	if (time >= next_checkpoint) {
+		checkpoint(checkpoint_file.c_str());
+		next_checkpoint = time + checkpoint_period;
+	}
+	Timer::start();
+}
+
 void Optimizer::time_limit_check () {
 	if (timeout<=0) return;
 	Timer::stop();
@@ -18,6 +18,8 @@
 //#include "ibex_EntailedCtr.h"
 #include "ibex_CtcKhunTucker.h"
 
+#include <string>
+
 namespace ibex {
 
 /**
@@ -121,6 +123,35 @@ public:
 	 */
 	Status optimize(const IntervalVector& init_box, double obj_init_bound=POS_INFINITY);
 
+	/**
+	 * \brief Resume an optimization from a checkpoint file.
+	 *
+	 * The buffer, the loup, the loup point, the uplo and the counters are
+	 * restored from the file (see #checkpoint(const char*) const) and the
+	 * search continues. The optimizer must be built with the same system
+	 * and the same settings as the one that has written the file.
+	 *
+	 * Note: the time limit includes the CPU time of the previous runs.
+	 *
+	 * eturn see #optimize(const IntervalVector&, double).
+	 */
+	Status optimize(const char* checkpoint_file);
+
+	/**
+	 * \brief Save the state of the current optimization into a file.
+	 *
+	 * The file contains the boxes of all the cells in the buffer with the
+	 * last bisected variable, the loup, the loup point, the uplo and the counters.
+	 * The data of the buffer (see #ibex::OptimData) are recalculated when
+	 * the cells are pushed again into the buffer.
+	 *
+	 * The file is first written under a temporary name and then renamed
+	 * so that a previous checkpoint is never lost.
+	 *
+	 * Can be called after a time out.
+	 */
+	void checkpoint(const char* filename) const;
+
 	/* =========================== Output ============================= */
 
 	/**
@@ -273,9 +304,26 @@ public:
 	 */
 	double timeout;
 
+	/**
+	 * \brief Checkpoint file.
+	 *
+	 * If not empty, the state of the search is periodically saved
+	 * into this file (see #checkpoint(const char*) const and
+	 * #checkpoint_period). Empty by default.
+	 */
+	std::string checkpoint_file;
+
+	/**
+	 * \brief CPU time between two checkpoints (in seconds).
+	 *
+	 * By default, 600.
+	 */
+	double checkpoint_period;
 
 protected:
 
+	friend class ParallelOptimizer;
+
 	/**
 	 * \brief Main procedure for processing a box.
 	 *
@@ -334,6 +382,16 @@ protected:
 	 */
 	void time_limit_check();
 
+	/**
+	 * \brief Main loop: process the cells of the buffer.
+	 */
+	Status run(const IntervalVector& init_box);
+
+	/**
+	 * \brief Save the state if the checkpoint period has elapsed.
+	 */
+	void checkpoint_check();
+
 	/*=======================================================================================================*/
 	/*                                Functions to manage the extended CSP                                   */
 	/*=======================================================================================================*/
@@ -386,6 +444,12 @@ private:
 	 */
 	double initial_loup;
 
+	/** The initial box of the current optimization. */
+	IntervalVector initial_box;
+
+	/** CPU time of the next checkpoint. */
+	double next_checkpoint;
+
 	/** True if loup has changed in the last call to handle_cell(..) */
 	bool loup_changed;
 
@@ -394,6 +458,9 @@ private:
 
 	/** Number of cells pushed into the heap (which passed through the contractors) */
 	int nb_cells;
+
+	/** Memory arena of the cells. */
+	CellArena* arena;
 };
 
 inline Optimizer::Status Optimizer::get_status() const { return status; }
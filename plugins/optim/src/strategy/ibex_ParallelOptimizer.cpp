@@ -0,0 +1,419 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ParallelOptimizer.cpp
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_ParallelOptimizer.h"
+#include "ibex_Timer.h"
+#include "ibex_NoBisectableVariableException.h"
+
+#include <cassert>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+const int NO_INTERRUPT=-1;
+
+// a thread has raised an exception
+const int EXCEPTION_RAISED=-2;
+
+}
+
+ParallelOptimizer::ParallelOptimizer(const Array<Optimizer>& workers) : workers(workers),
+		trace(0), timeout(-1), nb_threads(workers.size()), locks(new Lock[workers.size()]),
+		nb_pending(0), interrupt(NO_INTERRUPT), init_box(NULL), status(Optimizer::SUCCESS),
+		uplo(NEG_INFINITY), uplo_of_epsboxes(POS_INFINITY), loup(POS_INFINITY),
+		loup_point(workers[0].n), initial_loup(POS_INFINITY), time(0), start_time(0), nb_cells(0), nb_steals(0) {
+
+	assert(nb_threads>0);
+}
+
+ParallelOptimizer::~ParallelOptimizer() {
+	delete[] locks;
+}
+
+Optimizer::Status ParallelOptimizer::optimize(const IntervalVector& init_box, double obj_init_bound) {
+
+	this->init_box = &init_box;
+
+	loup=obj_init_bound;
+	initial_loup=obj_init_bound;
+	loup_point=init_box;
+	uplo=NEG_INFINITY;
+	uplo_of_epsboxes=POS_INFINITY;
+
+	for (int t=0; t<nb_threads; t++) {
+		Optimizer& w=workers[t];
+
+		w.loup=obj_init_bound;
+		// Just to initialize the "loup" for the buffer
+		w.buffer.contract(w.loup);
+		w.buffer.flush();
+
+		w.uplo=NEG_INFINITY;
+		w.uplo_of_epsboxes=POS_INFINITY;
+		w.nb_cells=0;
+		w.loup_point=init_box;
+		w.initial_loup=obj_init_bound;
+		w.loup_changed=false;
+	}
+
+	interrupt=NO_INTERRUPT;
+	nb_cells=0;
+	nb_pending=0;
+	nb_steals=0;
+	time=0;
+
+	Optimizer& w=workers[0];
+
+	Cell* root=new (*w.arena) Cell(IntervalVector(w.n+1),*w.arena);
+
+	w.write_ext_box(init_box,root->box);
+
+	// add data required by the bisector
+	w.bsc.add_backtrackable(*root);
+
+	// add data required by the buffer
+	// (all the workers have the same type of buffer)
+	w.buffer.add_backtrackable(*root);
+
+	start_time=wall_time();
+
+	handle_cell(0,*root);
+
+	if (w.loup_changed) write_loup(0);
+
+	// an exception must not escape the parallel region
+	ExceptionCapture error;
+
+#pragma omp parallel num_threads(nb_threads)
+	{
+		try {
+			run(thread_num());
+		} catch(...) {
+			error.capture();
+			// stop the other threads
+#pragma omp atomic write
+			interrupt = EXCEPTION_RAISED;
+		}
+	}
+
+	time += wall_time()-start_time;
+
+	if (error.captured()) {
+		// delete the remaining cells
+		for (int t=0; t<nb_threads; t++)
+			workers[t].buffer.flush();
+		error.rethrow();
+	}
+
+	update_uplo();
+
+	// delete the remaining cells (in case of interruption)
+	for (int t=0; t<nb_threads; t++)
+		workers[t].buffer.flush();
+
+	if (interrupt==Optimizer::TIME_OUT)
+		status=Optimizer::TIME_OUT;
+	else if (uplo_of_epsboxes == POS_INFINITY && (loup==POS_INFINITY || (loup==initial_loup && w.abs_eps_f==0 && w.rel_eps_f==0)))
+		status=Optimizer::INFEASIBLE;
+	else if (loup==initial_loup)
+		status=Optimizer::NO_FEASIBLE_FOUND;
+	else if (uplo_of_epsboxes == NEG_INFINITY)
+		status=Optimizer::UNBOUNDED_OBJ;
+	else if (get_obj_rel_prec()>w.rel_eps_f && get_obj_abs_prec()>w.abs_eps_f)
+		status=Optimizer::UNREACHED_PREC;
+	else
+		status=Optimizer::SUCCESS;
+
+	return status;
+}
+
+void ParallelOptimizer::handle_cell(int t, Cell& c) {
+	Optimizer& w=workers[t];
+
+	w.contract_and_bound(c, *init_box);
+
+	if (c.box.is_empty()) {
+		delete &c;
+	} else {
+		// note: must be incremented before the cell is made available
+		// to the other threads
+#pragma omp atomic
+		nb_pending++;
+
+#pragma omp atomic
+		nb_cells++;
+
+		locks[t].lock();
+		w.buffer.push(&c);
+		locks[t].unlock();
+	}
+}
+
+Cell* ParallelOptimizer::get_cell(int t) {
+	Cell* c=NULL;
+
+	for (int i=0; c==NULL && i<nb_threads; i++) {
+		int v=(t+i) % nb_threads;
+		CellBufferOptim& buffer=workers[v].buffer;
+
+		locks[v].lock();
+		if (!buffer.empty()) {
+			c=buffer.top();
+			buffer.pop();
+		}
+		locks[v].unlock();
+
+		if (c!=NULL && i>0) {
+#pragma omp atomic
+			nb_steals++;
+		}
+	}
+
+	return c;
+}
+
+void ParallelOptimizer::read_loup(int t) {
+	Optimizer& w=workers[t];
+
+	double shared_loup;
+
+#pragma omp atomic read
+	shared_loup = loup;
+
+	if (shared_loup < w.loup) {
+		loup_lock.lock();
+		w.loup = loup;
+		w.loup_point = loup_point;
+		loup_lock.unlock();
+
+		contract_buffer(t);
+	}
+}
+
+void ParallelOptimizer::write_loup(int t) {
+	Optimizer& w=workers[t];
+
+	loup_lock.lock();
+	if (w.loup < loup) {
+#pragma omp atomic write
+		loup = w.loup;
+
+		loup_point = w.loup_point;
+
+		if (trace) {
+			cout << "                    ";
+			cout << "\033[32m loup= " << loup << " [thread " << t << "]\033[0m" << endl;
+		}
+	} else {
+		// another thread has found a better loup in the meantime
+		w.loup = loup;
+		w.loup_point = loup_point;
+	}
+	loup_lock.unlock();
+
+	contract_buffer(t);
+}
+
+void ParallelOptimizer::contract_buffer(int t) {
+	Optimizer& w=workers[t];
+
+	double ymax=w.compute_ymax();
+
+	locks[t].lock();
+	long size=w.buffer.size();
+	w.buffer.contract(ymax);
+	size -= w.buffer.size();
+	locks[t].unlock();
+
+#pragma omp atomic
+	nb_pending -= size;
+
+	if (ymax <= NEG_INFINITY) {
+		if (trace) cout << " infinite value for the minimum " << endl;
+#pragma omp atomic write
+		interrupt = Optimizer::UNBOUNDED_OBJ;
+	}
+}
+
+void ParallelOptimizer::run(int t) {
+
+	Optimizer& w=workers[t];
+
+	long pending;
+	int stop;
+
+	Backoff backoff;
+
+	while (true) {
+
+#pragma omp atomic read
+		stop = interrupt;
+
+		if (stop!=NO_INTERRUPT) break;
+
+		read_loup(t);
+
+		Cell* c=get_cell(t);
+
+		if (c==NULL) {
+#pragma omp atomic read
+			pending = nb_pending;
+
+			// no cell in the buffers and no cell being processed: search is over
+			if (pending==0) break;
+
+			// cells are being processed by other threads: wait for new ones
+			backoff.pause();
+			continue;
+		}
+
+		backoff.reset();
+
+		w.loup_changed=false;
+
+		try {
+			pair<IntervalVector,IntervalVector> boxes=w.bsc.bisect(*c);
+
+			// the subcells are created in the arena of this thread
+			// (the cell may come from another thread)
+			pair<Cell*,Cell*> new_cells=c->bisect(boxes.first,boxes.second,w.arena);
+
+			delete c; // deletes the cell.
+
+			handle_cell(t, *new_cells.first);
+			handle_cell(t, *new_cells.second);
+		}
+		catch (NoBisectableVariableException& ) {
+			w.update_uplo_of_epsboxes((c->box)[w.goal_var].lb());
+			delete c; // deletes the cell.
+		}
+
+		if (w.uplo_of_epsboxes == NEG_INFINITY) {
+			if (trace) cout << " possible infinite minimum " << endl;
+#pragma omp atomic write
+			interrupt = Optimizer::UNBOUNDED_OBJ;
+		}
+
+		// In case of a new upper bound, all the boxes with a lower
+		// bound greater than (loup - goal_prec) are removed and deleted.
+		if (w.loup_changed) write_loup(t);
+
+#pragma omp atomic
+		nb_pending--;
+
+		if (timeout>0 && wall_time()-start_time >= timeout) {
+#pragma omp atomic write
+			interrupt = Optimizer::TIME_OUT;
+		}
+	}
+}
+
+void ParallelOptimizer::update_uplo() {
+
+	bool empty=true;
+
+	uplo_of_epsboxes=POS_INFINITY;
+
+	for (int t=0; t<nb_threads; t++) {
+		Optimizer& w=workers[t];
+
+		if (w.uplo_of_epsboxes < uplo_of_epsboxes)
+			uplo_of_epsboxes = w.uplo_of_epsboxes;
+
+		// the loups of the workers may be outdated
+		w.loup = loup;
+		w.loup_point = loup_point;
+	}
+
+	uplo=uplo_of_epsboxes;
+
+	for (int t=0; t<nb_threads; t++) {
+		CellBufferOptim& buffer=workers[t].buffer;
+		if (!buffer.empty()) {
+			empty=false;
+			if (buffer.minimum() < uplo) uplo=buffer.minimum();
+		}
+	}
+
+	// empty buffers : the uplo is set to ymax (loup - precision) if a loup has been found
+	// (not loup, because constraint y <= ymax was enforced). See Optimizer::update_uplo().
+	if (empty && loup != POS_INFINITY) {
+		double ymax=workers[0].compute_ymax();
+		if (ymax < uplo) uplo=ymax;
+	}
+}
+
+void ParallelOptimizer::report(bool verbose) {
+
+	Optimizer& w=workers[0];
+
+	if (!verbose) {
+		cout << get_status() << endl;
+		cout << get_uplo() << ' ' << get_loup() << endl;
+		for (int i=0; i<w.n; i++) {
+			if (i>0) cout << ' ';
+			cout << get_loup_point()[i].lb();
+			if (w.loup_finder.rigorous())
+				cout << ' ' << get_loup_point()[i].ub();
+		}
+		cout << endl << get_time() << " " << get_nb_cells() << endl;
+		return;
+	}
+
+	switch(status) {
+	case Optimizer::SUCCESS: cout << "\033[32m" << " optimization successful!" << endl;
+	break;
+	case Optimizer::INFEASIBLE: cout << "\033[31m" << " infeasible problem" << endl;
+	break;
+	case Optimizer::NO_FEASIBLE_FOUND: cout << "\033[31m" << " no feasible point found (the problem may be infeasible)" << endl;
+	break;
+	case Optimizer::UNBOUNDED_OBJ: cout << "\033[31m" << " possibly unbounded objective (f*=-oo)" << endl;
+	break;
+	case Optimizer::TIME_OUT: cout << "\033[31m" << " time limit " << timeout << "s. reached " << endl;
+	break;
+	case Optimizer::UNREACHED_PREC: cout << "\033[31m" << " unreached precision" << endl;
+	}
+
+	cout << "\033[0m" << endl;
+
+	if (status==Optimizer::INFEASIBLE) {
+		cout << " infeasible problem " << endl;
+	} else {
+		cout << " best bound in: [" << uplo << "," << loup << "]" << endl;
+
+		double rel_prec=get_obj_rel_prec();
+		double abs_prec=get_obj_abs_prec();
+
+		cout << " relative precision obtained on objective function: " << rel_prec << " " <<
+				(rel_prec <= w.rel_eps_f? " [passed]" : " [failed]") << endl;
+
+		cout << " absolute precision obtained on objective function: " << abs_prec << " " <<
+				(abs_prec <= w.abs_eps_f? " [passed]" : " [failed]") << endl;
+
+		if (loup==initial_loup)
+			cout << " no feasible point found " << endl;
+		else {
+			cout << " best feasible point: ";
+
+			if (w.loup_finder.rigorous())
+				cout << loup_point << endl;
+			else
+				cout << loup_point.lb() << endl;
+		}
+	}
+	cout << " real time used: " << time << "s." << endl;
+	cout << " number of cells: " << nb_cells << endl;
+	cout << " number of threads: " << nb_threads << endl;
+	cout << " number of steals: " << nb_steals << endl;
+}
+
+} // end namespace ibex
@@ -0,0 +1,261 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ParallelOptimizer.h
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_PARALLEL_OPTIMIZER_H__
+#define __IBEX_PARALLEL_OPTIMIZER_H__
+
+#include "ibex_Optimizer.h"
+#include "ibex_Array.h"
+#include "ibex_Lock.h"
+
+namespace ibex {
+
+/**
+ * \ingroup optim
+ *
+ * \brief Multi-threaded global optimizer.
+ *
+ * This class runs the branch and bound algorithm of #ibex::Optimizer
+ * on several threads.
+ *
+ * Contractors, bisectors and loup finders are not thread-safe so each thread
+ * relies on its own optimizer (a "worker"). All the workers must be built
+ * with the same parameters, on independent copies of the same system (see
+ * #System::COPY).
+ *
+ * Each thread pops cells from the buffer of its worker (which is protected
+ * by a lock) and pushes back the subcells. When the buffer is empty, the
+ * thread steals the next cell of the buffer of another thread.
+ *
+ * The loup (and the loup point) is shared. When a thread finds a new loup,
+ * it publishes it; the other threads read it (atomically) before handling
+ * a cell and, if it has decreased, contract their own buffer with it
+ * (there is no global lock for contracting the buffers).
+ *
+ * \note Threads are only created if Ibex is compiled with OpenMP
+ * (see the --with-openmp option). Otherwise, the first worker does
+ * all the job.
+ */
+class ParallelOptimizer {
+public:
+
+	/**
+	 * \brief Build a parallel optimizer.
+	 *
+	 * \param workers - one optimizer per thread. The number of threads
+	 *                  is the size of this array.
+	 */
+	ParallelOptimizer(const Array<Optimizer>& workers);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~ParallelOptimizer();
+
+	/**
+	 * \brief Run the optimization.
+	 *
+	 * \see #Optimizer::optimize(const IntervalVector&, double).
+	 */
+	Optimizer::Status optimize(const IntervalVector& init_box, double obj_init_bound=POS_INFINITY);
+
+	/**
+	 * \brief Displays on standard output a report of the last call to optimize(...).
+	 *
+	 * \see #Optimizer::report(bool).
+	 */
+	void report(bool verbose=true);
+
+	/**
+	 * \brief Get the status of the last call to optimize(...).
+	 */
+	Optimizer::Status get_status() const;
+
+	/**
+	 * \brief Get the "uplo" (<= f*).
+	 */
+	double get_uplo() const;
+
+	/**
+	 * \brief Get the "loup" (>= f*).
+	 */
+	double get_loup() const;
+
+	/**
+	 * \brief Get x* (== argmin).
+	 */
+	const IntervalVector& get_loup_point() const;
+
+	/**
+	 * \brief Get the (real) time spent.
+	 */
+	double get_time() const;
+
+	/**
+	 * \brief Get the number of cells.
+	 */
+	double get_nb_cells() const;
+
+	/**
+	 * \brief Get the number of cells stolen by the threads.
+	 */
+	unsigned int get_nb_steals() const;
+
+	/**
+	 * \brief Get the relative precision on the objective obtained after last execution.
+	 */
+	double get_obj_rel_prec() const;
+
+	/**
+	 * \brief Get the absolute precision on the objective obtained after last execution.
+	 */
+	double get_obj_abs_prec() const;
+
+	/**
+	 * \brief The workers.
+	 */
+	Array<Optimizer> workers;
+
+	/**
+	 * \brief Trace activation flag.
+	 *
+	 * If set to 1, prints every loup update.
+	 */
+	int trace;
+
+	/**
+	 * \brief Time limit.
+	 *
+	 * Unlike #Optimizer::timeout, this is a *real* time (the CPU time of
+	 * the process grows with the number of threads).
+	 * By default, it is -1 (no limit).
+	 */
+	double timeout;
+
+protected:
+
+	/**
+	 * \brief Main loop of a thread.
+	 */
+	void run(int t);
+
+	/**
+	 * \brief Contract and bound a new cell and push it in the buffer of the thread t.
+	 */
+	void handle_cell(int t, Cell& c);
+
+	/**
+	 * \brief Get a cell for the thread t (from its own buffer or by stealing).
+	 *
+	 * \return NULL if no cell is available.
+	 */
+	Cell* get_cell(int t);
+
+	/**
+	 * \brief Update the loup of the worker t with the shared loup.
+	 */
+	void read_loup(int t);
+
+	/**
+	 * \brief Update the shared loup with the loup of the worker t.
+	 */
+	void write_loup(int t);
+
+	/**
+	 * \brief Contract the buffer of the worker t with its current loup.
+	 */
+	void contract_buffer(int t);
+
+	/**
+	 * \brief Calculate the uplo from the (remaining) cells of the workers.
+	 */
+	void update_uplo();
+
+	/** Number of threads. */
+	const int nb_threads;
+
+	/** Locks of the buffers of the workers. */
+	Lock* locks;
+
+	/** Number of cells either in the buffers or being processed. */
+	long nb_pending;
+
+	/** Set to TIME_OUT or UNBOUNDED_OBJ if the search has to be stopped. */
+	int interrupt;
+
+	/** The initial box of the current optimization. */
+	const IntervalVector* init_box;
+
+	/** Status of the last optimization. */
+	Optimizer::Status status;
+
+	/** The current uplo. */
+	double uplo;
+
+	/** Lower bound of the small boxes taken by the precision. */
+	double uplo_of_epsboxes;
+
+	/** The shared loup. */
+	double loup;
+
+	/** The shared loup point. */
+	IntervalVector loup_point;
+
+	/** Lock for the shared loup and loup point. */
+	Lock loup_lock;
+
+	/** The bound on the objective given by the user. */
+	double initial_loup;
+
+	/** Real running time. */
+	double time;
+
+	/** Start time of the current search (see #ibex::wall_time()). */
+	double start_time;
+
+	/** Number of cells pushed in the buffers. */
+	long nb_cells;
+
+	/** Number of steals. */
+	unsigned int nb_steals;
+};
+
+/*============================================ inline implementation ============================================ */
+
+inline Optimizer::Status ParallelOptimizer::get_status() const { return status; }
+
+inline double ParallelOptimizer::get_uplo() const { return uplo; }
+
+inline double ParallelOptimizer::get_loup() const { return loup; }
+
+inline const IntervalVector& ParallelOptimizer::get_loup_point() const { return loup_point; }
+
+inline double ParallelOptimizer::get_time() const { return time; }
+
+inline double ParallelOptimizer::get_nb_cells() const { return nb_cells; }
+
+inline unsigned int ParallelOptimizer::get_nb_steals() const { return nb_steals; }
+
+inline double ParallelOptimizer::get_obj_rel_prec() const {
+	if (loup==POS_INFINITY)
+		return POS_INFINITY;
+	else if (loup==0)
+		if (uplo<0) return POS_INFINITY;
+		else return 0;
+	else
+		return (loup-uplo)/(fabs(loup));
+}
+
+inline double ParallelOptimizer::get_obj_abs_prec() const {
+	return loup-uplo;
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_PARALLEL_OPTIMIZER_H__
@@ -67,4 +67,69 @@ void TestCtcPolytopeHull::fixbug01() {
 }
 
 
+void TestCtcPolytopeHull::warm_start01() {
+
+	double _A[5*3]= {1,  1,  1,
+	                 1, -1,  0,
+	                -1,  0,  2,
+	                 0, -1, -1,
+	                 2,  1, -1 };
+	Matrix A(5,3,_A);
+	double _b[5]= {1, 0.5, 1, 0.5, 1};
+	Vector b(5,_b);
+
+	// the LP of each box is warm-started from the basis of the previous one
+	CtcPolytopeHull ctc(A,b);
+
+	IntervalVector box(3,Interval(-2,2));
+
+	for (int i=0; i<20; i++) {
+		IntervalVector box1(box);
+		ctc.contract(box1);
+
+		// cold start
+		IntervalVector box2(box);
+		CtcPolytopeHull(A,b).contract(box2);
+
+		CPPUNIT_ASSERT(almost_eq(box1,box2,1e-9));
+
+		// next box: alternatively the left and right half of the contracted box
+		// or a translation (so that the polytope may be empty)
+		if (box1.is_empty() || i%5==4)
+			box=IntervalVector(3,Interval(-2,2))+Vector(3,0.2*(i%3));
+		else {
+			std::pair<IntervalVector,IntervalVector> p=box1.bisect(i%3);
+			box = i%2? p.first : p.second;
+		}
+	}
+}
+
+void TestCtcPolytopeHull::parallel01() {
+
+	double _A[5*3]= {1,  1,  1,
+	                 1, -1,  0,
+	                -1,  0,  2,
+	                 0, -1, -1,
+	                 2,  1, -1 };
+	Matrix A(5,3,_A);
+	double _b[5]= {1, 0.5, 1, 0.5, 1};
+	Vector b(5,_b);
+
+	CtcPolytopeHull ctc(A,b);
+	ctc.set_nb_threads(4);
+
+	for (int i=0; i<10; i++) {
+		IntervalVector box(3,Interval(-2+0.1*i,2));
+		IntervalVector box1(box);
+		ctc.contract(box1);
+
+		// sequential algorithm (the hull of the polytope does not
+		// depend on the order of the LPs)
+		IntervalVector box2(box);
+		CtcPolytopeHull(A,b).contract(box2);
+
+		CPPUNIT_ASSERT(almost_eq(box1,box2,1e-9));
+	}
+}
+
 } // end namespace ibex
@@ -20,20 +20,21 @@ class TestCtcPolytopeHull : public CppUnit::TestFixture {
 public:
 
 	CPPUNIT_TEST_SUITE(TestCtcPolytopeHull);
-	
-
-#ifndef _IBEX_WITH_NOLP_
-
 		CPPUNIT_TEST(lp01);
 		CPPUNIT_TEST(fixbug01);
-
-#endif //_IBEX_WITH_NOLP_
-
+		CPPUNIT_TEST(warm_start01);
+		CPPUNIT_TEST(parallel01);
 	CPPUNIT_TEST_SUITE_END();
 
 	void lp01();
 
 	void fixbug01();
+
+	// same contractor applied on a sequence of boxes
+	void warm_start01();
+
+	// LPs solved by several threads
+	void parallel01();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestCtcPolytopeHull);
@@ -163,4 +163,31 @@ void TestDoubleHeap::test02() {
 	CPPUNIT_ASSERT(h.size()==0);
 }
 
+void TestDoubleHeap::elements01() {
+	TestCostFunc1 costf1;
+	TestCostFunc2 costf2;
+
+	DoubleHeap<Interval> h(costf1,false,costf2,false,50);
+
+	vector<Interval*> v;
+	h.elements(v);
+	CPPUNIT_ASSERT(v.empty());
+
+	for (int i=1; i<=10 ;i++)
+		h.push(new Interval(i,3*i));
+
+	h.pop1();
+	h.pop2();
+
+	h.elements(v);
+	CPPUNIT_ASSERT(v.size()==8);
+
+	// all the remaining intervals (the first two have been popped), once
+	double sum=0;
+	for (size_t i=0; i<v.size(); i++) sum+=v[i]->lb();
+	CPPUNIT_ASSERT(sum==52);
+
+	h.flush();
+}
+
 } // end namespace
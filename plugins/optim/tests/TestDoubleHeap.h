@@ -25,10 +25,12 @@ public:
 	CPPUNIT_TEST_SUITE(TestDoubleHeap);
 	CPPUNIT_TEST(test01);
 	CPPUNIT_TEST(test02);
+	CPPUNIT_TEST(elements01);
 	CPPUNIT_TEST_SUITE_END();
 
 	void test01();
 	void test02();
+	void elements01();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestDoubleHeap);
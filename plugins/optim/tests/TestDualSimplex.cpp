@@ -0,0 +1,138 @@
+//============================================================================
+//                                  I B E X
+// File        : TestDualSimplex.cpp
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "TestDualSimplex.h"
+#include "ibex_DualSimplex.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// minimize -x-y s.t. x+2y<=4, 3x+y<=6, x,y in [0,10]
+void lp01(DualSimplex& lp) {
+	lp.set_obj(0,-1);
+	lp.set_obj(1,-1);
+	lp.set_bounds(IntervalVector(2,Interval(0,10)));
+	double _a1[2]={1,2};
+	double _a2[2]={3,1};
+	lp.set_row(0,Vector(2,_a1),NEG_INFINITY,4);
+	lp.set_row(1,Vector(2,_a2),NEG_INFINITY,6);
+}
+
+}
+
+void TestDualSimplex::optimal01() {
+	DualSimplex lp(2);
+	lp01(lp);
+
+	CPPUNIT_ASSERT(lp.solve()==DualSimplex::OPTIMAL);
+	CPPUNIT_ASSERT(almost_eq(lp.obj_value(),-2.8,1e-12));
+
+	Vector x(2);
+	lp.primal_sol(x);
+	double _x[2]={1.6,1.2};
+	CPPUNIT_ASSERT(almost_eq(x,Vector(2,_x),1e-12));
+
+	// c = A^T y + d, where both rows are active (y<=0)
+	// and the bounds are not (d=0).
+	Vector y(2);
+	Vector d(2);
+	lp.dual_sol(y,d);
+	double _y[2]={-0.4,-0.2};
+	CPPUNIT_ASSERT(almost_eq(y,Vector(2,_y),1e-12));
+	CPPUNIT_ASSERT(almost_eq(d,Vector::zeros(2),1e-12));
+}
+
+void TestDualSimplex::null_obj01() {
+	DualSimplex lp(2);
+	lp.set_bounds(IntervalVector(2,Interval(-1,1)));
+	double _a[2]={1,1};
+	lp.set_row(0,Vector(2,_a),-1,1);
+
+	CPPUNIT_ASSERT(lp.solve()==DualSimplex::OPTIMAL);
+	CPPUNIT_ASSERT(lp.obj_value()==0);
+
+	// the solution is not a corner of the box
+	Vector x(2);
+	lp.primal_sol(x);
+	CPPUNIT_ASSERT(x==Vector::zeros(2));
+}
+
+void TestDualSimplex::unbounded_side01() {
+	// minimize y s.t. y>=x, y>=-x, x in [-1,2], y free
+	DualSimplex lp(2);
+	lp.set_obj(1,1);
+	double _box[][2]={{-1,2},{NEG_INFINITY,POS_INFINITY}};
+	lp.set_bounds(IntervalVector(2,_box));
+	double _a1[2]={-1,1};
+	double _a2[2]={1,1};
+	lp.set_row(0,Vector(2,_a1),0,POS_INFINITY);
+	lp.set_row(1,Vector(2,_a2),0,POS_INFINITY);
+
+	CPPUNIT_ASSERT(lp.solve()==DualSimplex::OPTIMAL);
+	CPPUNIT_ASSERT(almost_eq(lp.obj_value(),0,1e-12));
+
+	// maximize y: y reaches its "infinite" bound
+	lp.set_obj(1,-1);
+	CPPUNIT_ASSERT(lp.solve()==DualSimplex::UNKNOWN);
+}
+
+void TestDualSimplex::warm_start01() {
+	DualSimplex lp(2);
+	lp01(lp);
+	CPPUNIT_ASSERT(lp.solve()==DualSimplex::OPTIMAL);
+
+	// overwrite the second row: 3x+y<=6 is replaced by x+y<=1
+	double _a2[2]={1,1};
+	lp.set_row(1,Vector(2,_a2),NEG_INFINITY,1);
+	CPPUNIT_ASSERT(lp.solve()==DualSimplex::OPTIMAL);
+	CPPUNIT_ASSERT(almost_eq(lp.obj_value(),-1,1e-12));
+
+	// the same LP from scratch
+	DualSimplex lp2(2);
+	lp01(lp2);
+	lp2.set_row(1,Vector(2,_a2),NEG_INFINITY,1);
+	CPPUNIT_ASSERT(lp2.solve()==DualSimplex::OPTIMAL);
+	CPPUNIT_ASSERT(almost_eq(lp2.obj_value(),-1,1e-12));
+
+	// remove the second row and add a third one
+	lp.remove_rows(1);
+	double _a3[2]={1,0};
+	lp.set_row(1,Vector(2,_a3),NEG_INFINITY,0.5);
+	CPPUNIT_ASSERT(lp.nb_rows()==2);
+	CPPUNIT_ASSERT(lp.solve()==DualSimplex::OPTIMAL);
+	// x=0.5, y=1.75
+	CPPUNIT_ASSERT(almost_eq(lp.obj_value(),-2.25,1e-12));
+}
+
+void TestDualSimplex::infeasible01() {
+	// x+y>=3, x-y=0, x,y in [0,1.4]
+	DualSimplex lp(2);
+	lp.set_obj(0,1);
+	IntervalVector box(2,Interval(0,1.4));
+	lp.set_bounds(box);
+	double _a1[2]={1,1};
+	double _a2[2]={1,-1};
+	Vector a1(2,_a1);
+	Vector a2(2,_a2);
+	lp.set_row(0,a1,3,POS_INFINITY);
+	lp.set_row(1,a2,0,0);
+
+	CPPUNIT_ASSERT(lp.solve()==DualSimplex::INFEASIBLE);
+
+	// max { y^T(Ax-s) } < 0
+	Vector y(2);
+	lp.infeasible_dir(y);
+	Interval gap=(y[0]*a1+y[1]*a2)*box-y[0]*Interval(3,POS_INFINITY)-y[1]*Interval::ZERO;
+	CPPUNIT_ASSERT(gap.ub()<0);
+}
+
+} // end namespace ibex
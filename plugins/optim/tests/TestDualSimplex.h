@@ -0,0 +1,50 @@
+//============================================================================
+//                                  I B E X
+// File        : TestDualSimplex.h
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __TEST_DUAL_SIMPLEX_H__
+#define __TEST_DUAL_SIMPLEX_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestDualSimplex : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestDualSimplex);
+		CPPUNIT_TEST(optimal01);
+		CPPUNIT_TEST(null_obj01);
+		CPPUNIT_TEST(unbounded_side01);
+		CPPUNIT_TEST(warm_start01);
+		CPPUNIT_TEST(infeasible01);
+	CPPUNIT_TEST_SUITE_END();
+
+	// optimal value, primal and dual solutions
+	void optimal01();
+
+	// an LP with a null objective
+	void null_obj01();
+
+	// a row and a variable with an infinite bound
+	void unbounded_side01();
+
+	// rows overwritten between two resolutions
+	void warm_start01();
+
+	// Farkas certificate
+	void infeasible01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestDualSimplex);
+
+
+} // end namespace ibex
+#endif // __TEST_DUAL_SIMPLEX_H__
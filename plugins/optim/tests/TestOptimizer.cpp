@@ -12,7 +12,11 @@
 #include "TestOptimizer.h"
 #include "ibex_Optimizer.h"
 #include "ibex_DefaultOptimizer.h"
+#include "ibex_ParallelOptimizer.h"
 #include "ibex_SystemFactory.h"
+#include "ibex_RoundRobin.h"
+#include "ibex_LoupFinderDefault.h"
+#include "ibex_CellDoubleHeap.h"
 
 using namespace std;
 
@@ -51,5 +55,156 @@ void TestOptimizer::issue50_4() {
 	CPPUNIT_ASSERT(issue50(-1e-10, 0)==Optimizer::INFEASIBLE);
 }
 
+void TestOptimizer::parallel01() {
+	SystemFactory f;
+	const ExprSymbol& x=ExprSymbol::new_();
+	const ExprSymbol& y=ExprSymbol::new_();
+	f.add_var(x);
+	f.add_var(y);
+	f.add_ctr(sqr(x)+sqr(y)<=4);
+	f.add_ctr(x*y>=1);
+	f.add_goal(sin(x)+sqr(y-1)+x*y);
+
+	System sys1(f);
+	System sys2(sys1,System::COPY);
+
+	double prec=1e-6;
+
+	IntervalVector init_box(2,Interval(-10,10));
+
+	DefaultOptimizer o(sys1,prec,prec,prec);
+	CPPUNIT_ASSERT(o.optimize(init_box)==Optimizer::SUCCESS);
+
+	DefaultOptimizer o1(sys1,prec,prec,prec);
+	DefaultOptimizer o2(sys2,prec,prec,prec);
+	Array<Optimizer> workers(o1,o2);
+	ParallelOptimizer po(workers);
+	CPPUNIT_ASSERT(po.optimize(init_box)==Optimizer::SUCCESS);
+
+	CPPUNIT_ASSERT(po.get_uplo()<=po.get_loup());
+	// the two enclosures of the minimum must intersect
+	CPPUNIT_ASSERT(po.get_uplo()<=o.get_loup());
+	CPPUNIT_ASSERT(o.get_uplo()<=po.get_loup());
+	CPPUNIT_ASSERT(po.get_obj_abs_prec()<=prec || po.get_obj_rel_prec()<=prec);
+}
+
+namespace {
+
+// a contractor that raises an exception at the nth call
+class CtcFail : public Ctc {
+public:
+	CtcFail(int nb_var, int n) : Ctc(nb_var), n(n) { }
+
+	virtual void contract(IntervalVector& box) {
+		if (--n==0) throw Exception();
+	}
+
+	int n;
+};
+
+// an optimizer based on CtcFail
+class FailOptimizer {
+public:
+	FailOptimizer(const System& sys, int n) : norm_sys(sys), ext_sys(sys), ctc(ext_sys.nb_var,n),
+		bsc(1e-6), finder(norm_sys), buffer(ext_sys), o(sys.nb_var,ctc,bsc,finder,buffer,ext_sys.goal_var()) { }
+
+	NormalizedSystem norm_sys;
+	ExtendedSystem ext_sys;
+	CtcFail ctc;
+	RoundRobin bsc;
+	LoupFinderDefault finder;
+	CellDoubleHeap buffer;
+	Optimizer o;
+};
+
+}
+
+void TestOptimizer::parallel02() {
+	SystemFactory f;
+	const ExprSymbol& x=ExprSymbol::new_();
+	const ExprSymbol& y=ExprSymbol::new_();
+	f.add_var(x);
+	f.add_var(y);
+	f.add_ctr(sqr(x)+sqr(y)<=4);
+	f.add_goal(sin(x)+sqr(y-1)+x*y);
+
+	System sys1(f);
+	System sys2(sys1,System::COPY);
+
+	FailOptimizer o1(sys1,10);
+	FailOptimizer o2(sys2,10);
+
+	// the exception of a thread is raised by the parallel optimizer
+	ParallelOptimizer po(Array<Optimizer>(o1.o,o2.o));
+	CPPUNIT_ASSERT_THROW(po.optimize(IntervalVector(2,Interval(-10,10))), Exception);
+}
+
+namespace {
+
+// Rastrigin function (6 variables) with a linear constraint
+System* rastrigin() {
+	SystemFactory f;
+	const ExprSymbol& x=ExprSymbol::new_(Dim::col_vec(6));
+	f.add_var(x);
+	const ExprNode* e=&(sqr(x[0])-10*cos(6.2832*x[0]));
+	for (int i=1; i<6; i++) e=&(*e+sqr(x[i])-10*cos(6.2832*x[i]));
+	f.add_ctr(x[0]+x[1]>=0.5);
+	f.add_goal(*e);
+	return new System(f);
+}
+
+}
+
+void TestOptimizer::checkpoint01() {
+	System* sys=rastrigin();
+	double prec=1e-8;
+	IntervalVector init_box(6,Interval(-5,5));
+
+	DefaultOptimizer o(*sys,prec,prec,prec);
+	CPPUNIT_ASSERT(o.optimize(init_box)==Optimizer::SUCCESS);
+
+	DefaultOptimizer o1(*sys,prec,prec,prec);
+	o1.timeout=o.get_time()/10;
+	CPPUNIT_ASSERT(o1.optimize(init_box)==Optimizer::TIME_OUT);
+	o1.checkpoint("__tmp__.chk");
+
+	DefaultOptimizer o2(*sys,prec,prec,prec);
+	CPPUNIT_ASSERT(o2.optimize("__tmp__.chk")==Optimizer::SUCCESS);
+	CPPUNIT_ASSERT(o2.get_nb_cells()>=o1.get_nb_cells());
+	CPPUNIT_ASSERT(o2.get_time()>=o1.get_time());
+	CPPUNIT_ASSERT(o2.get_uplo()<=o.get_loup());
+	CPPUNIT_ASSERT(o.get_uplo()<=o2.get_loup());
+	CPPUNIT_ASSERT(o2.get_obj_abs_prec()<=prec || o2.get_obj_rel_prec()<=prec);
+
+	remove("__tmp__.chk");
+	delete sys;
+}
+
+void TestOptimizer::checkpoint02() {
+	System* sys=rastrigin();
+	double prec=1e-8;
+	IntervalVector init_box(6,Interval(-5,5));
+
+	DefaultOptimizer o(*sys,prec,prec,prec);
+	CPPUNIT_ASSERT(o.optimize(init_box)==Optimizer::SUCCESS);
+
+	// the last checkpoint is written at time out
+	DefaultOptimizer o1(*sys,prec,prec,prec);
+	o1.timeout=o.get_time()/5;
+	o1.checkpoint_file="__tmp__.chk";
+	o1.checkpoint_period=o.get_time()/20;
+	CPPUNIT_ASSERT(o1.optimize(init_box)==Optimizer::TIME_OUT);
+
+	DefaultOptimizer o2(*sys,prec,prec,prec);
+	o2.timeout=o1.timeout;
+	CPPUNIT_ASSERT(o2.optimize("__tmp__.chk")==Optimizer::TIME_OUT); // cumulated time
+	o2.timeout=-1;
+	CPPUNIT_ASSERT(o2.optimize("__tmp__.chk")==Optimizer::SUCCESS);
+	CPPUNIT_ASSERT(o2.get_uplo()<=o.get_loup());
+	CPPUNIT_ASSERT(o.get_uplo()<=o2.get_loup());
+
+	remove("__tmp__.chk");
+	delete sys;
+}
 
 } // end namespace
@@ -23,13 +23,14 @@ class TestOptimizer : public CppUnit::TestFixture {
 public:
 
 	CPPUNIT_TEST_SUITE(TestOptimizer);
-	
-#ifndef _IBEX_WITH_NOLP_
 		CPPUNIT_TEST(issue50_1);
 		CPPUNIT_TEST(issue50_2);
 		CPPUNIT_TEST(issue50_3);
 		CPPUNIT_TEST(issue50_4);
-#endif
+		CPPUNIT_TEST(parallel01);
+		CPPUNIT_TEST(parallel02);
+		CPPUNIT_TEST(checkpoint01);
+		CPPUNIT_TEST(checkpoint02);
 	CPPUNIT_TEST_SUITE_END();
 
 	// upperbounding with goal_prec=10% will remove everything (initial loup > true minimum) --> NO_FEASIBLE_FOUND
@@ -40,6 +41,14 @@ public:
 	void issue50_3();
 	// upperbounding with goal_prec=0 will make the optimizer fail (initial loup < true minimum) --> INFEASIBLE
 	void issue50_4();
+	// the parallel optimizer must find the same minimum as the sequential one
+	void parallel01();
+
+	void parallel02();
+	// an interrupted optimization resumed from a checkpoint must find the same minimum
+	void checkpoint01();
+	// same with the periodic checkpoint file
+	void checkpoint02();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestOptimizer);
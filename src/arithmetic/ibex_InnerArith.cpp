@@ -13,6 +13,7 @@
 
 //#include <stdlib.h>
 #include <cassert>
+#include <fenv.h>
 
 using namespace std;
 
@@ -69,29 +70,37 @@ double LO_root(const double& _real_, int expon) {
 	return root(Interval(_real_,_real_), expon).lb();
 }
 
+// Note: the rounding mode is restored at the end (it is not
+// the same for all the interval libraries).
 double projx(double z, double y, int op, bool round_up) {
+  int round=fegetround();
   (round_up)? fpu_round_up() : fpu_round_down();
+  double x;
   switch(op) {
-    case ADD: return z-y;
-    case SUB: return z+y;
-    case MUL: return (y==0)? POS_INFINITY:z/y;
-    default:  return z*y;
+    case ADD: x=z-y; break;
+    case SUB: x=z+y; break;
+    case MUL: x=(y==0)? POS_INFINITY:z/y; break;
+    default:  x=z*y;
   }
-  //fpu_round_near(); // unreachable!
+  fesetround(round);
+  return x;
 }
 
 double projy(double z, double x, int op, bool round_up) {
+  int round=fegetround();
   (round_up)? fpu_round_up() : fpu_round_down();
+  double y;
   switch(op) {
-    case ADD: return z-x;
-    case SUB: return x-z;
+    case ADD: y=z-x; break;
+    case SUB: y=x-z; break;
     case MUL:
     	//assert(z!=0); // z==0 should not appear
     	assert(x!=0); // x==0 should not appear
-    	return z/x;
-    default: return (z==0)? POS_INFINITY:x/z;
+    	y=z/x; break;
+    default: y=(z==0)? POS_INFINITY:x/z;
   }
-  //fpu_round_near(); // unreachable!
+  fesetround(round);
+  return y;
 }
 
 
@@ -196,7 +205,6 @@ bool ibwd_cmp_mono_op(bool geq, double z, Interval& x, Interval& y, const Interv
 	if ((inc_var1 && xmin > x.ub()) || (!inc_var1 && xmax < x.lb())) {
 		// this may happen including with inflate mode.
 		// e.g.: x=<1,1>, y=[0,eps] and z=1. then xmax<1.
-		if (!inc_var1) fpu_round_up(); // default mode. TODO: valid for gaol and... ?
 				if (inflate) {x=xin; y=yin; return true;}
 		else {
 		x.set_empty();
@@ -215,7 +223,6 @@ bool ibwd_cmp_mono_op(bool geq, double z, Interval& x, Interval& y, const Interv
 			if (inc_var1) { if (xmax>xin.lb()) xmax=xin.lb(); }
 			else          { if (xmin<xin.ub()) xmin=xin.ub(); }
 			if (xmin>xmax) {
-				if (!inc_var1) fpu_round_up(); // default mode. TODO: valid for gaol and... ?
 				x=xin;
 				y=yin;
 				return true;
@@ -243,7 +250,6 @@ bool ibwd_cmp_mono_op(bool geq, double z, Interval& x, Interval& y, const Interv
 
 	x = (inc_var1)? Interval(x0,x.ub()):Interval(x.lb(),x0);
 
-	if (!inc_var1 || !inc_var2) fpu_round_up(); // default mode. TODO: valid for gaol and... ?
 	// [gch] if op==MUL and z=0 we have y=[0,0]
 	// and x=[x^-,x0] (or x=[x0,x^+]) which is correct in both
 	// case although we could take x entirely in this case.
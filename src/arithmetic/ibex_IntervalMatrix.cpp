@@ -12,6 +12,7 @@
 #include "ibex_IntervalMatrix.h"
 #include "ibex_Agenda.h"
 #include "ibex_TemplateMatrix.h"
+#include "ibex_PackedInterval.h"
 
 namespace ibex {
 
@@ -388,5 +389,35 @@ double infinite_norm(const IntervalMatrix& m) {
 	return _infinite_normM(m);
 }
 
+/*
+ * The products below are computed with packed bounds
+ * (see ibex_PackedInterval.h) if the dimension is large enough.
+ * The results are the same.
+ *
+ * Note: this is not done for an interval matrix-vector product
+ * because packing the matrix costs more than the product itself.
+ */
+
+IntervalVector operator*(const Matrix& m, const IntervalVector& v) {
+	if (m.nb_cols()<PACKED_MIN_DIM || v.is_empty())
+		return mulMV<Matrix,IntervalVector,IntervalVector>(m,v);
+	else
+		return (m*PackedIntervalVector(v)).unpack();
+}
+
+IntervalMatrix operator*(const Matrix& m1, const IntervalMatrix& m2) {
+	if (m2.nb_rows()<PACKED_MIN_DIM || m2.nb_cols()<PACKED_MIN_DIM || m2.is_empty())
+		return mulMM<Matrix,IntervalMatrix,IntervalMatrix>(m1,m2);
+	else
+		return (m1*PackedIntervalMatrix(m2)).unpack();
+}
+
+IntervalMatrix operator*(const IntervalMatrix& m1, const IntervalMatrix& m2) {
+	if (m2.nb_rows()<PACKED_MIN_DIM || m2.nb_cols()<PACKED_MIN_DIM || m1.is_empty() || m2.is_empty())
+		return mulMM<IntervalMatrix,IntervalMatrix,IntervalMatrix>(m1,m2);
+	else
+		return (PackedIntervalMatrix(m1)*PackedIntervalMatrix(m2)).unpack();
+}
+
 
 } // namespace ibex
@@ -832,17 +832,9 @@ inline IntervalVector operator*(const IntervalVector& v, const IntervalMatrix& m
 	return mulVM<IntervalVector,IntervalMatrix,IntervalVector>(v,m);
 }
 
-inline IntervalMatrix operator*(const Matrix& m1, const IntervalMatrix& m2) {
-	return mulMM<Matrix,IntervalMatrix,IntervalMatrix>(m1,m2);
-}
-
 inline IntervalMatrix operator*(const IntervalMatrix& m1, const Matrix& m2) {
 	return mulMM<IntervalMatrix,Matrix,IntervalMatrix>(m1,m2);
 }
 
-inline IntervalMatrix operator*(const IntervalMatrix& m1, const IntervalMatrix& m2) {
-	return mulMM<IntervalMatrix,IntervalMatrix,IntervalMatrix>(m1,m2);
-}
-
 } // namespace ibex
 #endif // __IBEX_INTERVAL_MATRIX_H__
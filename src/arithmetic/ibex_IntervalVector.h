@@ -924,10 +924,6 @@ inline IntervalVector hadamard_product(const IntervalVector& v1, const IntervalV
 	return hadamard_prod<IntervalVector,IntervalVector,IntervalVector>(v1,v2);
 }
 
-inline IntervalVector operator*(const Matrix& m, const IntervalVector& v) {
-	return mulMV<Matrix,IntervalVector,IntervalVector>(m,v);
-}
-
 inline IntervalVector operator*(const IntervalVector& v, const Matrix& m) {
 	return mulVM<IntervalVector,Matrix,IntervalVector>(v,m);
 }
@@ -0,0 +1,475 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_PackedInterval.cpp
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_PackedInterval.h"
+#include "ibex_TemplateVector.h"
+#include "ibex_InvalidIntervalVectorOp.h"
+
+#include <fenv.h>
+
+namespace ibex {
+
+const int PACKED_MIN_DIM = 8;
+
+namespace {
+
+/*
+ * Set the rounding mode of the FPU and restore
+ * the initial one at destruction.
+ *
+ * The loops below are written so that they contain no
+ * function call: the rounding mode cannot change inside
+ * a loop, only between two of them.
+ *
+ * Note: the lower bounds are not computed with the upward
+ * rounding and the sign trick (-((-a)*b)) because the compiler
+ * may simplify the negations.
+ */
+class Rounding {
+public:
+	Rounding() : mode(fegetround()), current(mode) { }
+	~Rounding() { set(mode); }
+	void down() { set(FE_DOWNWARD); }
+	void up()   { set(FE_UPWARD); }
+private:
+	// the mode is often already upward (e.g., with Gaol)
+	void set(int m) { if (m!=current) { fesetround(m); current=m; } }
+	int mode;
+	int current;
+};
+
+inline double min2(double x, double y) { return x<y? x : y; }
+inline double max2(double x, double y) { return x>y? x : y; }
+
+inline double min4(double a, double b, double c, double d) {
+	return min2(min2(a*c,a*d),min2(b*c,b*d));
+}
+
+inline double max4(double a, double b, double c, double d) {
+	return max2(max2(a*c,a*d),max2(b*c,b*d));
+}
+
+bool unbounded_bounds(const double* lb, const double* ub, int n) {
+	int unbounded=0;
+	for (int i=0; i<n; i++)
+		unbounded |= (lb[i]==NEG_INFINITY) | (ub[i]==POS_INFINITY);
+	return unbounded;
+}
+
+} // end anonymous namespace
+
+/*================================== vector ==================================*/
+
+PackedIntervalVector::PackedIntervalVector(int n) : n(n), _lb(new double[2*n]), _ub(_lb+n), empty(false) {
+	assert(n>=1);
+	for (int i=0; i<n; i++) {
+		_lb[i]=NEG_INFINITY;
+		_ub[i]=POS_INFINITY;
+	}
+}
+
+PackedIntervalVector::PackedIntervalVector(const IntervalVector& x) : n(x.size()), _lb(new double[2*n]), _ub(_lb+n), empty(false) {
+	*this = x;
+}
+
+PackedIntervalVector::PackedIntervalVector(const PackedIntervalVector& x) : n(x.n), _lb(new double[2*n]), _ub(_lb+n), empty(false) {
+	*this = x;
+}
+
+PackedIntervalVector::~PackedIntervalVector() {
+	delete[] _lb;
+}
+
+PackedIntervalVector& PackedIntervalVector::operator=(const PackedIntervalVector& x) {
+	assert(x.n==n);
+	empty=x.empty;
+	for (int i=0; i<2*n; i++)
+		_lb[i]=x._lb[i];
+	return *this;
+}
+
+PackedIntervalVector& PackedIntervalVector::operator=(const IntervalVector& x) {
+	assert(x.size()==n);
+	empty=x.is_empty();
+	if (!empty)
+		for (int i=0; i<n; i++) {
+			_lb[i]=x[i].lb();
+			_ub[i]=x[i].ub();
+		}
+	return *this;
+}
+
+void PackedIntervalVector::unpack(IntervalVector& x) const {
+	assert(x.size()==n);
+	if (empty)
+		x.set_empty();
+	else
+		for (int i=0; i<n; i++)
+			x[i]=Interval(_lb[i],_ub[i]);
+}
+
+bool PackedIntervalVector::is_unbounded() const {
+	return !empty && unbounded_bounds(_lb,_ub,n);
+}
+
+Vector PackedIntervalVector::diam() const {
+	Vector d(n);
+	if (empty) throw InvalidIntervalVectorOp("Diameter of an empty IntervalVector is undefined");
+	double* _d=d.raw();
+	Rounding r;
+	r.up();
+	for (int i=0; i<n; i++)
+		_d[i]=_ub[i]-_lb[i];
+	return d;
+}
+
+double PackedIntervalVector::max_diam() const {
+	if (empty) throw InvalidIntervalVectorOp("Diameter of an empty IntervalVector is undefined");
+	// an unbounded component has an infinite diameter
+	double d=0;
+	Rounding r;
+	r.up();
+	for (int i=0; i<n; i++)
+		d=max2(d,_ub[i]-_lb[i]);
+	return d;
+}
+
+double PackedIntervalVector::min_diam() const {
+	if (empty) throw InvalidIntervalVectorOp("Diameter of an empty IntervalVector is undefined");
+	// the minimal diameter is infinite only if all
+	// the components are unbounded (as in IntervalVector)
+	double d=POS_INFINITY;
+	Rounding r;
+	r.up();
+	for (int i=0; i<n; i++)
+		d=min2(d,_ub[i]-_lb[i]);
+	return d;
+}
+
+int PackedIntervalVector::extr_diam_index(bool min) const {
+	if (empty || is_unbounded())
+		// the unbounded case follows specific rules
+		return _extr_diam_index(*this,min);
+
+	Vector d=diam();
+	int selected=0;
+	for (int i=1; i<n; i++)
+		if (min? d[i]<d[selected] : d[i]>d[selected]) selected=i;
+	return selected;
+}
+
+bool PackedIntervalVector::is_subset(const PackedIntervalVector& x) const {
+	assert(x.n==n);
+	if (empty) return true;
+	if (x.empty) return false;
+
+	int subset=1;
+	for (int i=0; i<n; i++)
+		subset &= (_lb[i]>=x._lb[i]) & (_ub[i]<=x._ub[i]);
+	return subset;
+}
+
+PackedIntervalVector& PackedIntervalVector::operator+=(const PackedIntervalVector& x) {
+	assert(x.n==n);
+	if (empty || x.empty) { set_empty(); return *this; }
+
+	Rounding r;
+	r.down();
+	for (int i=0; i<n; i++)
+		_lb[i]+=x._lb[i];
+	r.up();
+	for (int i=0; i<n; i++)
+		_ub[i]+=x._ub[i];
+	return *this;
+}
+
+PackedIntervalVector& PackedIntervalVector::operator-=(const PackedIntervalVector& x) {
+	assert(x.n==n);
+	if (empty || x.empty) { set_empty(); return *this; }
+
+	Rounding r;
+	r.down();
+	for (int i=0; i<n; i++)
+		_lb[i]-=x._ub[i];
+	r.up();
+	for (int i=0; i<n; i++)
+		_ub[i]-=x._lb[i];
+	return *this;
+}
+
+PackedIntervalVector& PackedIntervalVector::operator+=(const Vector& x) {
+	assert(x.size()==n);
+	if (empty) return *this;
+	// adding an infinite value gives the empty set (as with Interval)
+	if (unbounded_bounds(&x[0],&x[0],n)) { set_empty(); return *this; }
+
+	Rounding r;
+	r.down();
+	for (int i=0; i<n; i++)
+		_lb[i]+=x[i];
+	r.up();
+	for (int i=0; i<n; i++)
+		_ub[i]+=x[i];
+	return *this;
+}
+
+PackedIntervalVector& PackedIntervalVector::operator-=(const Vector& x) {
+	assert(x.size()==n);
+	if (empty) return *this;
+	if (unbounded_bounds(&x[0],&x[0],n)) { set_empty(); return *this; }
+
+	Rounding r;
+	r.down();
+	for (int i=0; i<n; i++)
+		_lb[i]-=x[i];
+	r.up();
+	for (int i=0; i<n; i++)
+		_ub[i]-=x[i];
+	return *this;
+}
+
+/*================================== matrix ==================================*/
+
+PackedIntervalMatrix::PackedIntervalMatrix(int nb_rows, int nb_cols) : _nb_rows(nb_rows), _nb_cols(nb_cols),
+		_lb(new double[2*nb_rows*nb_cols]), _ub(_lb+nb_rows*nb_cols), empty(false) {
+	assert(nb_rows>0 && nb_cols>0);
+	for (int k=0; k<_nb_rows*_nb_cols; k++) {
+		_lb[k]=NEG_INFINITY;
+		_ub[k]=POS_INFINITY;
+	}
+}
+
+PackedIntervalMatrix::PackedIntervalMatrix(const IntervalMatrix& m) : _nb_rows(m.nb_rows()), _nb_cols(m.nb_cols()),
+		_lb(new double[2*_nb_rows*_nb_cols]), _ub(_lb+_nb_rows*_nb_cols), empty(m.is_empty()) {
+	if (empty) return;
+	double* l=_lb;
+	double* u=_ub;
+	for (int i=0; i<_nb_rows; i++) {
+		const IntervalVector& row=m[i];
+		for (int j=0; j<_nb_cols; j++) {
+			*l++=row[j].lb();
+			*u++=row[j].ub();
+		}
+	}
+}
+
+PackedIntervalMatrix::PackedIntervalMatrix(const PackedIntervalMatrix& m) : _nb_rows(m._nb_rows), _nb_cols(m._nb_cols),
+		_lb(new double[2*_nb_rows*_nb_cols]), _ub(_lb+_nb_rows*_nb_cols), empty(false) {
+	*this = m;
+}
+
+PackedIntervalMatrix::~PackedIntervalMatrix() {
+	delete[] _lb;
+}
+
+PackedIntervalMatrix& PackedIntervalMatrix::operator=(const PackedIntervalMatrix& m) {
+	assert(m._nb_rows==_nb_rows && m._nb_cols==_nb_cols);
+	empty=m.empty;
+	for (int k=0; k<2*_nb_rows*_nb_cols; k++)
+		_lb[k]=m._lb[k];
+	return *this;
+}
+
+void PackedIntervalMatrix::unpack(IntervalMatrix& m) const {
+	assert(m.nb_rows()==_nb_rows && m.nb_cols()==_nb_cols);
+	if (empty) { m.set_empty(); return; }
+	const double* l=_lb;
+	const double* u=_ub;
+	for (int i=0; i<_nb_rows; i++) {
+		IntervalVector& row=m[i];
+		for (int j=0; j<_nb_cols; j++)
+			row[j]=Interval(*l++,*u++);
+	}
+}
+
+bool PackedIntervalMatrix::is_unbounded() const {
+	return !empty && unbounded_bounds(_lb,_ub,_nb_rows*_nb_cols);
+}
+
+/*================================= products =================================*/
+
+/*
+ * In the products, the terms are summed in the same order as in
+ * the generic ones (see ibex_LinearArith.h) so that the results are
+ * identical. Only the products are vectorized (in the matrix-vector
+ * case) since a sum cannot be reordered without changing the result.
+ */
+
+PackedIntervalVector operator*(const Matrix& m, const PackedIntervalVector& x) {
+	assert(m.nb_cols()==x.size());
+
+	int n=m.nb_cols();
+	PackedIntervalVector y(m.nb_rows());
+
+	if (x.is_empty()) { y.set_empty(); return y; }
+
+	if (x.is_unbounded()) {
+		y = mulMV<Matrix,IntervalVector,IntervalVector>(m,x.unpack());
+		return y;
+	}
+
+	double* t=new double[n];
+	const double* c=x._lb;
+	const double* d=x._ub;
+	Rounding r;
+
+	r.down();
+	for (int i=0; i<m.nb_rows(); i++) {
+		const double* a=&m[i][0];
+		for (int j=0; j<n; j++) t[j]=min2(a[j]*c[j],a[j]*d[j]);
+		double s=0;
+		for (int j=0; j<n; j++) s+=t[j];
+		y._lb[i]=s;
+	}
+
+	r.up();
+	for (int i=0; i<m.nb_rows(); i++) {
+		const double* a=&m[i][0];
+		for (int j=0; j<n; j++) t[j]=max2(a[j]*c[j],a[j]*d[j]);
+		double s=0;
+		for (int j=0; j<n; j++) s+=t[j];
+		y._ub[i]=s;
+	}
+
+	delete[] t;
+	return y;
+}
+
+PackedIntervalVector operator*(const PackedIntervalMatrix& m, const PackedIntervalVector& x) {
+	assert(m.nb_cols()==x.size());
+
+	int n=m.nb_cols();
+	PackedIntervalVector y(m.nb_rows());
+
+	if (m.is_empty() || x.is_empty()) { y.set_empty(); return y; }
+
+	if (m.is_unbounded() || x.is_unbounded()) {
+		y = mulMV<IntervalMatrix,IntervalVector,IntervalVector>(m.unpack(),x.unpack());
+		return y;
+	}
+
+	double* t=new double[n];
+	const double* c=x._lb;
+	const double* d=x._ub;
+	Rounding r;
+
+	r.down();
+	for (int i=0; i<m.nb_rows(); i++) {
+		const double* a=m.lb(i);
+		const double* b=m.ub(i);
+		for (int j=0; j<n; j++) t[j]=min4(a[j],b[j],c[j],d[j]);
+		double s=0;
+		for (int j=0; j<n; j++) s+=t[j];
+		y._lb[i]=s;
+	}
+
+	r.up();
+	for (int i=0; i<m.nb_rows(); i++) {
+		const double* a=m.lb(i);
+		const double* b=m.ub(i);
+		for (int j=0; j<n; j++) t[j]=max4(a[j],b[j],c[j],d[j]);
+		double s=0;
+		for (int j=0; j<n; j++) s+=t[j];
+		y._ub[i]=s;
+	}
+
+	delete[] t;
+	return y;
+}
+
+PackedIntervalMatrix operator*(const Matrix& m1, const PackedIntervalMatrix& m2) {
+	assert(m1.nb_cols()==m2.nb_rows());
+
+	int p=m2.nb_rows();
+	int n=m2.nb_cols();
+	PackedIntervalMatrix m3(m1.nb_rows(),n);
+
+	if (m2.is_empty()) { m3.set_empty(); return m3; }
+
+	if (m2.is_unbounded()) {
+		IntervalMatrix res=mulMM<Matrix,IntervalMatrix,IntervalMatrix>(m1,m2.unpack());
+		return PackedIntervalMatrix(res);
+	}
+
+	// loops in the order (i,k,j): the inner loop runs
+	// on contiguous bounds and the terms of each entry
+	// are still summed with k increasing.
+	Rounding r;
+	r.down();
+	for (int i=0; i<m1.nb_rows(); i++) {
+		double* l=m3._lb+i*n;
+		for (int j=0; j<n; j++) l[j]=0;
+		for (int k=0; k<p; k++) {
+			double a=m1[i][k];
+			const double* c=m2.lb(k);
+			const double* d=m2.ub(k);
+			for (int j=0; j<n; j++) l[j]+=min2(a*c[j],a*d[j]);
+		}
+	}
+
+	r.up();
+	for (int i=0; i<m1.nb_rows(); i++) {
+		double* u=m3._ub+i*n;
+		for (int j=0; j<n; j++) u[j]=0;
+		for (int k=0; k<p; k++) {
+			double a=m1[i][k];
+			const double* c=m2.lb(k);
+			const double* d=m2.ub(k);
+			for (int j=0; j<n; j++) u[j]+=max2(a*c[j],a*d[j]);
+		}
+	}
+
+	return m3;
+}
+
+PackedIntervalMatrix operator*(const PackedIntervalMatrix& m1, const PackedIntervalMatrix& m2) {
+	assert(m1.nb_cols()==m2.nb_rows());
+
+	int p=m2.nb_rows();
+	int n=m2.nb_cols();
+	PackedIntervalMatrix m3(m1.nb_rows(),n);
+
+	if (m1.is_empty() || m2.is_empty()) { m3.set_empty(); return m3; }
+
+	if (m1.is_unbounded() || m2.is_unbounded()) {
+		IntervalMatrix res=mulMM<IntervalMatrix,IntervalMatrix,IntervalMatrix>(m1.unpack(),m2.unpack());
+		return PackedIntervalMatrix(res);
+	}
+
+	Rounding r;
+	r.down();
+	for (int i=0; i<m1.nb_rows(); i++) {
+		double* l=m3._lb+i*n;
+		for (int j=0; j<n; j++) l[j]=0;
+		for (int k=0; k<p; k++) {
+			double a=m1.lb(i)[k];
+			double b=m1.ub(i)[k];
+			const double* c=m2.lb(k);
+			const double* d=m2.ub(k);
+			for (int j=0; j<n; j++) l[j]+=min4(a,b,c[j],d[j]);
+		}
+	}
+
+	r.up();
+	for (int i=0; i<m1.nb_rows(); i++) {
+		double* u=m3._ub+i*n;
+		for (int j=0; j<n; j++) u[j]=0;
+		for (int k=0; k<p; k++) {
+			double a=m1.lb(i)[k];
+			double b=m1.ub(i)[k];
+			const double* c=m2.lb(k);
+			const double* d=m2.ub(k);
+			for (int j=0; j<n; j++) u[j]+=max4(a,b,c[j],d[j]);
+		}
+	}
+
+	return m3;
+}
+
+} // namespace ibex
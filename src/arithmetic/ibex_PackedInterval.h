@@ -0,0 +1,379 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_PackedInterval.h
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_PACKED_INTERVAL_H__
+#define __IBEX_PACKED_INTERVAL_H__
+
+#include "ibex_IntervalMatrix.h"
+
+namespace ibex {
+
+class PackedIntervalMatrix;
+
+/**
+ * \ingroup arithmetic
+ *
+ * \brief Interval vector with separate arrays of bounds.
+ *
+ * An #ibex::IntervalVector is an array of #ibex::Interval, each
+ * wrapping an interval of the underlying library. Here, the lower
+ * bounds and the upper bounds are stored in two contiguous arrays
+ * of doubles ("structure of arrays") so that the loops of the
+ * operations below have no branch and no call to the interval
+ * library and can be vectorized by the compiler.
+ *
+ * The bounds are computed with directed rounding (the rounding mode of
+ * the FPU is switched during the operation and then restored), so the
+ * results are the same as with #ibex::IntervalVector.
+ *
+ * Unbounded vectors are supported but some operations
+ * (e.g., products) fall back to the generic interval arithmetic.
+ */
+class PackedIntervalVector {
+public:
+	/**
+	 * \brief Create [-oo,+oo]^n.
+	 */
+	explicit PackedIntervalVector(int n);
+
+	/**
+	 * \brief Create a packed copy of x.
+	 */
+	PackedIntervalVector(const IntervalVector& x);
+
+	/**
+	 * \brief Duplicate a packed vector.
+	 */
+	PackedIntervalVector(const PackedIntervalVector& x);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~PackedIntervalVector();
+
+	/**
+	 * \brief Set this to x (the size must be the same).
+	 */
+	PackedIntervalVector& operator=(const PackedIntervalVector& x);
+
+	/**
+	 * \brief Set this to x (the size must be the same).
+	 */
+	PackedIntervalVector& operator=(const IntervalVector& x);
+
+	/**
+	 * \brief Return the i-th component.
+	 */
+	Interval operator[](int i) const;
+
+	/**
+	 * \brief Set the i-th component.
+	 *
+	 * x must not be empty.
+	 */
+	void set(int i, const Interval& x);
+
+	/**
+	 * \brief Return the corresponding interval vector.
+	 */
+	IntervalVector unpack() const;
+
+	/**
+	 * \brief Write the components into x (the size must be the same).
+	 */
+	void unpack(IntervalVector& x) const;
+
+	/**
+	 * \brief The size of this vector.
+	 */
+	int size() const;
+
+	/**
+	 * \brief The array of lower bounds.
+	 */
+	const double* lb() const;
+
+	/**
+	 * \brief The array of upper bounds.
+	 */
+	const double* ub() const;
+
+	/**
+	 * \brief True iff this vector is empty.
+	 */
+	bool is_empty() const;
+
+	/**
+	 * \brief Set this vector to the empty set.
+	 */
+	void set_empty();
+
+	/**
+	 * \brief True iff one component is unbounded.
+	 */
+	bool is_unbounded() const;
+
+	/**
+	 * \brief Return the vector of diameters.
+	 */
+	Vector diam() const;
+
+	/**
+	 * \brief Return the maximal diameter among all the components.
+	 */
+	double max_diam() const;
+
+	/**
+	 * \brief Return the minimal diameter among all the components.
+	 */
+	double min_diam() const;
+
+	/**
+	 * \brief Return the index of a component with minimal/maximal diameter.
+	 *
+	 * \see #ibex::IntervalVector::extr_diam_index(bool) const.
+	 */
+	int extr_diam_index(bool min) const;
+
+	/**
+	 * \brief True iff this vector is a subset of x.
+	 */
+	bool is_subset(const PackedIntervalVector& x) const;
+
+	/**
+	 * \brief (*this)+=x.
+	 */
+	PackedIntervalVector& operator+=(const PackedIntervalVector& x);
+
+	/**
+	 * \brief (*this)-=x.
+	 */
+	PackedIntervalVector& operator-=(const PackedIntervalVector& x);
+
+	/**
+	 * \brief (*this)+=x.
+	 */
+	PackedIntervalVector& operator+=(const Vector& x);
+
+	/**
+	 * \brief (*this)-=x.
+	 */
+	PackedIntervalVector& operator-=(const Vector& x);
+
+private:
+	friend PackedIntervalVector operator*(const Matrix& m, const PackedIntervalVector& x);
+	friend PackedIntervalVector operator*(const PackedIntervalMatrix& m, const PackedIntervalVector& x);
+
+	int n;          // dimension
+	double* _lb;    // lower bounds
+	double* _ub;    // upper bounds (_ub=_lb+n)
+	bool empty;
+};
+
+/**
+ * \ingroup arithmetic
+ *
+ * \brief Interval matrix with separate arrays of bounds.
+ *
+ * The lower and upper bounds are stored row by row in two contiguous
+ * arrays of doubles. See #ibex::PackedIntervalVector.
+ */
+class PackedIntervalMatrix {
+public:
+	/**
+	 * \brief Create a (nb_rows x nb_cols) matrix of [-oo,+oo].
+	 */
+	PackedIntervalMatrix(int nb_rows, int nb_cols);
+
+	/**
+	 * \brief Create a packed copy of m.
+	 */
+	PackedIntervalMatrix(const IntervalMatrix& m);
+
+	/**
+	 * \brief Duplicate a packed matrix.
+	 */
+	PackedIntervalMatrix(const PackedIntervalMatrix& m);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~PackedIntervalMatrix();
+
+	/**
+	 * \brief Set this to m (the dimensions must be the same).
+	 */
+	PackedIntervalMatrix& operator=(const PackedIntervalMatrix& m);
+
+	/**
+	 * \brief Return the corresponding interval matrix.
+	 */
+	IntervalMatrix unpack() const;
+
+	/**
+	 * \brief Write the entries into m (the dimensions must be the same).
+	 */
+	void unpack(IntervalMatrix& m) const;
+
+	/**
+	 * \brief Number of rows.
+	 */
+	int nb_rows() const;
+
+	/**
+	 * \brief Number of columns.
+	 */
+	int nb_cols() const;
+
+	/**
+	 * \brief Lower bounds of the ith row.
+	 */
+	const double* lb(int i) const;
+
+	/**
+	 * \brief Upper bounds of the ith row.
+	 */
+	const double* ub(int i) const;
+
+	/**
+	 * \brief True iff this matrix is empty.
+	 */
+	bool is_empty() const;
+
+	/**
+	 * \brief Set this matrix to the empty set.
+	 */
+	void set_empty();
+
+	/**
+	 * \brief True iff one entry is unbounded.
+	 */
+	bool is_unbounded() const;
+
+private:
+	friend PackedIntervalVector operator*(const PackedIntervalMatrix& m, const PackedIntervalVector& x);
+	friend PackedIntervalMatrix operator*(const Matrix& m1, const PackedIntervalMatrix& m2);
+	friend PackedIntervalMatrix operator*(const PackedIntervalMatrix& m1, const PackedIntervalMatrix& m2);
+
+	int _nb_rows;
+	int _nb_cols;
+	double* _lb;    // lower bounds (row-major)
+	double* _ub;    // upper bounds (row-major, _ub=_lb+nb_rows*nb_cols)
+	bool empty;
+};
+
+/** \ingroup arithmetic */
+/*@{*/
+
+/**
+ * \brief Return m*x.
+ */
+PackedIntervalVector operator*(const Matrix& m, const PackedIntervalVector& x);
+
+/**
+ * \brief Return m*x.
+ */
+PackedIntervalVector operator*(const PackedIntervalMatrix& m, const PackedIntervalVector& x);
+
+/**
+ * \brief Return m1*m2.
+ */
+PackedIntervalMatrix operator*(const Matrix& m1, const PackedIntervalMatrix& m2);
+
+/**
+ * \brief Return m1*m2.
+ */
+PackedIntervalMatrix operator*(const PackedIntervalMatrix& m1, const PackedIntervalMatrix& m2);
+
+/**
+ * \brief Minimal number of columns for the packed kernels.
+ *
+ * Under this size, packing the operands and switching the
+ * rounding mode cost more than the generic products
+ * (see #ibex::operator*(const Matrix&, const IntervalMatrix&)).
+ */
+extern const int PACKED_MIN_DIM;
+
+/*@}*/
+
+/*============================================ inline implementation ============================================ */
+
+inline int PackedIntervalVector::size() const {
+	return n;
+}
+
+inline const double* PackedIntervalVector::lb() const {
+	return _lb;
+}
+
+inline const double* PackedIntervalVector::ub() const {
+	return _ub;
+}
+
+inline bool PackedIntervalVector::is_empty() const {
+	return empty;
+}
+
+inline void PackedIntervalVector::set_empty() {
+	empty=true;
+}
+
+inline Interval PackedIntervalVector::operator[](int i) const {
+	assert(i>=0 && i<n);
+	return empty ? Interval::EMPTY_SET : Interval(_lb[i],_ub[i]);
+}
+
+inline void PackedIntervalVector::set(int i, const Interval& x) {
+	assert(i>=0 && i<n);
+	assert(!x.is_empty());
+	_lb[i]=x.lb();
+	_ub[i]=x.ub();
+}
+
+inline IntervalVector PackedIntervalVector::unpack() const {
+	IntervalVector x(n);
+	unpack(x);
+	return x;
+}
+
+inline int PackedIntervalMatrix::nb_rows() const {
+	return _nb_rows;
+}
+
+inline int PackedIntervalMatrix::nb_cols() const {
+	return _nb_cols;
+}
+
+inline const double* PackedIntervalMatrix::lb(int i) const {
+	assert(i>=0 && i<_nb_rows);
+	return _lb+i*_nb_cols;
+}
+
+inline const double* PackedIntervalMatrix::ub(int i) const {
+	assert(i>=0 && i<_nb_rows);
+	return _ub+i*_nb_cols;
+}
+
+inline bool PackedIntervalMatrix::is_empty() const {
+	return empty;
+}
+
+inline void PackedIntervalMatrix::set_empty() {
+	empty=true;
+}
+
+inline IntervalMatrix PackedIntervalMatrix::unpack() const {
+	IntervalMatrix m(_nb_rows,_nb_cols);
+	unpack(m);
+	return m;
+}
+
+} // namespace ibex
+
+#endif // __IBEX_PACKED_INTERVAL_H__
@@ -0,0 +1,159 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SparseIntervalMatrix.cpp
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_SparseIntervalMatrix.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace ibex {
+
+SparseIntervalMatrix::SparseIntervalMatrix(int nb_rows, int nb_cols, const vector<vector<int> >& pattern) :
+		_nb_rows(nb_rows), _nb_cols(nb_cols), _row(NULL), _col(NULL), _val(NULL), empty(false) {
+	assert(nb_rows>0 && nb_cols>0);
+	assert((int) pattern.size()==nb_rows);
+	init_pattern(pattern);
+}
+
+SparseIntervalMatrix::SparseIntervalMatrix(const IntervalMatrix& m) :
+		_nb_rows(m.nb_rows()), _nb_cols(m.nb_cols()), _row(NULL), _col(NULL), _val(NULL), empty(false) {
+
+	vector<vector<int> > pattern(_nb_rows);
+
+	if (!m.is_empty()) {
+		for (int i=0; i<_nb_rows; i++)
+			for (int j=0; j<_nb_cols; j++)
+				if (m[i][j]!=Interval::ZERO) pattern[i].push_back(j);
+	}
+
+	init_pattern(pattern);
+
+	if (m.is_empty())
+		set_empty();
+	else
+		for (int i=0; i<_nb_rows; i++)
+			for (int k=_row[i]; k<_row[i+1]; k++)
+				_val[k]=m[i][_col[k]];
+}
+
+SparseIntervalMatrix::SparseIntervalMatrix(const SparseIntervalMatrix& m) :
+		_nb_rows(m._nb_rows), _nb_cols(m._nb_cols), _row(new int[m._nb_rows+1]),
+		_col(new int[m.nb_nonzeros()]), _val(new Interval[m.nb_nonzeros()]), empty(m.empty) {
+
+	for (int i=0; i<=_nb_rows; i++)
+		_row[i]=m._row[i];
+
+	for (int k=0; k<nb_nonzeros(); k++) {
+		_col[k]=m._col[k];
+		_val[k]=m._val[k];
+	}
+}
+
+SparseIntervalMatrix::~SparseIntervalMatrix() {
+	delete[] _row;
+	delete[] _col;
+	delete[] _val;
+}
+
+void SparseIntervalMatrix::init_pattern(const vector<vector<int> >& pattern) {
+	_row = new int[_nb_rows+1];
+	_row[0]=0;
+	for (int i=0; i<_nb_rows; i++)
+		_row[i+1]=_row[i]+pattern[i].size();
+
+	_col = new int[nb_nonzeros()];
+	_val = new Interval[nb_nonzeros()];
+
+	for (int i=0; i<_nb_rows; i++) {
+		for (unsigned int l=0; l<pattern[i].size(); l++) {
+			int j=pattern[i][l];
+			assert(j>=0 && j<_nb_cols);
+			assert(l==0 || j>pattern[i][l-1]); // increasing order
+			_col[_row[i]+l]=j;
+			_val[_row[i]+l]=Interval::ZERO;
+		}
+	}
+}
+
+SparseIntervalMatrix& SparseIntervalMatrix::operator=(const SparseIntervalMatrix& m) {
+	assert(m._nb_rows==_nb_rows && m._nb_cols==_nb_cols && m.nb_nonzeros()==nb_nonzeros());
+	empty=m.empty;
+	for (int k=0; k<nb_nonzeros(); k++) {
+		assert(_col[k]==m._col[k]);
+		_val[k]=m._val[k];
+	}
+	return *this;
+}
+
+int SparseIntervalMatrix::find(int i, int j) const {
+	assert(i>=0 && i<_nb_rows);
+	assert(j>=0 && j<_nb_cols);
+
+	int* begin=_col+_row[i];
+	int* end=_col+_row[i+1];
+	int* k=lower_bound(begin,end,j);
+	return (k!=end && *k==j) ? k-_col : -1;
+}
+
+void SparseIntervalMatrix::clear() {
+	empty=false;
+	for (int k=0; k<nb_nonzeros(); k++)
+		_val[k]=Interval::ZERO;
+}
+
+bool SparseIntervalMatrix::is_unbounded() const {
+	if (empty) return false;
+	for (int k=0; k<nb_nonzeros(); k++)
+		if (_val[k].is_unbounded()) return true;
+	return false;
+}
+
+IntervalMatrix SparseIntervalMatrix::dense() const {
+	if (empty) return IntervalMatrix::empty(_nb_rows,_nb_cols);
+
+	IntervalMatrix m(_nb_rows,_nb_cols,Interval::ZERO);
+	for (int i=0; i<_nb_rows; i++)
+		for (int k=_row[i]; k<_row[i+1]; k++)
+			m[i][_col[k]]=_val[k];
+	return m;
+}
+
+IntervalVector operator*(const SparseIntervalMatrix& m, const IntervalVector& x) {
+	assert(m.nb_cols()==x.size());
+
+	if (m.empty || x.is_empty())
+		return IntervalVector::empty(m.nb_rows());
+
+	IntervalVector y(m.nb_rows());
+	for (int i=0; i<m._nb_rows; i++) {
+		y[i]=Interval::ZERO;
+		for (int k=m._row[i]; k<m._row[i+1]; k++)
+			y[i]+=m._val[k]*x[m._col[k]];
+	}
+	return y;
+}
+
+ostream& operator<<(ostream& os, const SparseIntervalMatrix& m) {
+	if (m.is_empty()) return os << "empty matrix";
+	os << "(";
+	for (int i=0; i<m.nb_rows(); i++) {
+		os << "(";
+		for (int k=m.row_begin(i); k<m.row_end(i); k++) {
+			if (k>m.row_begin(i)) os << " ; ";
+			os << m.col(k) << ":" << m.val(k);
+		}
+		os << ")";
+		if (i<m.nb_rows()-1) os << endl;
+	}
+	os << ")";
+	return os;
+}
+
+} // namespace ibex
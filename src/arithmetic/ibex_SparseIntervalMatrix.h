@@ -0,0 +1,236 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SparseIntervalMatrix.h
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_SPARSE_INTERVAL_MATRIX_H__
+#define __IBEX_SPARSE_INTERVAL_MATRIX_H__
+
+#include "ibex_IntervalMatrix.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup arithmetic
+ *
+ * \brief Sparse interval matrix.
+ *
+ * Only the entries of a fixed "pattern" (the structural nonzeros) are
+ * stored, row by row (compressed sparse row format). All the other entries
+ * are exactly 0. The pattern is set at construction and cannot change
+ * (in particular, the product of two sparse matrices is not provided).
+ *
+ * The nonzeros of a row are accessed through their position k in the
+ * arrays of entries, with #row_begin(int) <= k < #row_end(int):
+ *
+ * \code
+ * for (int k=A.row_begin(i); k<A.row_end(i); k++)
+ *     ... A.col(k) ... A.val(k) ...
+ * \endcode
+ *
+ * Typical usage is the Jacobian matrix of a large system where each
+ * equation only involves a few variables
+ * (see #ibex::Function::jacobian(const IntervalVector&, SparseIntervalMatrix&) const).
+ */
+class SparseIntervalMatrix {
+public:
+	/**
+	 * \brief Create a (nb_rows x nb_cols) matrix with a given pattern.
+	 *
+	 * The ith vector of \a pattern contains the column indices of the
+	 * nonzeros of the ith row, in increasing order. The entries are
+	 * initialized to 0.
+	 */
+	SparseIntervalMatrix(int nb_rows, int nb_cols, const std::vector<std::vector<int> >& pattern);
+
+	/**
+	 * \brief Create a sparse copy of m.
+	 *
+	 * The pattern is the set of entries of m different from [0,0].
+	 */
+	explicit SparseIntervalMatrix(const IntervalMatrix& m);
+
+	/**
+	 * \brief Duplicate a sparse matrix.
+	 */
+	SparseIntervalMatrix(const SparseIntervalMatrix& m);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~SparseIntervalMatrix();
+
+	/**
+	 * \brief Set this to m (the patterns must be the same).
+	 */
+	SparseIntervalMatrix& operator=(const SparseIntervalMatrix& m);
+
+	/**
+	 * \brief Number of rows.
+	 */
+	int nb_rows() const;
+
+	/**
+	 * \brief Number of columns.
+	 */
+	int nb_cols() const;
+
+	/**
+	 * \brief Number of structural nonzeros.
+	 */
+	int nb_nonzeros() const;
+
+	/**
+	 * \brief Position of the first nonzero of the ith row.
+	 */
+	int row_begin(int i) const;
+
+	/**
+	 * \brief Position following the last nonzero of the ith row.
+	 */
+	int row_end(int i) const;
+
+	/**
+	 * \brief Column of the kth nonzero.
+	 */
+	int col(int k) const;
+
+	/**
+	 * \brief Value of the kth nonzero.
+	 */
+	Interval& val(int k);
+
+	/**
+	 * \brief Value of the kth nonzero (const version).
+	 */
+	const Interval& val(int k) const;
+
+	/**
+	 * \brief Position of the entry (i,j) or -1 if it is not in the pattern.
+	 *
+	 * Complexity: logarithmic in the number of nonzeros of the row.
+	 */
+	int find(int i, int j) const;
+
+	/**
+	 * \brief Return the entry (i,j) (0 if not in the pattern).
+	 */
+	Interval operator()(int i, int j) const;
+
+	/**
+	 * \brief Set all the stored entries to 0.
+	 */
+	void clear();
+
+	/**
+	 * \brief True iff this matrix is empty.
+	 */
+	bool is_empty() const;
+
+	/**
+	 * \brief Set this matrix to the empty set.
+	 */
+	void set_empty();
+
+	/**
+	 * \brief True iff one entry is unbounded.
+	 */
+	bool is_unbounded() const;
+
+	/**
+	 * \brief Return the corresponding (dense) interval matrix.
+	 */
+	IntervalMatrix dense() const;
+
+private:
+	friend IntervalVector operator*(const SparseIntervalMatrix& m, const IntervalVector& x);
+
+	void init_pattern(const std::vector<std::vector<int> >& pattern);
+
+	int _nb_rows;
+	int _nb_cols;
+	int* _row;         // _row[i] = position of the first nonzero of row i (_row[nb_rows]=nb_nonzeros)
+	int* _col;         // column of each nonzero
+	Interval* _val;    // value of each nonzero
+	bool empty;
+};
+
+/** \ingroup arithmetic */
+/*@{*/
+
+/**
+ * \brief Return m*x.
+ *
+ * Complexity: linear in the number of nonzeros.
+ */
+IntervalVector operator*(const SparseIntervalMatrix& m, const IntervalVector& x);
+
+/**
+ * \brief Display a sparse matrix (only the stored entries).
+ */
+std::ostream& operator<<(std::ostream& os, const SparseIntervalMatrix& m);
+
+/*@}*/
+
+/*============================================ inline implementation ============================================ */
+
+inline int SparseIntervalMatrix::nb_rows() const {
+	return _nb_rows;
+}
+
+inline int SparseIntervalMatrix::nb_cols() const {
+	return _nb_cols;
+}
+
+inline int SparseIntervalMatrix::nb_nonzeros() const {
+	return _row[_nb_rows];
+}
+
+inline int SparseIntervalMatrix::row_begin(int i) const {
+	assert(i>=0 && i<_nb_rows);
+	return _row[i];
+}
+
+inline int SparseIntervalMatrix::row_end(int i) const {
+	assert(i>=0 && i<_nb_rows);
+	return _row[i+1];
+}
+
+inline int SparseIntervalMatrix::col(int k) const {
+	assert(k>=0 && k<nb_nonzeros());
+	return _col[k];
+}
+
+inline Interval& SparseIntervalMatrix::val(int k) {
+	assert(k>=0 && k<nb_nonzeros());
+	return _val[k];
+}
+
+inline const Interval& SparseIntervalMatrix::val(int k) const {
+	assert(k>=0 && k<nb_nonzeros());
+	return _val[k];
+}
+
+inline Interval SparseIntervalMatrix::operator()(int i, int j) const {
+	if (empty) return Interval::EMPTY_SET;
+	int k=find(i,j);
+	return k==-1 ? Interval::ZERO : _val[k];
+}
+
+inline bool SparseIntervalMatrix::is_empty() const {
+	return empty;
+}
+
+inline void SparseIntervalMatrix::set_empty() {
+	empty=true;
+}
+
+} // namespace ibex
+
+#endif // __IBEX_SPARSE_INTERVAL_MATRIX_H__
@@ -19,7 +19,7 @@ namespace ibex {
 pair<IntervalVector,IntervalVector> SmearFunction::bisect(const IntervalVector& box, int& last_var) {
 	IntervalMatrix J(sys.f_ctrs.image_dim(), sys.nb_var);
 
-	sys.f_ctrs.jacobian(box,J);
+	sys.f_ctrs.cached_jacobian(box,J);
 	// in case of infinite derivatives  changing to roundrobin bisection
 	for (int i=0; i<sys.f_ctrs.image_dim(); i++)
 		for (int j=0; j<sys.nb_var; j++)
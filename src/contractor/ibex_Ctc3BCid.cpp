@@ -10,6 +10,7 @@
 //============================================================================
 
 #include "ibex_Ctc3BCid.h"
+#include "ibex_Lock.h"
 
 using namespace std;
 namespace ibex {
@@ -20,9 +21,9 @@ const double Ctc3BCid::default_var_min_width = 1.e-11;
 const int Ctc3BCid::LimitCIDDichotomy=16;
 
 Ctc3BCid::Ctc3BCid(const BitSet& cid_vars, Ctc& ctc, int s3b, int scid, int vhandled, double var_min_width) :
-							Ctc(ctc.nb_var), cid_vars(cid_vars), ctc(ctc), s3b(s3b), scid(scid),
+							Ctc(ctc.nb_var), cid_vars(cid_vars), ctc(ctc), nb_threads(1), s3b(s3b), scid(scid),
 							vhandled(vhandled<=0? cid_vars.size():vhandled),
-							var_min_width(var_min_width), start_var(0), impact(BitSet::empty(nb_var)) {
+							var_min_width(var_min_width), start_var(0), impact(BitSet::empty(nb_var)), shavers(NULL) {
 	assert(ctc.nb_var>0);
 //	if (ctc.nb_var<=0)
 //		ibex_error("Ctc3BCID : the contractor is non-dimensional, Please specify the dimension with: \n Ctc3BCid(int nb_var, const BoolMask& cid_vars, Ctc& ctc, int s3b, int scid, int vhandled, double var_min_width);");
@@ -30,9 +31,9 @@ Ctc3BCid::Ctc3BCid(const BitSet& cid_vars, Ctc& ctc, int s3b, int scid, int vhan
 
 
 Ctc3BCid::Ctc3BCid(Ctc& ctc, int s3b, int scid, int vhandled, double var_min_width) :
-                    		Ctc(ctc.nb_var), cid_vars(BitSet::all(nb_var)), ctc(ctc), s3b(s3b), scid(scid),
+                    		Ctc(ctc.nb_var), cid_vars(BitSet::all(nb_var)), ctc(ctc), nb_threads(1), s3b(s3b), scid(scid),
                     		vhandled(vhandled<=0? nb_var : vhandled),
-                    		var_min_width(var_min_width), start_var(0), impact(BitSet::empty(nb_var)) {
+                    		var_min_width(var_min_width), start_var(0), impact(BitSet::empty(nb_var)), shavers(NULL) {
 
 	assert(ctc.nb_var>0);
 //	if (ctc.nb_var<=0)
@@ -40,6 +41,41 @@ Ctc3BCid::Ctc3BCid(Ctc& ctc, int s3b, int scid, int vhandled, double var_min_wid
 }
 
 
+Ctc3BCid::Ctc3BCid(const BitSet& cid_vars, const Array<Ctc>& ctcs, int s3b, int scid, int vhandled, double var_min_width) :
+							Ctc(ctcs[0].nb_var), cid_vars(cid_vars), ctc(ctcs[0]), nb_threads(ctcs.size()), s3b(s3b), scid(scid),
+							vhandled(vhandled<=0? cid_vars.size():vhandled),
+							var_min_width(var_min_width), start_var(0), impact(BitSet::empty(nb_var)), shavers(NULL) {
+	init_shavers(ctcs);
+}
+
+Ctc3BCid::Ctc3BCid(const Array<Ctc>& ctcs, int s3b, int scid, int vhandled, double var_min_width) :
+							Ctc(ctcs[0].nb_var), cid_vars(BitSet::all(nb_var)), ctc(ctcs[0]), nb_threads(ctcs.size()), s3b(s3b), scid(scid),
+							vhandled(vhandled<=0? nb_var : vhandled),
+							var_min_width(var_min_width), start_var(0), impact(BitSet::empty(nb_var)), shavers(NULL) {
+	init_shavers(ctcs);
+}
+
+void Ctc3BCid::init_shavers(const Array<Ctc>& ctcs) {
+	assert(nb_var>0);
+
+	if (nb_threads==1) return; // sequential algorithm
+
+	shavers = new Ctc3BCid*[nb_threads];
+	for (int t=0; t<nb_threads; t++) {
+		if (ctcs[t].nb_var!=nb_var)
+			ibex_error("Ctc3BCid: the sub-contractors must have the same number of variables");
+		shavers[t] = new Ctc3BCid(cid_vars, ctcs[t], s3b, scid, 1, var_min_width);
+	}
+}
+
+Ctc3BCid::~Ctc3BCid() {
+	if (shavers) {
+		for (int t=0; t<nb_threads; t++)
+			delete shavers[t];
+		delete[] shavers;
+	}
+}
+
 int Ctc3BCid::limitCIDDichotomy ()  {
 	return LimitCIDDichotomy;
 }
@@ -59,6 +95,25 @@ void Ctc3BCid::contract(IntervalVector& box) {
 	int var;                                           // [gch] variable to be carCIDed
 
 	start_var=nb_var-1;                                //  patch pour l'optim  A RETIRER ??
+
+	if (shavers) {                                     // parallel mode: rounds of (at most) nb_var variables
+		for (int k=0; k<vhandled; k+=nb_var) {
+			int n=vhandled-k < nb_var ? vhandled-k : nb_var;
+			std::vector<int> vars(n);
+			for (int i=0; i<n; i++)
+				vars[i]=(start_var+k+i)%nb_var;
+			std::vector<IntervalVector> boxes(n,box);
+			var3BCID_parallel(vars,boxes);
+			for (int i=0; i<n; i++)
+				box &= boxes[i];
+			if (box.is_empty()) {
+				set_flag(FIXPOINT);
+				return;
+			}
+		}
+		return;
+	}
+
 	impact.clear();                                    // [gch]
 	for (int k=0; k<vhandled; k++) {                   // [gch] k counts the number of varCIDed variables [gch]
 
@@ -78,6 +133,19 @@ void Ctc3BCid::contract(IntervalVector& box) {
 }
 
 
+void Ctc3BCid::var3BCID_parallel(const std::vector<int>& vars, std::vector<IntervalVector>& boxes) {
+	assert(shavers);
+	int n=vars.size();
+
+#pragma omp parallel for schedule(dynamic,1) num_threads(nb_threads)
+	for (int i=0; i<n; i++) {
+		Ctc3BCid& s=*shavers[thread_num()];
+		s.impact.add(vars[i]);
+		s.var3BCID(boxes[i],vars[i]);
+		s.impact.remove(vars[i]);
+	}
+}
+
 bool Ctc3BCid::var3BCID(IntervalVector& box, int var) {
 
 	Interval& dom(box[var]);
@@ -14,6 +14,9 @@
 
 #include "ibex_Ctc.h"
 #include "ibex_BitSet.h"
+#include "ibex_Array.h"
+
+#include <vector>
 
 namespace ibex {
 
@@ -100,6 +103,45 @@ class Ctc3BCid : public Ctc {
 	Ctc3BCid(Ctc& ctc, int s3b=default_s3b, int scid=default_scid,
 			int vhandled=-1, double var_min_width=default_var_min_width);
 
+	/**
+	 * \brief Parallel 3BCID.
+	 *
+	 * The variables are shaved concurrently, each thread relying on its
+	 * own sub-contractor (contractors are not thread-safe). All the
+	 * sub-contractors must be built with the same parameters, on the same
+	 * system (functions can be evaluated by several threads at a time, see
+	 * #ibex::EvalContext) or on copies of it (see #System::COPY).
+	 *
+	 * The variables are handled by rounds of (at most) #nb_var variables.
+	 * In a round, all the variables are shaved on the same box (and not
+	 * on the box resulting from the previous shaving) and the resulting
+	 * boxes are intersected. The contraction can therefore be weaker than
+	 * with the sequential algorithm but it does not depend on the number
+	 * of threads nor on their scheduling.
+	 *
+	 * \param ctcs - one sub-contractor per thread. The number of threads is
+	 *               the size of this array. If this size is 1, the
+	 *               sequential algorithm is applied.
+	 *
+	 * The other parameters are the same as in the sequential case.
+	 *
+	 * \note Threads are only created if Ibex is compiled with OpenMP
+	 * (see the --with-openmp option).
+	 */
+	Ctc3BCid(const BitSet& cid_vars, const Array<Ctc>& ctcs, int s3b=default_s3b, int scid=default_scid,
+			int vhandled=-1, double var_min_width=default_var_min_width);
+
+	/**
+	 * \brief Parallel 3BCID on all variables.
+	 */
+	Ctc3BCid(const Array<Ctc>& ctcs, int s3b=default_s3b, int scid=default_scid,
+			int vhandled=-1, double var_min_width=default_var_min_width);
+
+	/**
+	 * \brief Delete this.
+	 */
+	virtual ~Ctc3BCid();
+
 
 	/**
 	 * \brief Apply contraction.
@@ -116,9 +158,12 @@ class Ctc3BCid : public Ctc {
 	/** The variables to which var3BCID is applied **/
 	BitSet cid_vars;
 
-	/** The sub-contractor */
+	/** The sub-contractor (the one of the first thread in parallel mode) */
 	Ctc& ctc;
 
+	/** Number of threads (1 for the sequential algorithm). */
+	const int nb_threads;
+
 	/** Default s3b value, set to 10 **/
 	static const int default_s3b;
 
@@ -185,6 +230,12 @@ class Ctc3BCid : public Ctc {
 	 */
 	bool shave_bound_dicho(IntervalVector& box, int var, double wv, bool left);
 
+	/**
+	 * Applies var3BCID on each variable vars[i] of the box boxes[i]
+	 * (parallel mode only). The boxes are contracted concurrently.
+	 */
+	void var3BCID_parallel(const std::vector<int>& vars, std::vector<IntervalVector>& boxes);
+
 	/**
 	 * Contracts with CID \a box slicing the variable \a var.
 	 *
@@ -229,7 +280,12 @@ class Ctc3BCid : public Ctc {
 	BitSet impact;
 
 	virtual int limitCIDDichotomy () ;
-	
+
+	/** One (sequential) 3BCID contractor per thread in parallel mode, NULL otherwise. */
+	Ctc3BCid** shavers;
+
+private:
+	void init_shavers(const Array<Ctc>& ctcs);
 };
 
 } // end namespace ibex
@@ -30,6 +30,29 @@ CtcAcid::CtcAcid(const System& sys, Ctc& ctc, bool optim, int s3b, int scid,
 		system(sys), nbcalls(0), nbctvar(0), ctratio(ct_ratio), nbcidvar(0) ,  nbtuning(0), optim(optim) {
 }
 
+CtcAcid::CtcAcid(const System& sys, const BitSet& cid_vars, const Array<Ctc>& ctcs, bool optim, int s3b, int scid,
+		double var_min_width, double ct_ratio): Ctc3BCid (cid_vars,ctcs,s3b,scid,cid_vars.size(),var_min_width),
+		system(sys), nbcalls(0), nbctvar(0), ctratio(ct_ratio),  nbcidvar(0), nbtuning(0), optim(optim)  {
+}
+
+CtcAcid::CtcAcid(const System& sys, const Array<Ctc>& ctcs, bool optim, int s3b, int scid,
+		double var_min_width, double ct_ratio): Ctc3BCid (BitSet::all(sys.nb_var),ctcs,s3b,scid,sys.nb_var,var_min_width),
+		system(sys), nbcalls(0), nbctvar(0), ctratio(ct_ratio), nbcidvar(0) ,  nbtuning(0), optim(optim) {
+}
+
+namespace {
+
+// average gain on the dimensions of box w.r.t. initbox
+double gain(const IntervalVector& initbox, const IntervalVector& box) {
+	double g=0;
+	for (int i=0; i<initbox.size(); i++)
+		if  (initbox[i].diam() !=0 && box[i].diam()!= POS_INFINITY)
+			g += 1  - box[i].diam() / initbox[i].diam();
+	return g / initbox.size();
+}
+
+}
+
 void CtcAcid::contract(IntervalVector& box) {
 
 	int nb_CID_var=cid_vars.size();                    // [gch]
@@ -61,6 +84,25 @@ void CtcAcid::contract(IntervalVector& box) {
 
 	if (vhandled > 0) compute_smearorder(box);         // l'ordre sur les variables est calculé avec la smearsumrel
 	if (optim) putobjfirst();                         // pour l'optim (si optim mis à true dans le constructeur, la dernière variable (objectf) est mise en premier
+
+	if (shavers) {                                     // parallel mode: rounds of (at most) nb_CID_var variables
+		for (int v0=0; v0<vhandled; v0+=nb_CID_var) {
+			int n=vhandled-v0 < nb_CID_var ? vhandled-v0 : nb_CID_var;
+			std::vector<int> vars(smearorder.begin(),smearorder.begin()+n);
+			std::vector<IntervalVector> boxes(n,box);
+			var3BCID_parallel(vars,boxes);             // appel 3BCID sur les variables du tour, sur la même boîte
+			for (int i=0; i<n; i++) {
+				box &= boxes[i];
+				if (box.is_empty()) {
+					delete [] ctstat;
+					return;
+				}
+				if (nbcall1 < nbinitcalls)             // stats: gain de l'intersection des i premières boîtes
+					ctstat[v0+i] = gain(initbox,box);
+				initbox=box;
+			}
+		}
+	} else
 	for (int v=0; v<vhandled; v++) {
 		int v1=v%nb_CID_var;                               // [gch] how can v be < nb_var?? [bne]  vhandled can be between 0 and nbvarmax
 		int v2=smearorder[v1];
@@ -68,17 +110,14 @@ void CtcAcid::contract(IntervalVector& box) {
 		var3BCID(box, v2);                             // appel 3BCID sur la variable v2
 		impact.remove(v2);
 
-		if(box.is_empty()) return;
-
-		if (nbcall1 < nbinitcalls) {                   // on fait des stats pour le réglage courant
-			for (int i=0; i<initbox.size(); i++)
-			{//cout << i << " initbox " << initbox[i].diam() << " box " << box[i].diam() << endl;
-				if  (initbox[i].diam() !=0 && box[i].diam()!= POS_INFINITY)
-					// gain sur la ième dimension de la boîte courante après var3BCID sur la v-ième variable
-					ctstat[v] += 1  - box[i].diam() / initbox[i].diam();}
-			ctstat[v]=ctstat[v]/ initbox.size();   // gain moyen
+		if(box.is_empty()) {
+			delete [] ctstat;
+			return;
 		}
 
+		if (nbcall1 < nbinitcalls)                     // on fait des stats pour le réglage courant
+			ctstat[v] = gain(initbox,box);             // gain moyen après var3BCID sur la v-ième variable
+
 		initbox=box;
 	}
 
@@ -62,6 +62,31 @@ public :
     CtcAcid(const System& sys, Ctc& ctc, bool optim=false, int s3b=default_s3b, int scid=default_scid,
 	    double var_min_width=default_var_min_width, double ct_ratio=default_ctratio);
 
+	/**
+	 * \brief Parallel ACID.
+	 *
+	 * The shavings are performed concurrently, with one sub-contractor
+	 * per thread (see #Ctc3BCid::Ctc3BCid(const BitSet&, const Array<Ctc>&, int, int, int, double)).
+	 *
+	 * The statistics that determine the number of variables to be shaved
+	 * are the same as in the sequential case: the gain of the ith variable
+	 * is measured between the intersection of the boxes obtained for the
+	 * i-1 first variables (in the smear order) and the intersection of the
+	 * boxes obtained for the i first variables. So they do not depend on
+	 * the number of threads nor on their scheduling.
+	 *
+	 * \param ctcs - one sub-contractor per thread (the other parameters are the
+	 *               same as in the sequential case).
+	 */
+	CtcAcid(const System& sys, const BitSet& cid_vars, const Array<Ctc>& ctcs, bool optim=false, int s3b=default_s3b, int scid=default_scid,
+	    double var_min_width=default_var_min_width, double ct_ratio=default_ctratio);
+
+	/**
+	 * \brief Parallel ACID on all variables.
+	 */
+	CtcAcid(const System& sys, const Array<Ctc>& ctcs, bool optim=false, int s3b=default_s3b, int scid=default_scid,
+	    double var_min_width=default_var_min_width, double ct_ratio=default_ctratio);
+
 	/**
 	 * \brief the contraction function
 	 *
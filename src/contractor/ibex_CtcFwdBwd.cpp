@@ -13,39 +13,39 @@
 
 namespace ibex {
 
-CtcFwdBwd::CtcFwdBwd(Function& f, const Domain& y) : Ctc(f.nb_var()), f(f), d(f.expr().dim) {
+CtcFwdBwd::CtcFwdBwd(Function& f, const Domain& y) : Ctc(f.nb_var()), f(f), d(f.expr().dim), incremental(false) {
 	assert(f.expr().dim==y.dim);
 	d = y;
 
 	init();
 }
 
-CtcFwdBwd::CtcFwdBwd(Function& f, const Interval& y) : Ctc(f.nb_var()), f(f), d(Dim()) {
+CtcFwdBwd::CtcFwdBwd(Function& f, const Interval& y) : Ctc(f.nb_var()), f(f), d(Dim()), incremental(false) {
 	assert(f.expr().dim==d.dim);
 	d.i() = y;
 
 	init();
 }
 
-CtcFwdBwd::CtcFwdBwd(Function& f, const IntervalVector& y) : Ctc(f.nb_var()), f(f), d(f.expr().dim) {
+CtcFwdBwd::CtcFwdBwd(Function& f, const IntervalVector& y) : Ctc(f.nb_var()), f(f), d(f.expr().dim), incremental(false) {
 	assert(f.expr().dim.is_vector() && f.expr().dim.vec_size()==y.size());
 	d.v() = y;
 
 	init();
 }
 
-CtcFwdBwd::CtcFwdBwd(Function& f, const IntervalMatrix& y) : Ctc(f.nb_var()), f(f), d(f.expr().dim) {
+CtcFwdBwd::CtcFwdBwd(Function& f, const IntervalMatrix& y) : Ctc(f.nb_var()), f(f), d(f.expr().dim), incremental(false) {
 	assert(f.expr().dim==Dim::matrix(y.nb_rows(),y.nb_cols()));
 	d.m() = y;
 
 	init();
 }
 
-CtcFwdBwd::CtcFwdBwd(Function& f, CmpOp op) : Ctc(f.nb_var()), f(f), d(NumConstraint(f,op).right_hand_side())  {
+CtcFwdBwd::CtcFwdBwd(Function& f, CmpOp op) : Ctc(f.nb_var()), f(f), d(NumConstraint(f,op).right_hand_side()), incremental(false)  {
 	init();
 }
 
-CtcFwdBwd::CtcFwdBwd(const NumConstraint& ctr) : Ctc(ctr.f.nb_var()), f(ctr.f), d(ctr.right_hand_side()) {
+CtcFwdBwd::CtcFwdBwd(const NumConstraint& ctr) : Ctc(ctr.f.nb_var()), f(ctr.f), d(ctr.right_hand_side()), incremental(false) {
 	init();
 }
 
@@ -72,7 +72,7 @@ void CtcFwdBwd::contract(IntervalVector& box) {
 	assert(box.size()==f.nb_var());
 
 	//std::cout << " hc4 of " << f << "=" << d << " with box=" << box << std::endl;
-	if (f.backward(d,box)) {
+	if (f.hc4revise().proj(d,box,incremental)) {
 		set_flag(INACTIVE);
 		set_flag(FIXPOINT);
 	}
@@ -81,6 +81,17 @@ public:
 	/** The domain "y". */
 	Domain d;
 
+	/**
+	 * \brief Incremental mode.
+	 *
+	 * If true, the forward evaluation of f only recomputes the nodes
+	 * that depend on the variables modified since the last call
+	 * (see #ibex::HC4Revise::proj(const Domain&, IntervalVector&, bool)).
+	 * Useful when f is large and the contractor is called inside
+	 * a propagation loop. False by default.
+	 */
+	bool incremental;
+
 protected:
 	void init();
 };
@@ -10,13 +10,30 @@
 
 #include "ibex_CtcNewton.h"
 #include "ibex_Exception.h"
+#include "ibex_Function.h"
 
 namespace ibex {
 
+namespace {
+
+bool is_sparse(const Fnc& f) {
+	const Function* fn=dynamic_cast<const Function*>(&f);
+	if (!fn || fn->nb_var()<SPARSE_NEWTON_MIN_DIM) return false;
+
+	const std::vector<std::vector<int> >& pattern=fn->jacobian_pattern();
+	long nnz=0;
+	for (unsigned int i=0; i<pattern.size(); i++)
+		nnz+=pattern[i].size();
+
+	return 10*nnz < ((long) fn->nb_var())*fn->image_dim();
+}
+
+}
+
 const double CtcNewton::default_ceil = 0.01;
 
-CtcNewton::CtcNewton(const Fnc& f, double ceil, double prec, double ratio) :
-		Ctc(f.nb_var()), f(f), vars(NULL), ceil(ceil), prec(prec), gauss_seidel_ratio(ratio) {
+CtcNewton::CtcNewton(const Fnc& f, double ceil, double prec, double ratio, bool sparse) :
+		Ctc(f.nb_var()), f(f), vars(NULL), ceil(ceil), prec(prec), gauss_seidel_ratio(ratio), sparse(sparse && is_sparse(f)) {
 
 	if (f.nb_var()!=f.image_dim()) {
 		not_implemented("Newton operator with rectangular systems.");
@@ -24,7 +41,7 @@ CtcNewton::CtcNewton(const Fnc& f, double ceil, double prec, double ratio) :
 }
 
 CtcNewton::CtcNewton(const Fnc& f, const VarSet& vars, double ceil, double prec, double ratio) :
-		Ctc(f.nb_var()), f(f), vars(&vars), ceil(ceil), prec(prec), gauss_seidel_ratio(ratio) {
+		Ctc(f.nb_var()), f(f), vars(&vars), ceil(ceil), prec(prec), gauss_seidel_ratio(ratio), sparse(false) {
 
 	if (vars.nb_var!=f.image_dim()) {
 		not_implemented("Newton operator with rectangular systems.");
@@ -34,7 +51,13 @@ CtcNewton::CtcNewton(const Fnc& f, const VarSet& vars, double ceil, double prec,
 void CtcNewton::contract(IntervalVector& box) {
 	if (!(box.max_diam()<=ceil)) return;
 	else {
-		if (!vars)
+		if (sparse) {
+			// if the sparse variant fails (e.g., a null diagonal entry
+			// in the midpoint matrix), the dense variant is applied
+			if (!sparse_newton((const Function&) f,box,prec,gauss_seidel_ratio) && !box.is_empty())
+				newton(f,box,prec,gauss_seidel_ratio);
+		}
+		else if (!vars)
 			newton(f,box,prec,gauss_seidel_ratio);
 		else
 			newton(f,*vars,box,prec,gauss_seidel_ratio);
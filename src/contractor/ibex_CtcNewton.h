@@ -31,11 +31,14 @@ public:
 	 *  computations of the Jacobian matrix for wide boxes.
 	 *
 	 *  Default value is #default_ceil.
+	 * \param sparse - If true, the sparse variant of Newton is used when the Jacobian
+	 *  matrix of f is sparse (see #sparse). Default value is false.
 	 */
 	CtcNewton(const Fnc& f,
 			double ceil=default_ceil,
 			double prec=default_newton_prec,
-			double ratio=default_gauss_seidel_ratio);
+			double ratio=default_gauss_seidel_ratio,
+			bool sparse=false);
 
 
 	/**
@@ -66,6 +69,22 @@ public:
 	/** Gauss-Seidel ratio. See #ibex::newton(const Fnc&, IntervalVector&, double, double);*/
 	const double gauss_seidel_ratio;
 
+	/**
+	 * True if the sparse variant of Newton is used.
+	 *
+	 * This is the case when the sparse variant is required (see the constructor),
+	 * f is a #ibex::Function, all the variables are considered, there are at least
+	 * #SPARSE_NEWTON_MIN_DIM variables and less than 10% of the entries of the
+	 * Jacobian matrix are structural nonzeros.
+	 * See #ibex::sparse_newton(const Function&, IntervalVector&, double, double).
+	 *
+	 * The preconditioning of the sparse variant only uses the diagonal of the
+	 * Jacobian matrix, which fails if the equations are not ordered as
+	 * the variables. So, if the sparse variant does not contract the box, the
+	 * dense one is applied.
+	 */
+	const bool sparse;
+
 	/** Initialized to 0.01 */
 	static const double default_ceil;
 
@@ -34,23 +34,40 @@ CtcPropag::CtcPropag(const Array<Ctc>& cl, double ratio, bool incremental) :
 			if (list[i].input && (*list[i].output)[j]) g.add_arc(i,j,false);
 		}
 
+	g.build();
+
+	pending = new bool[g.nb_input_arcs()];
+
 	//cout << g << endl;
 }
 
+CtcPropag::~CtcPropag() {
+	delete[] pending;
+}
+
+void CtcPropag::wake(int v, int c) {
+	const int* ctrs=g.output_ctrs(v);
+	const int* arcs=g.output_arcs(v);
+
+	for (int i=0; i<g.nb_output_ctrs(v); i++) {
+		int c2=ctrs[i];
+		if ((c!=c2 && active[c2]) || (c==c2 && !flags[FIXPOINT])) {
+			agenda.push(c2);
+			pending[arcs[i]]=true;
+		}
+	}
+}
 
 void CtcPropag::contract(IntervalVector& box) {
 
 	assert(box.size()==nb_var);
 
 	/*
-	 * When we call a contractor, we assume all
-	 * its variables have been impacted although there might be
-	 * only one of them impacted. In a future version, we may
-	 * consider a more fine propagation where the information
-	 * about the variables that are actually impacted is
-	 * given to the awaken contractor.
+	 * When we call a contractor, we give it the set of its
+	 * input variables that have actually been modified since
+	 * its last call (the "pending" arcs).
 	 */
-	_impact.fill(0,nb_var-1);
+	_impact.clear();
 
 	// By default, all contractors are active
 	active.fill(0,list.size()-1);
@@ -67,15 +84,17 @@ void CtcPropag::contract(IntervalVector& box) {
 		 * and this one turns to be slightly more efficient.
 		 * Maybe we should do the same when incremental==false.
 		 */
+		for (int a=0; a<g.nb_input_arcs(); a++)
+			pending[a]=false;
 
 		for (int i=0; i<nb_var; i++) {
-			if (!impact() || (*impact())[i]) {
-				set<int> ctrs=g.output_ctrs(i);
-				for (set<int>::iterator c=ctrs.begin(); c!=ctrs.end(); c++)
-					agenda.push(*c);
-			}
+			if (!impact() || (*impact())[i])
+				wake(i,-1);
 		}
 	} else { // push all the contractors
+		for (int a=0; a<g.nb_input_arcs(); a++)
+			pending[a]=true;
+
 		for (int i=0; i<list.size(); i++)
 			agenda.push(i);
 	}
@@ -99,22 +118,36 @@ void CtcPropag::contract(IntervalVector& box) {
 
 		agenda.pop(c);
 
-		set<int> vars=g.output_vars(c);
+		const int* vars=g.output_vars(c);
+		int nb_vars=g.nb_output_vars(c);
 
 		// ===================== fine propagation =========================
 		// reset the old box to the current domains just before contraction
 		if (!accumulate) {
-			for (set<int>::iterator v=vars.begin(); v!=vars.end(); v++) {
-				old_box[*v] = box[*v];
+			for (int i=0; i<nb_vars; i++) {
+				old_box[vars[i]] = box[vars[i]];
 			}
 		}
 		// ================================================================
 
 		//cout << "Contraction with " << c << endl;
 
+		// impact given to the contractor
+		const int* in=g.input_vars(c);
+		int nb_in=g.nb_input_vars(c);
+		bool* p=pending+g.first_input_arc(c);
+
+		for (int i=0; i<nb_in; i++)
+			if (p[i]) {
+				_impact.add(in[i]);
+				p[i]=false;
+			}
 
 		list[c].contract(box, _impact, flags);
 
+		for (int i=0; i<nb_in; i++)
+			_impact.remove(in[i]);
+
 		if (box.is_empty()) {
 			agenda.flush();
 			//cout << "=========== End propagation ==========" << endl;
@@ -126,16 +159,12 @@ void CtcPropag::contract(IntervalVector& box) {
 			active.remove(c);
 		}
 
-		for (set<int>::iterator it=vars.begin(); it!=vars.end(); it++) {
-			int v=*it;
+		for (int i=0; i<nb_vars; i++) {
+			int v=vars[i];
 			//cout << "   " << old_box[v] << " % " << box[v] << "   " << old_box[v].ratiodelta(box[v]) << endl;
 			//if (old_box[v].rel_distance(box[v])>=ratio) {
 			if (old_box[v].ratiodelta(box[v])>=ratio) {
-				set<int> ctrs=g.output_ctrs(v);
-				for (set<int>::iterator c2=ctrs.begin(); c2!=ctrs.end(); c2++) {
-					if ((c!=*c2 && active[*c2]) || (c==*c2 && !flags[FIXPOINT]))
-						agenda.push(*c2);
-				}
+				wake(v,c);
 				// ===================== coarse propagation =========================
 				// reset the old box to the current domains just after propagation
 				if (accumulate)
@@ -74,8 +74,18 @@ public:
 	/** Default ratio used by propagation, set to 0.1. */
 	static const double default_ratio;
 
+	/**
+	 * \brief Delete this.
+	 */
+	virtual ~CtcPropag();
+
 protected:
 
+	/*
+	 * Push into the agenda the contractors impacted by a variable
+	 * modified by the contractor c (-1 if none).
+	 */
+	void wake(int v, int c);
 
 	DirectedHyperGraph g; // constraint network (hypergraph)
 
@@ -83,11 +93,14 @@ protected:
 
 	BitSet _impact;     // impact given to sub-contractors
 
+	bool* pending;      // pending[a]=true if the extremity of the arc a=(var->ctr)
+	                    // has been modified since the last call to ctr
+	                    // (see DirectedHyperGraph::first_input_arc)
+
 	BitSet flags;       // status of a contraction
 
 	BitSet active;      // mark active sub-contractors
 
-
 };
 
 } // namespace ibex
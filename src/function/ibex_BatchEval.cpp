@@ -0,0 +1,526 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BatchEval.cpp
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_BatchEval.h"
+
+#include <fenv.h>
+#include <cassert>
+
+#if defined(__AVX512F__) || defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+const int BatchEval::DEFAULT_BLOCK_SIZE=128;
+
+namespace {
+
+/*
+ * SIMD vectors of doubles.
+ *
+ * The rounding direction is the one of the FPU: lower bounds are calculated
+ * in a first pass with rounding towards -oo and upper bounds in a second pass
+ * with rounding towards +oo.
+ */
+#if defined(__AVX512F__)
+
+typedef __m512d vdouble;
+const int VSIZE=8;
+inline vdouble vload(const double* x)         { return _mm512_loadu_pd(x); }
+inline void vstore(double* x, vdouble a)      { _mm512_storeu_pd(x,a); }
+inline vdouble vzero()                        { return _mm512_setzero_pd(); }
+inline vdouble vadd(vdouble a, vdouble b)     { return _mm512_add_pd(a,b); }
+inline vdouble vsub(vdouble a, vdouble b)     { return _mm512_sub_pd(a,b); }
+inline vdouble vmul(vdouble a, vdouble b)     { return _mm512_mul_pd(a,b); }
+inline vdouble vmin(vdouble a, vdouble b)     { return _mm512_min_pd(a,b); }
+inline vdouble vmax(vdouble a, vdouble b)     { return _mm512_max_pd(a,b); }
+inline vdouble vnan2zero(vdouble a)           { return _mm512_maskz_mov_pd(_mm512_cmp_pd_mask(a,a,_CMP_ORD_Q),a); }
+
+#elif defined(__AVX__)
+
+typedef __m256d vdouble;
+const int VSIZE=4;
+inline vdouble vload(const double* x)         { return _mm256_loadu_pd(x); }
+inline void vstore(double* x, vdouble a)      { _mm256_storeu_pd(x,a); }
+inline vdouble vzero()                        { return _mm256_setzero_pd(); }
+inline vdouble vadd(vdouble a, vdouble b)     { return _mm256_add_pd(a,b); }
+inline vdouble vsub(vdouble a, vdouble b)     { return _mm256_sub_pd(a,b); }
+inline vdouble vmul(vdouble a, vdouble b)     { return _mm256_mul_pd(a,b); }
+inline vdouble vmin(vdouble a, vdouble b)     { return _mm256_min_pd(a,b); }
+inline vdouble vmax(vdouble a, vdouble b)     { return _mm256_max_pd(a,b); }
+inline vdouble vnan2zero(vdouble a)           { return _mm256_and_pd(a,_mm256_cmp_pd(a,a,_CMP_ORD_Q)); }
+
+#elif defined(__SSE2__)
+
+typedef __m128d vdouble;
+const int VSIZE=2;
+inline vdouble vload(const double* x)         { return _mm_loadu_pd(x); }
+inline void vstore(double* x, vdouble a)      { _mm_storeu_pd(x,a); }
+inline vdouble vzero()                        { return _mm_setzero_pd(); }
+inline vdouble vadd(vdouble a, vdouble b)     { return _mm_add_pd(a,b); }
+inline vdouble vsub(vdouble a, vdouble b)     { return _mm_sub_pd(a,b); }
+inline vdouble vmul(vdouble a, vdouble b)     { return _mm_mul_pd(a,b); }
+inline vdouble vmin(vdouble a, vdouble b)     { return _mm_min_pd(a,b); }
+inline vdouble vmax(vdouble a, vdouble b)     { return _mm_max_pd(a,b); }
+inline vdouble vnan2zero(vdouble a)           { return _mm_and_pd(a,_mm_cmpord_pd(a,a)); }
+
+#else
+
+typedef double vdouble;
+const int VSIZE=1;
+inline vdouble vload(const double* x)         { return *x; }
+inline void vstore(double* x, vdouble a)      { *x=a; }
+inline vdouble vzero()                        { return 0.0; }
+inline vdouble vadd(vdouble a, vdouble b)     { return a+b; }
+inline vdouble vsub(vdouble a, vdouble b)     { return a-b; }
+inline vdouble vmul(vdouble a, vdouble b)     { return a*b; }
+inline vdouble vmin(vdouble a, vdouble b)     { return a<b? a : b; }
+inline vdouble vmax(vdouble a, vdouble b)     { return a>b? a : b; }
+inline vdouble vnan2zero(vdouble a)           { return a==a? a : 0.0; }
+
+#endif
+
+inline vdouble vneg(vdouble a)                { return vsub(vzero(),a); }
+
+// 0*oo is NaN in IEEE arithmetic but 0 in interval arithmetic
+inline vdouble vprod(vdouble a, vdouble b)    { return vnan2zero(vmul(a,b)); }
+
+inline vdouble vmin4(vdouble a, vdouble b, vdouble c, vdouble d) { return vmin(vmin(a,b),vmin(c,d)); }
+inline vdouble vmax4(vdouble a, vdouble b, vdouble c, vdouble d) { return vmax(vmax(a,b),vmax(c,d)); }
+
+// lower/upper bound of the magnitude of x
+inline vdouble vmig(vdouble xl, vdouble xu)   { return vmax(vzero(),vmax(xl,vneg(xu))); }
+inline vdouble vmag(vdouble xl, vdouble xu)   { return vmax(vneg(xl),xu); }
+
+/*
+ * Kernels. All the arrays have n entries, where n is a multiple of VSIZE.
+ * The rounding mode is towards +oo when a kernel returns.
+ */
+void add_kernel(const double* xl, const double* xu, const double* yl, const double* yu, double* zl, double* zu, int n) {
+	fpu_round_down();
+	for (int i=0; i<n; i+=VSIZE)
+		vstore(zl+i, vadd(vload(xl+i),vload(yl+i)));
+	fpu_round_up();
+	for (int i=0; i<n; i+=VSIZE)
+		vstore(zu+i, vadd(vload(xu+i),vload(yu+i)));
+}
+
+void sub_kernel(const double* xl, const double* xu, const double* yl, const double* yu, double* zl, double* zu, int n) {
+	fpu_round_down();
+	for (int i=0; i<n; i+=VSIZE)
+		vstore(zl+i, vsub(vload(xl+i),vload(yu+i)));
+	fpu_round_up();
+	for (int i=0; i<n; i+=VSIZE)
+		vstore(zu+i, vsub(vload(xu+i),vload(yl+i)));
+}
+
+void mul_kernel(const double* xl, const double* xu, const double* yl, const double* yu, double* zl, double* zu, int n) {
+	fpu_round_down();
+	for (int i=0; i<n; i+=VSIZE) {
+		vdouble a=vload(xl+i), b=vload(xu+i), c=vload(yl+i), d=vload(yu+i);
+		vstore(zl+i, vmin4(vprod(a,c),vprod(a,d),vprod(b,c),vprod(b,d)));
+	}
+	fpu_round_up();
+	for (int i=0; i<n; i+=VSIZE) {
+		vdouble a=vload(xl+i), b=vload(xu+i), c=vload(yl+i), d=vload(yu+i);
+		vstore(zu+i, vmax4(vprod(a,c),vprod(a,d),vprod(b,c),vprod(b,d)));
+	}
+}
+
+void sqr_kernel(const double* xl, const double* xu, double* zl, double* zu, int n) {
+	fpu_round_down();
+	for (int i=0; i<n; i+=VSIZE) {
+		vdouble a=vmig(vload(xl+i),vload(xu+i));
+		vstore(zl+i, vmul(a,a));
+	}
+	fpu_round_up();
+	for (int i=0; i<n; i+=VSIZE) {
+		vdouble a=vmag(vload(xl+i),vload(xu+i));
+		vstore(zu+i, vmul(a,a));
+	}
+}
+
+// the following kernels are exact (no rounding)
+
+void minus_kernel(const double* xl, const double* xu, double* zl, double* zu, int n) {
+	for (int i=0; i<n; i+=VSIZE) {
+		vdouble a=vload(xl+i), b=vload(xu+i);
+		vstore(zl+i, vneg(b));
+		vstore(zu+i, vneg(a));
+	}
+}
+
+void abs_kernel(const double* xl, const double* xu, double* zl, double* zu, int n) {
+	for (int i=0; i<n; i+=VSIZE) {
+		vdouble a=vload(xl+i), b=vload(xu+i);
+		vstore(zl+i, vmig(a,b));
+		vstore(zu+i, vmag(a,b));
+	}
+}
+
+void min_kernel(const double* xl, const double* xu, const double* yl, const double* yu, double* zl, double* zu, int n) {
+	for (int i=0; i<n; i+=VSIZE) {
+		vstore(zl+i, vmin(vload(xl+i),vload(yl+i)));
+		vstore(zu+i, vmin(vload(xu+i),vload(yu+i)));
+	}
+}
+
+void max_kernel(const double* xl, const double* xu, const double* yl, const double* yu, double* zl, double* zu, int n) {
+	for (int i=0; i<n; i+=VSIZE) {
+		vstore(zl+i, vmax(vload(xl+i),vload(yl+i)));
+		vstore(zu+i, vmax(vload(xu+i),vload(yu+i)));
+	}
+}
+
+/*
+ * Operations performed box by box. We need plain function
+ * pointers (some of the interval functions are overloaded).
+ */
+Interval _div  (const Interval& x, const Interval& y) { return x/y; }
+Interval _atan2(const Interval& x, const Interval& y) { return atan2(x,y); }
+Interval _sign (const Interval& x) { return sign(x); }
+Interval _sqrt (const Interval& x) { return sqrt(x); }
+Interval _exp  (const Interval& x) { return exp(x); }
+Interval _log  (const Interval& x) { return log(x); }
+Interval _cos  (const Interval& x) { return cos(x); }
+Interval _sin  (const Interval& x) { return sin(x); }
+Interval _tan  (const Interval& x) { return tan(x); }
+Interval _cosh (const Interval& x) { return cosh(x); }
+Interval _sinh (const Interval& x) { return sinh(x); }
+Interval _tanh (const Interval& x) { return tanh(x); }
+Interval _acos (const Interval& x) { return acos(x); }
+Interval _asin (const Interval& x) { return asin(x); }
+Interval _atan (const Interval& x) { return atan(x); }
+Interval _acosh(const Interval& x) { return acosh(x); }
+Interval _asinh(const Interval& x) { return asinh(x); }
+Interval _atanh(const Interval& x) { return atanh(x); }
+
+/*
+ * True if the batch mode can handle the node e.
+ */
+bool batch_node(const ExprNode& e, bool root) {
+	if (dynamic_cast<const ExprSymbol*>(&e))
+		return true;
+
+	if (const ExprIndex* idx=dynamic_cast<const ExprIndex*>(&e))
+		return e.dim.is_scalar() && dynamic_cast<const ExprSymbol*>(&idx->expr);
+
+	if (const ExprVector* vec=dynamic_cast<const ExprVector*>(&e)) {
+		if (!root) return false;
+		for (int i=0; i<vec->nb_args; i++)
+			if (!vec->arg(i).dim.is_scalar()) return false;
+		return true;
+	}
+
+	if (!e.dim.is_scalar()) return false;
+
+	if (dynamic_cast<const ExprConstant*>(&e))
+		return true;
+
+	if (const ExprBinaryOp* b=dynamic_cast<const ExprBinaryOp*>(&e))
+		return b->left.dim.is_scalar() && b->right.dim.is_scalar();
+
+	if (const ExprUnaryOp* u=dynamic_cast<const ExprUnaryOp*>(&e))
+		return u->expr.dim.is_scalar() && !dynamic_cast<const ExprTrans*>(&e);
+
+	// apply, chi, etc.
+	return false;
+}
+
+/*
+ * Index of a component of a symbol in the box.
+ */
+int flat_index(const Dim& dim, const DoubleIndex& idx) {
+	switch (dim.type()) {
+	case Dim::COL_VECTOR: return idx.first_row();
+	case Dim::ROW_VECTOR: return idx.first_col();
+	default:              return idx.first_row()*dim.nb_cols()+idx.first_col();
+	}
+}
+
+} // end anonymous namespace
+
+BatchEval::BatchEval(Function& f, int block_size) : f(f), block_size(block_size),
+		_vectorized(true), nb_nodes(f.nodes.size()), m(f.image_dim()), var(new int[nb_nodes]),
+		out(new int[m]), size(0), width(0), stride(((block_size+VSIZE-1)/VSIZE)*VSIZE),
+		mem(NULL), _lb(NULL), _ub(NULL), empty(new bool[block_size]), some_empty(false), round(fegetround()) {
+
+	assert(block_size>0);
+
+	int root=f.nodes.rank(f.expr());
+
+	// first variable of each symbol in the box
+	int* offset=new int[f.nb_arg()];
+	for (int k=0, i=0; k<f.nb_arg(); k++) {
+		offset[k]=i;
+		i+=f.arg(k).dim.size();
+	}
+
+	for (int y=0; y<nb_nodes; y++) {
+		const ExprNode& e=f.node(y);
+
+		var[y]=-1;
+
+		if (!batch_node(e, y==root)) {
+			_vectorized=false;
+			continue;
+		}
+
+		if (const ExprSymbol* s=dynamic_cast<const ExprSymbol*>(&e)) {
+			if (e.dim.is_scalar()) var[y]=offset[s->key];
+		} else if (const ExprIndex* idx=dynamic_cast<const ExprIndex*>(&e)) {
+			const ExprSymbol& s=(const ExprSymbol&) idx->expr;
+			var[y]=offset[s.key]+flat_index(s.dim, idx->index);
+		}
+	}
+
+	delete[] offset;
+
+	if (f.expr().dim.is_matrix()) _vectorized=false;
+
+	if (!_vectorized) return;
+
+	if (m==1 && f.expr().dim.is_scalar())
+		out[0]=root;
+	else {
+		const ExprVector& vec=(const ExprVector&) f.expr();
+		for (int i=0; i<m; i++)
+			out[i]=f.nodes.rank(vec.arg(i));
+	}
+
+	// 64 extra bytes for alignment
+	mem=new char[2*nb_nodes*stride*sizeof(double)+64];
+	_lb=(double*) (((size_t) mem + 63) & ~((size_t) 63));
+	_ub=_lb+nb_nodes*stride;
+
+	for (int i=0; i<2*nb_nodes*stride; i++) _lb[i]=0;
+
+	// constants are loaded once for all
+	for (int y=0; y<nb_nodes; y++) {
+		if (const ExprConstant* c=dynamic_cast<const ExprConstant*>(&f.node(y))) {
+			for (int i=0; i<stride; i++) {
+				lb(y)[i]=c->get_value().lb();
+				ub(y)[i]=c->get_value().ub();
+			}
+		}
+	}
+}
+
+BatchEval::~BatchEval() {
+	delete[] var;
+	delete[] out;
+	delete[] empty;
+	if (mem) delete[] mem;
+}
+
+IntervalVector BatchEval::eval(const IntervalMatrix& boxes) {
+	assert(f.expr().dim.is_scalar());
+	assert(boxes.nb_cols()==f.nb_var());
+
+	int n=boxes.nb_rows();
+	IntervalVector res(n);
+
+	if (!_vectorized) {
+		for (int i=0; i<n; i++)
+			res[i]=f.eval(boxes[i]);
+		return res;
+	}
+
+	IntervalMatrix M(n,1);
+	for (int i=0; i<n; i+=block_size)
+		eval_block(boxes, i, n-i<block_size? n-i : block_size, M);
+
+	for (int i=0; i<n; i++)
+		res[i]=M[i][0];
+	return res;
+}
+
+IntervalMatrix BatchEval::eval_vector(const IntervalMatrix& boxes) {
+	assert(!f.expr().dim.is_matrix());
+	assert(boxes.nb_cols()==f.nb_var());
+
+	int n=boxes.nb_rows();
+	IntervalMatrix res(n,m);
+
+	if (!_vectorized) {
+		for (int i=0; i<n; i++)
+			res[i]=f.eval_vector(boxes[i]);
+		return res;
+	}
+
+	for (int i=0; i<n; i+=block_size)
+		eval_block(boxes, i, n-i<block_size? n-i : block_size, res);
+
+	return res;
+}
+
+void BatchEval::eval_block(const IntervalMatrix& boxes, int first, int n, IntervalMatrix& res) {
+
+	size=n;
+	width=((n+VSIZE-1)/VSIZE)*VSIZE;
+	some_empty=false;
+
+	for (int i=0; i<n; i++)
+		empty[i]=boxes[first+i].is_empty();
+
+	// load the variables
+	for (int y=0; y<nb_nodes; y++) {
+		if (var[y]==-1) continue;
+		double* l=lb(y);
+		double* u=ub(y);
+		int j=var[y];
+		for (int i=0; i<n; i++) {
+			if (empty[i]) {
+				l[i]=u[i]=0;
+				some_empty=true;
+			} else {
+				const Interval& x=boxes[first+i][j];
+				l[i]=x.lb();
+				u[i]=x.ub();
+			}
+		}
+		// padding
+		for (int i=n; i<width; i++)
+			l[i]=u[i]=0;
+	}
+
+	// the rounding mode is modified by the kernels
+	round=fegetround();
+
+	f.forward<BatchEval>(*this);
+
+	fesetround(round);
+
+	for (int k=0; k<m; k++) {
+		double* l=lb(out[k]);
+		double* u=ub(out[k]);
+		for (int i=0; i<n; i++)
+			res[first+i][k]=Interval(l[i],u[i]);
+	}
+
+	if (some_empty)
+		for (int i=0; i<n; i++)
+			if (empty[i]) res[first+i].set_empty();
+}
+
+void BatchEval::set_empty(int i) {
+	empty[i]=true;
+	some_empty=true;
+}
+
+void BatchEval::unary_fwd(Interval (*op)(const Interval&), int x, int y) {
+	double *xl=lb(x), *xu=ub(x), *yl=lb(y), *yu=ub(y);
+
+	// the interval operations are only valid in the rounding mode of the caller
+	// (e.g., to nearest with --interval-lib=eft) and a kernel may have changed it.
+	fesetround(round);
+
+	for (int i=0; i<size; i++) {
+		Interval r=empty[i]? Interval::EMPTY_SET : op(Interval(xl[i],xu[i]));
+		if (r.is_empty()) {
+			// the box is outside the definition domain
+			set_empty(i);
+			yl[i]=yu[i]=0;
+		} else {
+			yl[i]=r.lb();
+			yu[i]=r.ub();
+		}
+	}
+}
+
+void BatchEval::binary_fwd(Interval (*op)(const Interval&, const Interval&), int x1, int x2, int y) {
+	double *xl1=lb(x1), *xu1=ub(x1), *xl2=lb(x2), *xu2=ub(x2), *yl=lb(y), *yu=ub(y);
+
+	fesetround(round); // see unary_fwd
+
+	for (int i=0; i<size; i++) {
+		Interval r=empty[i]? Interval::EMPTY_SET : op(Interval(xl1[i],xu1[i]),Interval(xl2[i],xu2[i]));
+		if (r.is_empty()) {
+			set_empty(i);
+			yl[i]=yu[i]=0;
+		} else {
+			yl[i]=r.lb();
+			yu[i]=r.ub();
+		}
+	}
+}
+
+void BatchEval::add_fwd(int x1, int x2, int y) { add_kernel(lb(x1),ub(x1),lb(x2),ub(x2),lb(y),ub(y),width); }
+void BatchEval::sub_fwd(int x1, int x2, int y) { sub_kernel(lb(x1),ub(x1),lb(x2),ub(x2),lb(y),ub(y),width); }
+void BatchEval::mul_fwd(int x1, int x2, int y) { mul_kernel(lb(x1),ub(x1),lb(x2),ub(x2),lb(y),ub(y),width); }
+void BatchEval::min_fwd(int x1, int x2, int y) { min_kernel(lb(x1),ub(x1),lb(x2),ub(x2),lb(y),ub(y),width); }
+void BatchEval::max_fwd(int x1, int x2, int y) { max_kernel(lb(x1),ub(x1),lb(x2),ub(x2),lb(y),ub(y),width); }
+void BatchEval::minus_fwd(int x, int y)        { minus_kernel(lb(x),ub(x),lb(y),ub(y),width); }
+void BatchEval::abs_fwd(int x, int y)          { abs_kernel(lb(x),ub(x),lb(y),ub(y),width); }
+void BatchEval::sqr_fwd(int x, int y)          { sqr_kernel(lb(x),ub(x),lb(y),ub(y),width); }
+
+void BatchEval::div_fwd(int x1, int x2, int y)   { binary_fwd(_div,x1,x2,y); }
+void BatchEval::atan2_fwd(int x1, int x2, int y) { binary_fwd(_atan2,x1,x2,y); }
+void BatchEval::sign_fwd(int x, int y)           { unary_fwd(_sign,x,y); }
+void BatchEval::sqrt_fwd(int x, int y)           { unary_fwd(_sqrt,x,y); }
+void BatchEval::exp_fwd(int x, int y)            { unary_fwd(_exp,x,y); }
+void BatchEval::log_fwd(int x, int y)            { unary_fwd(_log,x,y); }
+void BatchEval::cos_fwd(int x, int y)            { unary_fwd(_cos,x,y); }
+void BatchEval::sin_fwd(int x, int y)            { unary_fwd(_sin,x,y); }
+void BatchEval::tan_fwd(int x, int y)            { unary_fwd(_tan,x,y); }
+void BatchEval::cosh_fwd(int x, int y)           { unary_fwd(_cosh,x,y); }
+void BatchEval::sinh_fwd(int x, int y)           { unary_fwd(_sinh,x,y); }
+void BatchEval::tanh_fwd(int x, int y)           { unary_fwd(_tanh,x,y); }
+void BatchEval::acos_fwd(int x, int y)           { unary_fwd(_acos,x,y); }
+void BatchEval::asin_fwd(int x, int y)           { unary_fwd(_asin,x,y); }
+void BatchEval::atan_fwd(int x, int y)           { unary_fwd(_atan,x,y); }
+void BatchEval::acosh_fwd(int x, int y)          { unary_fwd(_acosh,x,y); }
+void BatchEval::asinh_fwd(int x, int y)          { unary_fwd(_asinh,x,y); }
+void BatchEval::atanh_fwd(int x, int y)          { unary_fwd(_atanh,x,y); }
+
+void BatchEval::power_fwd(int x, int y, int p) {
+	double *xl=lb(x), *xu=ub(x), *yl=lb(y), *yu=ub(y);
+
+	fesetround(round); // see unary_fwd
+
+	for (int i=0; i<size; i++) {
+		Interval r=empty[i]? Interval::EMPTY_SET : pow(Interval(xl[i],xu[i]),p);
+		if (r.is_empty()) {
+			set_empty(i);
+			yl[i]=yu[i]=0;
+		} else {
+			yl[i]=r.lb();
+			yu[i]=r.ub();
+		}
+	}
+}
+
+// the root vector: the components are read directly from the arguments
+void BatchEval::vector_fwd(int*, int) { }
+
+// The following operations are not supported in batch mode
+// (the forward algorithm is not run in this case)
+void BatchEval::apply_fwd(int*, int)                { assert(false); }
+void BatchEval::chi_fwd(int, int, int, int)         { assert(false); }
+void BatchEval::minus_V_fwd(int, int)               { assert(false); }
+void BatchEval::minus_M_fwd(int, int)               { assert(false); }
+void BatchEval::trans_V_fwd(int, int)               { assert(false); }
+void BatchEval::trans_M_fwd(int, int)               { assert(false); }
+void BatchEval::add_V_fwd(int, int, int)            { assert(false); }
+void BatchEval::add_M_fwd(int, int, int)            { assert(false); }
+void BatchEval::mul_SV_fwd(int, int, int)           { assert(false); }
+void BatchEval::mul_SM_fwd(int, int, int)           { assert(false); }
+void BatchEval::mul_VV_fwd(int, int, int)           { assert(false); }
+void BatchEval::mul_MV_fwd(int, int, int)           { assert(false); }
+void BatchEval::mul_VM_fwd(int, int, int)           { assert(false); }
+void BatchEval::mul_MM_fwd(int, int, int)           { assert(false); }
+void BatchEval::sub_V_fwd(int, int, int)            { assert(false); }
+void BatchEval::sub_M_fwd(int, int, int)            { assert(false); }
+
+} // end namespace ibex
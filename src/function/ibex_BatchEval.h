@@ -0,0 +1,233 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_BatchEval.h
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_BATCH_EVAL_H__
+#define __IBEX_BATCH_EVAL_H__
+
+#include "ibex_Function.h"
+#include "ibex_IntervalMatrix.h"
+
+namespace ibex {
+
+/**
+ * \ingroup symbolic
+ *
+ * \brief Evaluation of a function over many boxes at a time.
+ *
+ * Instead of running the forward algorithm once per box (see #ibex::Eval),
+ * the boxes are processed by blocks: each operation of the function is
+ * applied to all the boxes of a block in a row. The lower and upper bounds
+ * of each node are stored in two separate arrays (one entry per box) so
+ * that basic operations (+,-,*,sqr,abs,min,max) are performed with
+ * SIMD instructions (SSE2, AVX or AVX-512, depending on the compilation
+ * flags) under directed rounding. The other operations are performed
+ * box by box with the interval library.
+ *
+ * This is useful when the same function has to be evaluated on a large
+ * number of boxes or points (sampling, paving, etc.).
+ *
+ * The batch mode only applies to functions whose nodes are all scalar,
+ * except symbols (whose components can be indexed) and the root node
+ * (which can be a vector of scalar expressions). Calls to other functions
+ * and vector/matrix operations are not supported: in this case, the
+ * evaluation resorts to the standard forward algorithm (see vectorized()).
+ *
+ * As any forward algorithm, an object of this class is not thread-safe.
+ */
+class BatchEval : public FwdAlgorithm {
+
+public:
+	/**
+	 * \brief Default number of boxes per block.
+	 */
+	static const int DEFAULT_BLOCK_SIZE;
+
+	/**
+	 * \brief Build the batch evaluator for the function f.
+	 *
+	 * \param block_size - the number of boxes processed at a time.
+	 */
+	BatchEval(Function& f, int block_size=DEFAULT_BLOCK_SIZE);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~BatchEval();
+
+	/**
+	 * \brief Evaluate a real-valued function over several boxes.
+	 *
+	 * \param boxes - one box per row.
+	 * \return      - the ith component is the image of the ith box.
+	 */
+	IntervalVector eval(const IntervalMatrix& boxes);
+
+	/**
+	 * \brief Evaluate a vector-valued function over several boxes.
+	 *
+	 * \param boxes - one box per row.
+	 * \return      - the ith row is the image of the ith box.
+	 */
+	IntervalMatrix eval_vector(const IntervalMatrix& boxes);
+
+	/**
+	 * \brief True if the batch mode applies to the function.
+	 */
+	bool vectorized() const;
+
+	/**
+	 * \brief The function.
+	 */
+	Function& f;
+
+	/**
+	 * \brief Number of boxes per block.
+	 */
+	const int block_size;
+
+public: // because called from CompiledFunction
+
+	       void vector_fwd (int* x, int y);
+	       void apply_fwd  (int* x, int y);
+	inline void idx_fwd    (int x, int y);
+	inline void idx_cp_fwd (int x, int y);
+	inline void symbol_fwd (int y);
+	inline void cst_fwd    (int y);
+	       void chi_fwd    (int x1, int x2, int x3, int y);
+	       void add_fwd    (int x1, int x2, int y);
+	       void mul_fwd    (int x1, int x2, int y);
+	       void sub_fwd    (int x1, int x2, int y);
+	       void div_fwd    (int x1, int x2, int y);
+	       void max_fwd    (int x1, int x2, int y);
+	       void min_fwd    (int x1, int x2, int y);
+	       void atan2_fwd  (int x1, int x2, int y);
+	       void minus_fwd  (int x, int y);
+	       void minus_V_fwd(int x, int y);
+	       void minus_M_fwd(int x, int y);
+	       void trans_V_fwd(int x, int y);
+	       void trans_M_fwd(int x, int y);
+	       void sign_fwd   (int x, int y);
+	       void abs_fwd    (int x, int y);
+	       void power_fwd  (int x, int y, int p);
+	       void sqr_fwd    (int x, int y);
+	       void sqrt_fwd   (int x, int y);
+	       void exp_fwd    (int x, int y);
+	       void log_fwd    (int x, int y);
+	       void cos_fwd    (int x, int y);
+	       void sin_fwd    (int x, int y);
+	       void tan_fwd    (int x, int y);
+	       void cosh_fwd   (int x, int y);
+	       void sinh_fwd   (int x, int y);
+	       void tanh_fwd   (int x, int y);
+	       void acos_fwd   (int x, int y);
+	       void asin_fwd   (int x, int y);
+	       void atan_fwd   (int x, int y);
+	       void acosh_fwd  (int x, int y);
+	       void asinh_fwd  (int x, int y);
+	       void atanh_fwd  (int x, int y);
+	       void add_V_fwd  (int x1, int x2, int y);
+	       void add_M_fwd  (int x1, int x2, int y);
+	       void mul_SV_fwd (int x1, int x2, int y);
+	       void mul_SM_fwd (int x1, int x2, int y);
+	       void mul_VV_fwd (int x1, int x2, int y);
+	       void mul_MV_fwd (int x1, int x2, int y);
+	       void mul_VM_fwd (int x1, int x2, int y);
+	       void mul_MM_fwd (int x1, int x2, int y);
+	       void sub_V_fwd  (int x1, int x2, int y);
+	       void sub_M_fwd  (int x1, int x2, int y);
+
+protected:
+
+	/**
+	 * Evaluate the function on the rows first...first+n-1 of "boxes"
+	 * and store the result in the same rows of "res".
+	 */
+	void eval_block(const IntervalMatrix& boxes, int first, int n, IntervalMatrix& res);
+
+	/**
+	 * Apply a unary interval function box by box.
+	 */
+	void unary_fwd(Interval (*op)(const Interval&), int x, int y);
+
+	/**
+	 * Apply a binary interval function box by box.
+	 */
+	void binary_fwd(Interval (*op)(const Interval&, const Interval&), int x1, int x2, int y);
+
+	/**
+	 * Mark the ith box of the current block as empty (the image is empty).
+	 */
+	void set_empty(int i);
+
+	/** Lower bounds of the node y (one entry per box). */
+	double* lb(int y);
+
+	/** Upper bounds of the node y (one entry per box). */
+	double* ub(int y);
+
+private:
+	BatchEval(const BatchEval&);            // forbidden
+	BatchEval& operator=(const BatchEval&); // forbidden
+
+	bool _vectorized;  // true if the batch mode applies
+
+	int nb_nodes;      // number of nodes of the function
+
+	int m;             // number of components of the image
+
+	int* var;          // for each node, the variable (index in the box) if
+	                   // the node is a scalar symbol or a component of a symbol,
+	                   // -1 otherwise
+
+	int* out;          // the nodes of the image components
+
+	int size;          // number of boxes in the current block
+
+	int width;         // "size" rounded up to a multiple of the SIMD vector size
+
+	int stride;        // allocated number of entries per node (>= block_size)
+
+	char* mem;         // allocated memory
+
+	double* _lb;       // lower bounds (nb_nodes x stride entries)
+
+	double* _ub;       // upper bounds (nb_nodes x stride entries)
+
+	bool* empty;       // for each box of the current block, true if the image is empty
+
+	bool some_empty;   // true if at least one image of the current block is empty
+
+	int round;         // the rounding mode of the caller (the one expected by the
+	                   // interval library), restored before each box-by-box operation
+};
+
+/*============================================ inline implementation ============================================ */
+
+inline bool BatchEval::vectorized() const {
+	return _vectorized;
+}
+
+inline double* BatchEval::lb(int y) {
+	return _lb+y*stride;
+}
+
+inline double* BatchEval::ub(int y) {
+	return _ub+y*stride;
+}
+
+// symbols, components of symbols and constants are loaded
+// before running the forward algorithm.
+inline void BatchEval::idx_fwd(int, int)    { }
+inline void BatchEval::idx_cp_fwd(int, int) { }
+inline void BatchEval::symbol_fwd(int)      { }
+inline void BatchEval::cst_fwd(int)         { }
+
+} // end namespace ibex
+
+#endif // __IBEX_BATCH_EVAL_H__
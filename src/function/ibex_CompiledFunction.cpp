@@ -65,6 +65,58 @@ Agenda* CompiledFunction::agenda(int rank) const {
 	return a;
 }
 
+void CompiledFunction::scalar_kinds(const Array<const ExprSymbol>& x, vector<int>& kind) const {
+
+	vector<int> first_var(x.size()); // first variable of each argument
+	for (int k=0, j=0; k<x.size(); j+=x[k].dim.size(), k++)
+		first_var[k]=j;
+
+	kind.assign(n,OTHER);
+	vector<int> block(n,-1);         // first variable of a block of variables
+	vector<bool> cst_block(n,false); // true if the node is a block of constants
+
+	// the arguments of a node have a greater number
+	for (int i=n-1; i>=0; i--) {
+		const ExprNode& e=(*nodes)[i];
+		bool scalar=e.dim.is_scalar();
+
+		switch(code[i]) {
+		case SYM:
+			if (scalar) kind[i]=first_var[((const ExprSymbol&) e).key];
+			else { kind[i]=BLOCK; block[i]=first_var[((const ExprSymbol&) e).key]; }
+			break;
+		case CST:
+			if (scalar) kind[i]=SCALAR_CST;
+			else { kind[i]=BLOCK; cst_block[i]=true; }
+			break;
+		case IDX:
+		case IDX_CP:
+		{
+			const DoubleIndex& idx=((const ExprIndex&) e).index;
+			int a=args[i][0];
+			if (cst_block[a]) {
+				if (scalar) kind[i]=SCALAR_CST;
+				else { kind[i]=BLOCK; cst_block[i]=true; }
+			} else if (block[a]!=-1 && (idx.nb_rows()==1 || idx.all_cols())) {
+				int first=block[a]+idx.first_row()*(*nodes)[a].dim.nb_cols()+idx.first_col();
+				if (scalar) kind[i]=first;
+				else { kind[i]=BLOCK; block[i]=first; }
+			}
+			break;
+		}
+		case CHI:
+		case ADD:   case MUL:   case SUB:   case DIV:   case MAX:   case MIN:   case ATAN2:
+		case MINUS: case SIGN:  case ABS:   case POWER: case SQR:   case SQRT:
+		case EXP:   case LOG:   case COS:   case SIN:   case TAN:   case ACOS:  case ASIN:
+		case ATAN:  case COSH:  case SINH:  case TANH:  case ACOSH: case ASINH: case ATANH:
+			kind[i]=SCALAR_OP;
+			break;
+		default:
+			break;
+		}
+	}
+}
+
 void CompiledFunction::visit(const ExprNode& e) {
 	e.acceptVisitor(*this);
 }
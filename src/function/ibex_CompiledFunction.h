@@ -12,6 +12,7 @@
 #define __IBEX_COMPILED_FUNCTION_H__
 
 #include <stack>
+#include <vector>
 
 #include "ibex_Expr.h"
 #include "ibex_ExprVisitor.h"
@@ -83,10 +84,34 @@ public:
 	 */
 	Agenda* agenda(int rank) const;
 
+	/**
+	 * Kinds of nodes for the differentiation of scalar operations (see #scalar_kinds).
+	 */
+	enum { SCALAR_CST=-1, SCALAR_OP=-2, BLOCK=-3, OTHER=-4 };
+
+	/**
+	 * Classify the nodes for the differentiation of scalar operations.
+	 *
+	 * kind[i] is set to:
+	 * - the number of a variable if the ith node is a scalar variable
+	 *   (a scalar symbol or an index of a symbol),
+	 * - SCALAR_CST if it is a scalar constant,
+	 * - SCALAR_OP if it is a scalar operation (of scalar arguments),
+	 * - BLOCK if it is a non-scalar symbol or constant, or a contiguous
+	 *   block of it (the variables of a block are numbered row by row),
+	 * - OTHER otherwise (vector or matrix operation, function application, etc.).
+	 *
+	 * \param x - the arguments of the function.
+	 */
+	void scalar_kinds(const Array<const ExprSymbol>& x, std::vector<int>& kind) const;
+
 	/**
 	 * Print the structure to the standard output.
 	 */
 	friend class Function;
+	friend class Eval; // for the incremental evaluation
+	friend class Gradient; // for the forward mode
+	friend class Hessian;
 
 protected:
 	typedef enum {
@@ -18,7 +18,101 @@ using namespace std;
 
 namespace ibex {
 
-Eval::Eval(Function& f) : f(f), d(f), fwd_agenda(NULL), bwd_agenda(NULL) {
+/*
+ * Data of the incremental evaluation.
+ */
+class Eval::IncrementalData {
+public:
+	IncrementalData(Eval& e);
+	~IncrementalData();
+
+	// number of operations
+	const int n;
+
+	// dirty[i]==true <=> the ith node has been recomputed
+	bool* dirty;
+
+	// domain of each node at the last evaluation
+	// (NULL for symbols and references)
+	Domain** saved;
+
+	// the variables a symbol (or an index of a symbol) depends on
+	// (NULL for the other nodes)
+	int* nb_vars;
+	int** vars;
+
+	// input box of the last evaluation
+	IntervalVector last_box;
+
+	// changed[v]==true <=> the vth variable has changed since the last evaluation
+	bool* changed;
+
+	// false if there is no last evaluation
+	bool valid;
+};
+
+Eval::IncrementalData::IncrementalData(Eval& e) : n(e.f.cf.n), dirty(new bool[n]), saved(new Domain*[n]),
+		nb_vars(new int[n]), vars(new int*[n]), last_box(e.f.nb_var()), changed(new bool[e.f.nb_var()]), valid(false) {
+
+	const Function& f=e.f;
+	const CompiledFunction& cf=f.cf;
+
+	for (int v=0; v<f.nb_var(); v++) changed[v]=false;
+
+	// first variable of each symbol node
+	int* first_var=new int[n];
+	for (int i=0; i<n; i++) first_var[i]=-1;
+	for (int s=0, v=0; s<f.nb_arg(); v+=f.arg(s).dim.size(), s++) {
+		int i=f.nodes.rank(f.arg(s));
+		if (i<n) first_var[i]=v;
+	}
+
+	for (int i=0; i<n; i++) {
+
+		const Domain& di=e.d[i];
+
+		saved[i] = (cf.code[i]==CompiledFunction::SYM || di.is_reference) ? NULL : new Domain(di.dim);
+
+		nb_vars[i]=0;
+		vars[i]=NULL;
+
+		if (cf.code[i]==CompiledFunction::SYM) {
+			nb_vars[i]=di.dim.size();
+			vars[i]=new int[nb_vars[i]];
+			for (int k=0; k<nb_vars[i]; k++)
+				vars[i][k]=first_var[i]+k;
+		}
+		else if ((cf.code[i]==CompiledFunction::IDX || cf.code[i]==CompiledFunction::IDX_CP)
+				&& cf.code[cf.args[i][0]]==CompiledFunction::SYM) {
+			// variables are stored row by row (see load(...))
+			const ExprIndex& idx=(const ExprIndex&) f.node(i);
+			int first=first_var[cf.args[i][0]];
+			int nb_cols=idx.expr.dim.nb_cols();
+			nb_vars[i]=idx.index.nb_rows()*idx.index.nb_cols();
+			vars[i]=new int[nb_vars[i]];
+			int k=0;
+			for (int r=idx.index.first_row(); r<=idx.index.last_row(); r++)
+				for (int c=idx.index.first_col(); c<=idx.index.last_col(); c++)
+					vars[i][k++]=first+r*nb_cols+c;
+		}
+	}
+
+	delete[] first_var;
+}
+
+Eval::IncrementalData::~IncrementalData() {
+	for (int i=0; i<n; i++) {
+		if (saved[i]) delete saved[i];
+		if (vars[i]) delete[] vars[i];
+	}
+	delete[] saved;
+	delete[] vars;
+	delete[] nb_vars;
+	delete[] dirty;
+	delete[] changed;
+}
+
+Eval::Eval(Function& f) : f(f), d(f), fwd_agenda(NULL), bwd_agenda(NULL), own_agendas(true), incr(NULL) {
 	int m=f.image_dim();
 	if (m>1) {
 		const ExprVector* vec=dynamic_cast<const ExprVector*>(&f.expr());
@@ -33,8 +127,12 @@ Eval::Eval(Function& f) : f(f), d(f), fwd_agenda(NULL), bwd_agenda(NULL) {
 	}
 }
 
+Eval::Eval(const Eval& e) : f(e.f), d(e.f), fwd_agenda(e.fwd_agenda), bwd_agenda(e.bwd_agenda), own_agendas(false), incr(NULL) {
+
+}
+
 Eval::~Eval() {
-	if (fwd_agenda!=NULL) {
+	if (fwd_agenda!=NULL && own_agendas) {
 		for (int i=0; i<f.image_dim(); i++) {
 			delete fwd_agenda[i];
 			delete bwd_agenda[i];
@@ -42,6 +140,7 @@ Eval::~Eval() {
 		delete[] fwd_agenda;
 		delete[] bwd_agenda;
 	}
+	if (incr) delete incr;
 }
 
 Domain& Eval::eval(const Array<const Domain>& d2) {
@@ -74,6 +173,56 @@ Domain& Eval::eval(const Array<Domain>& d2) {
 	return *d.top;
 }
 
+Domain& Eval::eval_incremental(const IntervalVector& box) {
+
+	if (!incr) incr=new IncrementalData(*this);
+
+	IncrementalData& inc=*incr;
+
+	const CompiledFunction& cf=f.cf;
+
+	d.write_arg_domains(box);
+
+	for (int u=0; u<f.nb_used_vars(); u++) {
+		int v=f.used_var(u);
+		inc.changed[v] = !inc.valid || box[v]!=inc.last_box[v];
+		inc.last_box[v] = box[v];
+	}
+
+	// note: operations are in reverse topological order
+	try {
+		for (int i=inc.n-1; i>=0; i--) {
+			bool dirty=false;
+
+			if (inc.vars[i]) {
+				for (int k=0; !dirty && k<inc.nb_vars[i]; k++)
+					dirty = inc.changed[inc.vars[i][k]];
+			} else if (cf.code[i]==CompiledFunction::CST) {
+				dirty = !inc.valid;
+			} else {
+				for (int k=0; !dirty && k<cf.nb_args[i]; k++)
+					dirty = inc.dirty[cf.args[i][k]];
+			}
+
+			inc.dirty[i]=dirty;
+
+			if (dirty) {
+				cf.forward(*this,i);
+				if (inc.saved[i]) *inc.saved[i] = d[i];
+			} else if (inc.saved[i])
+				d[i] = *inc.saved[i];
+		}
+	} catch(EmptyBoxException&) {
+		d.top->set_empty();
+		inc.valid=false; // some nodes have not been saved
+		return *d.top;
+	}
+
+	inc.valid=true;
+
+	return *d.top;
+}
+
 Domain& Eval::eval(const IntervalVector& box) {
 
 	d.write_arg_domains(box);
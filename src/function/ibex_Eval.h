@@ -34,6 +34,15 @@ public:
 	 */
 	Eval(Function &f);
 
+	/**
+	 * \brief Build an evaluator for the same function as \a e.
+	 *
+	 * The new evaluator has its own domains but shares the
+	 * (read-only) agendas of \a e, which must outlive it.
+	 * See #ibex::EvalContext.
+	 */
+	Eval(const Eval& e);
+
 	/**
 	 * \brief Delete this.
 	 */
@@ -64,6 +73,21 @@ public:
 	 */
 	IntervalVector eval(const IntervalVector& box, const BitSet& components);
 
+	/**
+	 * \brief Run the forward algorithm incrementally.
+	 *
+	 * Same result as eval(box) but only the nodes that depend on
+	 * components of the box modified since the last incremental
+	 * evaluation are recomputed. The domains of the other nodes are
+	 * restored from the last incremental evaluation.
+	 *
+	 * This is useful when the same function is evaluated many times
+	 * on boxes that differ by a few components (e.g., during a
+	 * propagation). Calling other algorithms (eval(box), etc.) in
+	 * between is allowed.
+	 */
+	Domain& eval_incremental(const IntervalVector& box);
+
 protected:
 	/**
 	 * Class used internally to interrupt the forward procedure
@@ -127,6 +151,13 @@ public: // because called from CompiledFunction
 	ExprDomain d;
 	Agenda** fwd_agenda; // one agenda for each component
 	Agenda** bwd_agenda; // one agenda for each component
+
+private:
+	bool own_agendas;    // false if the agendas are shared with another evaluator
+	Eval& operator=(const Eval&); // forbidden
+
+	class IncrementalData;
+	IncrementalData* incr; // data of the incremental evaluation (created at first call)
 };
 
 /* ============================================================================
@@ -0,0 +1,164 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_EvalCache.cpp
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_Function.h"
+#include "ibex_EvalCache.h"
+
+namespace ibex {
+
+namespace {
+
+bool is_point(const IntervalVector& box) {
+	for (int i=0; i<box.size(); i++)
+		if (!box[i].is_degenerated()) return false;
+	return true;
+}
+
+}
+
+EvalCache::Entry::Entry() : box(NULL), y(NULL), y_done(NULL), J(NULL), J_done(NULL) {
+
+}
+
+EvalCache::Entry::~Entry() {
+	if (box) delete box;
+	if (y) delete y;
+	if (y_done) delete y_done;
+	if (J) delete J;
+	if (J_done) delete J_done;
+}
+
+EvalCache::EvalCache(Eval& eval, Gradient& grad) : _eval(eval), _grad(grad), hits(0), misses(0) {
+
+}
+
+EvalCache::~EvalCache() {
+
+}
+
+void EvalCache::clear() {
+	for (int i=0; i<2; i++) {
+		if (entries[i].box) {
+			delete entries[i].box;
+			entries[i].box=NULL;
+		}
+	}
+}
+
+EvalCache::Entry& EvalCache::entry(const IntervalVector& box) {
+	Entry& e=entries[is_point(box) ? 1 : 0];
+
+	if (e.box && *e.box==box) return e;
+
+	if (!e.box)
+		e.box=new IntervalVector(box);
+	else
+		*e.box=box;
+
+	if (e.y_done) e.y_done->clear();
+	if (e.J_done) e.J_done->clear();
+
+	return e;
+}
+
+IntervalVector EvalCache::eval_vector(const IntervalVector& box, const BitSet& components) {
+
+	if (box.is_empty()) return _eval.eval(box,components);
+
+	const Function& f=_eval.f;
+	int m=f.image_dim();
+
+	Entry& e=entry(box);
+
+	if (!e.y) {
+		e.y=new IntervalVector(m);
+		e.y_done=new BitSet(m);
+	}
+
+	BitSet missing(components);
+	missing.diff(*e.y_done);
+
+	if (!missing.empty()) {
+		misses++;
+
+		IntervalVector ym=_eval.eval(box,missing);
+
+		if (ym.is_empty()) {
+			// not cached: the image of a subset of the components may be non-empty
+			return IntervalVector::empty(components.size());
+		}
+
+		int c;
+		for (int i=0; i<missing.size(); i++) {
+			c=(i==0? missing.min() : missing.next(c));
+			(*e.y)[c]=ym[i];
+		}
+		*e.y_done |= missing;
+	} else
+		hits++;
+
+	IntervalVector res(components.size());
+	int c;
+	for (int i=0; i<components.size(); i++) {
+		c=(i==0? components.min() : components.next(c));
+		res[i]=(*e.y)[c];
+	}
+	return res;
+}
+
+void EvalCache::jacobian(const IntervalVector& box, IntervalMatrix& J, const BitSet& components) {
+
+	if (box.is_empty()) {
+		_grad.jacobian(box,J,components);
+		return;
+	}
+
+	const Function& f=_eval.f;
+	int m=f.image_dim();
+	int n=f.nb_var();
+
+	Entry& e=entry(box);
+
+	if (!e.J) {
+		e.J=new IntervalMatrix(m,n);
+		e.J_done=new BitSet(m);
+	}
+
+	BitSet missing(components);
+	missing.diff(*e.J_done);
+
+	if (!missing.empty()) {
+		misses++;
+
+		IntervalMatrix Jm(missing.size(),n);
+		_grad.jacobian(box,Jm,missing);
+
+		if (Jm.is_empty()) {
+			// not cached (see eval_vector)
+			J.set_empty();
+			return;
+		}
+
+		int c;
+		for (int i=0; i<missing.size(); i++) {
+			c=(i==0? missing.min() : missing.next(c));
+			(*e.J)[c]=Jm[i];
+		}
+		*e.J_done |= missing;
+	} else
+		hits++;
+
+	int c;
+	for (int i=0; i<components.size(); i++) {
+		c=(i==0? components.min() : components.next(c));
+		J[i]=(*e.J)[c];
+	}
+}
+
+} // end namespace ibex
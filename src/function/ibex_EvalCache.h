@@ -0,0 +1,127 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_EvalCache.h
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_EVAL_CACHE_H__
+#define __IBEX_EVAL_CACHE_H__
+
+#include "ibex_Eval.h"
+#include "ibex_Gradient.h"
+
+namespace ibex {
+
+/**
+ * \ingroup symbolic
+ *
+ * \brief Cache of the image and the Jacobian matrix of a vector-valued function.
+ *
+ * In a node of a search, several operators calculate the image or the Jacobian matrix
+ * of the same function on the same box or on its midpoint (e.g., CtcNewton,
+ * SmearFunction, PdcHansenFeasibility, LinearizerXTaylor). This cache keeps the last box and
+ * the last point on which f has been evaluated or differentiated, with the corresponding
+ * images and Jacobian matrices, so that each quantity is only calculated once.
+ *
+ * An entry is keyed by the box itself: the cache is only hit if the box is exactly the same.
+ * Components are calculated on demand: if some components have already been calculated
+ * on the same box, only the missing ones are calculated. An empty image or Jacobian matrix
+ * (box outside of the definition domain of some component) is not cached.
+ *
+ * The cache belongs to an evaluation context (see #ibex::EvalContext) so that each
+ * thread has its own cache. It is only used through Function::cached_eval_vector
+ * and Function::cached_jacobian.
+ */
+class EvalCache {
+public:
+	/**
+	 * \brief Create a cache for the function of the evaluator (and gradient).
+	 */
+	EvalCache(Eval& eval, Gradient& grad);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~EvalCache();
+
+	/**
+	 * \brief Some components of f(box).
+	 *
+	 * \see #ibex::Function::eval_vector(const IntervalVector&, const BitSet&) const.
+	 */
+	IntervalVector eval_vector(const IntervalVector& box, const BitSet& components);
+
+	/**
+	 * \brief Some rows of the Jacobian matrix of f on a box.
+	 *
+	 * \see #ibex::Function::jacobian(const IntervalVector&, IntervalMatrix&, const BitSet&, int) const.
+	 */
+	void jacobian(const IntervalVector& box, IntervalMatrix& J, const BitSet& components);
+
+	/**
+	 * \brief Empty the cache.
+	 */
+	void clear();
+
+	/**
+	 * \brief Number of calls answered from the cache (statistics).
+	 */
+	unsigned long nb_hits() const;
+
+	/**
+	 * \brief Number of calls that required a calculation (statistics).
+	 */
+	unsigned long nb_misses() const;
+
+private:
+	EvalCache(const EvalCache&);            // forbidden
+	EvalCache& operator=(const EvalCache&); // forbidden
+
+	/*
+	 * The data calculated on a box.
+	 * (arrays are only allocated when required)
+	 */
+	struct Entry {
+		Entry();
+		~Entry();
+		IntervalVector* box;     // the key (NULL if no box yet)
+		IntervalVector* y;       // the image
+		BitSet* y_done;          // the components of the image calculated so far
+		IntervalMatrix* J;       // the Jacobian matrix
+		BitSet* J_done;          // the rows of the Jacobian matrix calculated so far
+	};
+
+	/*
+	 * Get the entry of a box (the entry is reset if the box differs from the cached one).
+	 */
+	Entry& entry(const IntervalVector& box);
+
+	Eval& _eval;
+	Gradient& _grad;
+
+	/*
+	 * 0: last (non-degenerated) box
+	 * 1: last point (midpoint, corner, etc.)
+	 */
+	Entry entries[2];
+
+	unsigned long hits;
+	unsigned long misses;
+};
+
+/*============================================ inline implementation ============================================ */
+
+inline unsigned long EvalCache::nb_hits() const {
+	return hits;
+}
+
+inline unsigned long EvalCache::nb_misses() const {
+	return misses;
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_EVAL_CACHE_H__
@@ -0,0 +1,78 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_EvalContext.cpp
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_Function.h"
+#include "ibex_EvalContext.h"
+
+namespace ibex {
+
+EvalContext::EvalContext(Function& f) : eval(f), hc4revise(eval), grad(eval), hess(eval), inhc4revise(eval), _cache(NULL) {
+
+}
+
+EvalContext::EvalContext(const EvalContext& c) : eval(c.eval), hc4revise(eval), grad(eval, c.grad), hess(eval), inhc4revise(eval), _cache(NULL) {
+
+}
+
+EvalContext::~EvalContext() {
+	if (_cache) delete _cache;
+}
+
+EvalContextTable::Slots::Slots(int size, Slots* prev) : size(size), ctx(new EvalContext*[size]), prev(prev) {
+	int i=0;
+	if (prev)
+		for (; i<prev->size; i++) ctx[i]=prev->ctx[i];
+	for (; i<size; i++) ctx[i]=NULL;
+}
+
+EvalContextTable::Slots::~Slots() {
+	delete[] ctx;
+	if (prev) delete prev;
+}
+
+EvalContextTable::EvalContextTable(Function& f) : slots(new Slots(max_threads(),NULL)) {
+	slots->ctx[0] = new EvalContext(f);
+}
+
+EvalContextTable::~EvalContextTable() {
+	// the main context is deleted last
+	// (the read-only data is shared)
+	for (int i=slots->size-1; i>=0; i--)
+		if (slots->ctx[i]) delete slots->ctx[i];
+	delete slots;
+}
+
+EvalContext& EvalContextTable::create(int t) {
+	ScopedLock l(lock);
+
+	if (t>=slots->size) {
+		int size=slots->size;
+		while (size<=t) size*=2;
+		Slots* s=new Slots(size,slots);
+#pragma omp flush
+		slots=s;
+	}
+
+	if (slots->ctx[t]==NULL) {
+		EvalContext* c=new EvalContext(*slots->ctx[0]);
+#pragma omp flush
+		slots->ctx[t]=c;
+	}
+
+	return *slots->ctx[t];
+}
+
+int EvalContextTable::nb_contexts() const {
+	int n=0;
+	for (int i=0; i<slots->size; i++)
+		if (slots->ctx[i]) n++;
+	return n;
+}
+
+} // end namespace ibex
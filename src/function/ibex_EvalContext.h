@@ -0,0 +1,194 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_EvalContext.h
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_EVAL_CONTEXT_H__
+#define __IBEX_EVAL_CONTEXT_H__
+
+#include "ibex_Eval.h"
+#include "ibex_HC4Revise.h"
+#include "ibex_Gradient.h"
+#include "ibex_Hessian.h"
+#include "ibex_InHC4Revise.h"
+#include "ibex_EvalCache.h"
+#include "ibex_Lock.h"
+
+namespace ibex {
+
+class Function;
+
+/**
+ * \ingroup symbolic
+ *
+ * \brief Evaluation context of a function.
+ *
+ * An evaluation context gathers the algorithms run on a function
+ * (forward evaluation, HC4Revise, gradient, Hessian and inner projection)
+ * together with their working data, i.e., one domain per node of
+ * the function (see #ibex::ExprDomain), and the cache of the last
+ * images and Jacobian matrices (see #ibex::EvalCache).
+ *
+ * The compiled function, the agendas and the linear part of the
+ * function (used by the gradient) are read-only and shared by all
+ * the contexts of the same function. So a context only costs the
+ * storage of the domains.
+ *
+ * A function has one context per thread, created on the fly (see
+ * #Function::context()). This allows to evaluate (or contract with,
+ * differentiate, etc.) the same function from several threads at a time.
+ */
+class EvalContext {
+public:
+	/**
+	 * \brief Create the main context of the function f.
+	 */
+	EvalContext(Function& f);
+
+	/**
+	 * \brief Create a new context for the same function as \a c.
+	 *
+	 * The read-only data of \a c is shared (so \a c must outlive
+	 * this context).
+	 */
+	EvalContext(const EvalContext& c);
+
+	/**
+	 * \brief Delete this.
+	 */
+	~EvalContext();
+
+	/**
+	 * \brief Forward evaluation.
+	 */
+	Eval eval;
+
+	/**
+	 * \brief HC4Revise (forward-backward) algorithm.
+	 */
+	HC4Revise hc4revise;
+
+	/**
+	 * \brief Gradient (automatic differentiation).
+	 */
+	Gradient grad;
+
+	/**
+	 * \brief Hessian matrix (automatic differentiation).
+	 */
+	Hessian hess;
+
+	/**
+	 * \brief Inner projection.
+	 */
+	InHC4Revise inhc4revise;
+
+	/**
+	 * \brief Cache of the last images and Jacobian matrices.
+	 *
+	 * The cache is created the first time it is accessed.
+	 */
+	EvalCache& cache();
+
+private:
+	EvalContext& operator=(const EvalContext&); // forbidden
+
+	EvalCache* _cache;
+};
+
+/**
+ * \ingroup symbolic
+ *
+ * \brief Table of the evaluation contexts of a function, indexed by thread number.
+ *
+ * The context of the master thread (thread 0) is created with the table. The
+ * context of another thread is created the first time this thread accesses
+ * the table.
+ *
+ * Accessing its own context is lock-free for a thread, once the context has
+ * been created. Creating a context (and resizing the table) is done under a lock.
+ *
+ * \note Nested parallel regions are not supported (two threads of different
+ *       teams could have the same number).
+ */
+class EvalContextTable {
+public:
+	/**
+	 * \brief Create the table and the main context of f.
+	 */
+	EvalContextTable(Function& f);
+
+	/**
+	 * \brief Delete all the contexts.
+	 */
+	~EvalContextTable();
+
+	/**
+	 * \brief The context of the calling thread.
+	 */
+	EvalContext& get();
+
+	/**
+	 * \brief The context of the main thread.
+	 */
+	EvalContext& main();
+
+	/**
+	 * \brief Number of contexts created so far.
+	 */
+	int nb_contexts() const;
+
+private:
+	EvalContextTable(const EvalContextTable&);            // forbidden
+	EvalContextTable& operator=(const EvalContextTable&); // forbidden
+
+	/*
+	 * Create the context of the thread t.
+	 */
+	EvalContext& create(int t);
+
+	/*
+	 * An array of contexts. Once published, the array is never
+	 * modified except for the slots that are NULL (under the lock).
+	 * When it is resized, the previous array is kept (another thread
+	 * may be reading it) until the table is deleted.
+	 */
+	struct Slots {
+		Slots(int size, Slots* prev);
+		~Slots();
+		int size;
+		EvalContext** ctx;
+		Slots* prev;
+	};
+
+	Slots* volatile slots;
+	Lock lock;
+};
+
+/*============================================ inline implementation ============================================ */
+
+inline EvalCache& EvalContext::cache() {
+	if (!_cache) _cache=new EvalCache(eval, grad);
+	return *_cache;
+}
+
+inline EvalContext& EvalContextTable::get() {
+	int t=thread_num();
+	Slots* s=slots;
+	if (t<s->size && s->ctx[t]!=NULL)
+		return *s->ctx[t];
+	else
+		return create(t);
+}
+
+inline EvalContext& EvalContextTable::main() {
+	return *slots->ctx[0];
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_EVAL_CONTEXT_H__
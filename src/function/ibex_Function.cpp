@@ -25,6 +25,9 @@ Function::~Function() {
 	if (_used_var!=NULL)
 		delete[] _used_var;
 
+	if (_jac_pattern!=NULL)
+		delete _jac_pattern;
+
 	if (comp!=NULL) {
 		/* warning... if there is only one constraint
 		 * then comp[0] is the same object as f itself!
@@ -55,12 +58,8 @@ Function::~Function() {
 		delete[] __symbol_index;
 	}
 
-	if (_eval!=NULL) {
-		delete _eval;
-		delete _hc4revise;
-		delete _grad;
-		delete _inhc4revise;
-	}
+	if (_ctx!=NULL)
+		delete _ctx;
 }
 
 void Function::print(std::ostream& os) const {
@@ -18,6 +18,7 @@
 #include "ibex_SymbolMap.h"
 #include "ibex_ExprSubNodes.h"
 #include "ibex_Fnc.h"
+#include "ibex_SparseIntervalMatrix.h"
 
 #include <stdexcept>
 #include <stdarg.h>
@@ -31,6 +32,8 @@ class Eval;
 class HC4Revise;
 class Gradient;
 class InHC4Revise;
+class EvalContext;
+class EvalContextTable;
 
 /**
  * \ingroup function
@@ -737,6 +740,83 @@ public:
 	 */
 	virtual void jacobian(const IntervalVector& x, IntervalMatrix& J, const BitSet& components, int v=-1) const;
 
+	/**
+	 * \brief Same as eval_vector(box,components) but the image of the last box
+	 * and of the last point are cached (see #ibex::EvalCache).
+	 *
+	 * To be used by operators applied in the same node of a search.
+	 */
+	IntervalVector cached_eval_vector(const IntervalVector& box, const BitSet& components) const;
+
+	/**
+	 * \brief Same as cached_eval_vector(box,components) with all the components.
+	 *
+	 * If f is real-valued, the image is not cached.
+	 */
+	IntervalVector cached_eval_vector(const IntervalVector& box) const;
+
+	/**
+	 * \brief Same as jacobian(x,J,components) but the Jacobian matrix of the last box
+	 * and of the last point are cached (see #ibex::EvalCache).
+	 *
+	 * To be used by operators applied in the same node of a search.
+	 */
+	void cached_jacobian(const IntervalVector& x, IntervalMatrix& J, const BitSet& components) const;
+
+	/**
+	 * \brief Same as cached_jacobian(x,J,components) with all the components.
+	 */
+	void cached_jacobian(const IntervalVector& x, IntervalMatrix& J) const;
+
+	/**
+	 * \brief Sparsity pattern of the Jacobian matrix.
+	 *
+	 * The ith vector contains the indices (in increasing order) of the
+	 * variables the ith component of f syntactically depends on.
+	 * Entries outside of this pattern are zero whatever the box.
+	 *
+	 * The pattern is calculated the first time it is required.
+	 */
+	const std::vector<std::vector<int> >& jacobian_pattern() const;
+
+	/**
+	 * \brief Calculate the Jacobian matrix as a sparse matrix.
+	 *
+	 * \pre J must have been built with #jacobian_pattern(), e.g.,
+	 * <tt>SparseIntervalMatrix J(f.image_dim(), f.nb_var(), f.jacobian_pattern())</tt>.
+	 */
+	void jacobian(const IntervalVector& x, SparseIntervalMatrix& J) const;
+
+	/**
+	 * \brief Calculate the Jacobian matrix as a sparse matrix.
+	 */
+	SparseIntervalMatrix sparse_jacobian(const IntervalVector& x) const;
+
+	/**
+	 * \brief Calculate the Hessian matrix of f.
+	 *
+	 * \param x - the input box
+	 * \param H - where the Hessian matrix has to be stored (output parameter).
+	 *
+	 * \pre f must be real-valued
+	 * \see #ibex::Hessian
+	 */
+	void hessian(const IntervalVector& x, IntervalMatrix& H) const;
+
+	/**
+	 * \brief Calculate the Hessian matrix of f.
+	 * \pre f must be real-valued
+	 */
+	IntervalMatrix hessian(const IntervalVector& x) const;
+
+	/**
+	 * \brief Calculate the Hessian matrix of f at a point.
+	 *
+	 * Midpoint of the (interval) Hessian matrix at x.
+	 * \pre f must be real-valued
+	 */
+	Matrix hessian(const Vector& x) const;
+
 	/**
 	 *\see #ibex::Fnc
 	 */
@@ -806,6 +886,18 @@ public:
 	 */
 	void ibwd(const Interval& y, IntervalVector& x, const IntervalVector& xin) const;
 
+	/**
+	 * \brief Get the evaluation context of the calling thread.
+	 *
+	 * The context is created the first time a thread calls this function.
+	 * All the evaluation functions (eval, backward, gradient, etc.) use
+	 * the context of the calling thread, so that the same function can
+	 * be evaluated by several threads at a time.
+	 *
+	 * \see #ibex::EvalContext.
+	 */
+	EvalContext& context() const;
+
 	/*
 	 * \brief Get a reference to the evaluator.
 	 *
@@ -868,6 +960,16 @@ protected:
 	 */
 	void generate_comp();
 
+	/**
+	 * \brief Calculate the sparsity pattern of the Jacobian matrix.
+	 */
+	void generate_jacobian_pattern() const;
+
+	/**
+	 * \brief Build the array of components (see generate_comp()).
+	 */
+	Function** build_comp();
+
 	/**
 	 * \brief Print the function "x->f(x)" (including arguments)
 	 */
@@ -917,17 +1019,20 @@ private:
 	// point to this field (instead of being a copy)
 	Function *zero;
 
-	Eval *_eval;
-	HC4Revise *_hc4revise;
-	// TODO: actually never used if f is vector/matrix valued
-	Gradient *_grad;
-	InHC4Revise *_inhc4revise;
+	// The evaluation contexts (one per thread). Each context
+	// contains the forward, HC4Revise, gradient and inner projection
+	// algorithms (note: the gradient is actually never used if f is
+	// vector/matrix valued).
+	EvalContextTable* _ctx;
 
 	// number of used vars (value "-1" means "not yet generated")
 	mutable int _nb_used_vars;
 
 	// only generated if required
 	mutable int* _used_var;
+
+	// sparsity pattern of the Jacobian matrix (only generated if required)
+	mutable std::vector<std::vector<int> >* _jac_pattern;
 };
 
 } // end namespace
@@ -936,6 +1041,7 @@ private:
 #include "ibex_Gradient.h"
 #include "ibex_HC4Revise.h"
 #include "ibex_InHC4Revise.h"
+#include "ibex_EvalContext.h"
 #include "ibex_VarSet.h"
 
 namespace ibex {
@@ -998,15 +1104,15 @@ inline void Function::forward(const V& algo) const {
 }
 
 inline Domain& Function::eval_domain(const IntervalVector& box) const {
-	return ((Function*) this)->_eval->eval(box);
+	return context().eval.eval(box);
 }
 
 inline Domain& Function::eval_domain(const Array<const Domain>& d) const {
-	return ((Function*) this)->_eval->eval(d);
+	return context().eval.eval(d);
 }
 
 inline Domain& Function::eval_domain(const Array<Domain>& d) const {
-	return ((Function*) this)->_eval->eval(d);
+	return context().eval.eval(d);
 }
 
 inline Interval Function::eval(const IntervalVector& box) const {
@@ -1022,7 +1128,7 @@ inline IntervalVector Function::eval_vector(const IntervalVector& box) const {
 }
 
 inline IntervalVector Function::eval_vector(const IntervalVector& box, const BitSet& components) const {
-	return ((Function*) this)->_eval->eval(box,components);
+	return context().eval.eval(box,components);
 }
 
 inline IntervalMatrix Function::eval_matrix(const IntervalVector& box) const {
@@ -1053,7 +1159,7 @@ inline void Function::backward(const V& algo) const {
 }
 
 inline bool Function::backward(const Domain& y, IntervalVector& x) const {
-	return ((Function*) this)->_hc4revise->proj(y,x);
+	return context().hc4revise.proj(y,x);
 }
 
 inline bool Function::backward(const Interval& y, IntervalVector& x) const {
@@ -1070,11 +1176,11 @@ inline bool Function::backward(const IntervalMatrix& y, IntervalVector& x) const
 }
 
 inline void Function::ibwd(const Domain& y, IntervalVector& x) const {
-	((Function*) this)->_inhc4revise->iproj(y,x);
+	context().inhc4revise.iproj(y,x);
 }
 
 inline void Function::ibwd(const Domain& y, IntervalVector& x, const IntervalVector& xin) const {
-	((Function*) this)->_inhc4revise->iproj(y,x,xin);
+	context().inhc4revise.iproj(y,x,xin);
 }
 
 inline void Function::ibwd(const Interval& y, IntervalVector& x) const {
@@ -1092,7 +1198,7 @@ inline void Function::print_expr(std::ostream& os) const {
 inline void Function::gradient(const IntervalVector& x, IntervalVector& g) const {
 	assert(g.size()==nb_var());
 	assert(x.size()==nb_var());
-	_grad->gradient(x,g);
+	context().grad.gradient(x,g);
 //	if (!df) ((Function*) this)->df=new Function(*this,DIFF);
 //	g=df->eval_vector(x);
 }
@@ -1121,7 +1227,57 @@ inline void Function::jacobian(const IntervalVector& full_box, IntervalMatrix& J
 }
 
 inline void Function::jacobian(const IntervalVector& x, IntervalMatrix& J, const BitSet& components, int v) const {
-	_grad->jacobian(x, J, components, v);
+	context().grad.jacobian(x, J, components, v);
+}
+
+inline IntervalVector Function::cached_eval_vector(const IntervalVector& box, const BitSet& components) const {
+	return context().cache().eval_vector(box,components);
+}
+
+inline IntervalVector Function::cached_eval_vector(const IntervalVector& box) const {
+	return _image_dim.is_scalar() ?
+			IntervalVector(1,eval(box)) :
+			cached_eval_vector(box,BitSet::all(image_dim()));
+}
+
+inline void Function::cached_jacobian(const IntervalVector& x, IntervalMatrix& J, const BitSet& components) const {
+	context().cache().jacobian(x, J, components);
+}
+
+inline void Function::cached_jacobian(const IntervalVector& x, IntervalMatrix& J) const {
+	cached_jacobian(x, J, BitSet::all(image_dim()));
+}
+
+inline const std::vector<std::vector<int> >& Function::jacobian_pattern() const {
+	if (!_jac_pattern) generate_jacobian_pattern();
+	return *_jac_pattern;
+}
+
+inline void Function::jacobian(const IntervalVector& x, SparseIntervalMatrix& J) const {
+	context().grad.jacobian(x, J);
+}
+
+inline SparseIntervalMatrix Function::sparse_jacobian(const IntervalVector& x) const {
+	SparseIntervalMatrix J(image_dim(), nb_var(), jacobian_pattern());
+	jacobian(x,J);
+	return J;
+}
+
+inline void Function::hessian(const IntervalVector& x, IntervalMatrix& H) const {
+	assert(H.nb_rows()==nb_var());
+	assert(H.nb_cols()==nb_var());
+	assert(x.size()==nb_var());
+	context().hess.hessian(x,H);
+}
+
+inline IntervalMatrix Function::hessian(const IntervalVector& x) const {
+	IntervalMatrix H(nb_var(),nb_var());
+	hessian(x,H);
+	return H;
+}
+
+inline Matrix Function::hessian(const Vector& x) const {
+	return hessian(IntervalVector(x)).mid();
 }
 
 inline void Function::hansen_matrix(const IntervalVector& x, IntervalMatrix& H) const {
@@ -1144,20 +1300,24 @@ inline void Function::hansen_matrix(const IntervalVector& full_box, const Interv
 	Fnc::hansen_matrix(full_box, x0, H_var, J_param,set);
 }
 
+inline EvalContext& Function::context() const {
+	return _ctx->get();
+}
+
 inline Eval& Function::basic_evaluator() const {
-	return *_eval;
+	return context().eval;
 }
 
 inline Gradient& Function::deriv_calculator() const {
-	return *_grad;
+	return context().grad;
 }
 
 inline HC4Revise& Function::hc4revise() const {
-	return *_hc4revise;
+	return context().hc4revise;
 }
 
 inline InHC4Revise& Function::inhc4revise() const {
-	return *_inhc4revise;
+	return context().inhc4revise;
 }
 
 inline int Function::nb_used_vars() const {
@@ -13,12 +13,16 @@
 #include "ibex_Gradient.h"
 #include "ibex_ExprLinearity.h"
 
+#include <algorithm>
+#include <functional>
+
 using namespace std;
 
 namespace ibex {
 
 Gradient::Gradient(Eval& e): f(e.f), _eval(e), d(e.d), g(f),
-		coeff_matrix(f.image_dim(),f.nb_var()+1), is_linear(new bool[f.image_dim()]) {
+		coeff_matrix(f.image_dim(),f.nb_var()+1), is_linear(new bool[f.image_dim()]),
+		_mode(AUTO), fwd_init(false), fwd(false), fwd_p(0), fwd_nb_nonlinear(0) {
 
 	if (f.expr().dim.is_matrix())
 		return; // class not called in this case
@@ -35,6 +39,15 @@ Gradient::Gradient(Eval& e): f(e.f), _eval(e), d(e.d), g(f),
 	}
 }
 
+Gradient::Gradient(Eval& e, const Gradient& grad): f(e.f), _eval(e), d(e.d), g(f),
+		coeff_matrix(grad.coeff_matrix), is_linear(new bool[f.image_dim()]),
+		_mode(grad._mode), fwd_init(false), fwd(false), fwd_p(0), fwd_nb_nonlinear(0) {
+
+	for (int i=0; i<f.image_dim(); i++) {
+		is_linear[i]=grad.is_linear[i];
+	}
+}
+
 Gradient::~Gradient() {
 	delete[] is_linear;
 }
@@ -148,6 +161,26 @@ void Gradient::jacobian(const IntervalVector& box, IntervalMatrix& J, const BitS
 			return;
 		}
 
+		if (v==-1 && jacobian_mode()==FORWARD) {
+
+			forward_sweep(nonlinear_components);
+
+			for (int i=0; i<m; i++) {
+
+				c=(i==0? components.min() : components.next(c));
+
+				if (!nonlinear_components[c]) continue;
+
+				forward_row(c, J.row(i));
+
+				if (J.row(i).is_empty()) {
+					J.set_empty();
+					return;
+				}
+			}
+			return;
+		}
+
 		for (int i=0; i<m; i++) {
 
 			c=(i==0? components.min() : components.next(c));
@@ -224,6 +257,126 @@ void Gradient::jacobian(const IntervalVector& box, IntervalMatrix& J, const BitS
 	}
 }
 
+namespace {
+
+// Copy the entries of the ith row of J that are in the pattern
+inline void gather(const IntervalVector& row, SparseIntervalMatrix& J, int i) {
+	for (int k=J.row_begin(i); k<J.row_end(i); k++)
+		J.val(k)=row[J.col(k)];
+}
+
+}
+
+void Gradient::jacobian(const IntervalVector& box, SparseIntervalMatrix& J) {
+
+	int n=f.nb_var();
+	int m=f.image_dim();
+
+	if (f.expr().dim.is_matrix()) {
+		ibex_error("Cannot called \"jacobian\" on a matrix-valued function");
+	}
+
+	assert(J.nb_rows()==m);
+	assert(J.nb_cols()==n);
+	assert(box.size()==n);
+
+	J.clear();
+
+	// ============================================================================
+	// Detect the "nonlinear" components (those that requires gradient calculation)
+	BitSet nonlinear_components=BitSet::empty(m);
+
+	for (int c=0; c<m; c++) {
+		if (is_linear[c])
+			gather(coeff_matrix[c],J,c); // the row also contains the additive constant (ignored)
+		else
+			nonlinear_components.add(c);
+	}
+
+	if (nonlinear_components.empty()) return;
+	// ============================================================================
+
+	IntervalVector row(n); // dense row (reused for each component)
+
+	if (m==1) {
+
+		gradient(box,row);
+
+		if (row.is_empty()) {
+			J.set_empty();
+			return;
+		}
+
+		gather(row,J,0);
+
+	} else if(_eval.fwd_agenda!=NULL) {
+
+		// see jacobian(const IntervalVector&, IntervalMatrix&, const BitSet&, int)
+		if (_eval.eval(box,nonlinear_components).is_empty()) {
+			// outside definition domain -> empty jacobian
+			J.set_empty();
+			return;
+		}
+
+		bool forward=(jacobian_mode()==FORWARD);
+
+		if (forward) forward_sweep(nonlinear_components);
+
+		for (int c=0; c<m; c++) {
+
+			if (!nonlinear_components[c]) continue;
+
+			if (forward) {
+				// only the entries of the pattern of the component are set
+				const vector<int>& pattern=fwd_pattern[c];
+				const Interval* t=&tangent[_eval.bwd_agenda[c]->first()*fwd_p];
+				for (vector<int>::const_iterator it=pattern.begin(); it!=pattern.end(); it++) {
+					if (t[fwd_color[*it]].is_empty()) {
+						J.set_empty();
+						return;
+					}
+					int k=J.find(c,*it);
+					if (k!=-1) J.val(k)=t[fwd_color[*it]];
+				}
+				continue;
+			}
+
+			row.clear();
+
+			g.write_arg_domains(row);
+
+			f.cf.forward<Gradient>(*this, *(_eval.fwd_agenda)[c]);
+
+			g[_eval.bwd_agenda[c]->first()].i() = 1.0;
+
+			f.cf.backward<Gradient>(*this, *(_eval.bwd_agenda)[c]);
+
+			g.read_arg_domains(row);
+
+			if (row.is_empty()) {
+				J.set_empty();
+				return;
+			}
+
+			gather(row,J,c);
+		}
+	} else {
+		for (int c=0; c<m; c++) {
+
+			if (!nonlinear_components[c]) continue;
+
+			f[c].gradient(box,row);
+
+			if (row.is_empty()) {
+				J.set_empty();
+				return;
+			}
+
+			gather(row,J,c);
+		}
+	}
+}
+
 void Gradient::jacobian(const IntervalVector& box, IntervalMatrix& J, int v) {
 	jacobian(box,J, BitSet::all(f.image_dim()), v);
 }
@@ -262,6 +415,184 @@ void Gradient::jacobian(const Array<Domain>& d, IntervalMatrix& J) {
 	// TODO
 }
 
+Gradient::Mode Gradient::jacobian_mode() {
+	if (!fwd_init) init_forward();
+	return fwd ? FORWARD : REVERSE;
+}
+
+void Gradient::init_forward() {
+
+	fwd_init=true;
+	fwd=false;
+
+	if (_mode==REVERSE || f.image_dim()==1 || _eval.fwd_agenda==NULL || f.expr().dim.is_matrix())
+		return;
+
+	const CompiledFunction& cf=f.cf;
+	int N=cf.n;
+	int n=f.nb_var();
+	int m=f.image_dim();
+
+	// ============================================================================
+	// Kind of each node. The forward mode is not supported by a node
+	// if it is neither a scalar operation nor a (block of) variables or constants.
+	cf.scalar_kinds(f.args(),fwd_var);
+
+	// ============================================================================
+	// Pattern of the nonlinear components and nodes to be swept.
+	fwd_pattern.assign(m,vector<int>());
+	fwd_todo.assign(N,false);
+	fwd_nb_nonlinear=0;
+
+	vector<int> last(n,-1); // last component where a variable has been found
+	double cost_reverse=0;
+	double nnz=0;
+
+	for (int c=0; c<m; c++) {
+		if (is_linear[c]) continue;
+		fwd_nb_nonlinear++;
+		const Agenda& a=*(_eval.fwd_agenda[c]);
+		double size=0;
+		for (int y=a.first(); y!=a.end(); y=a.next(y)) {
+			if (fwd_var[y]==CompiledFunction::OTHER) return;
+			int j=fwd_var[y];
+			if (j>=0 && last[j]!=c) {
+				last[j]=c;
+				fwd_pattern[c].push_back(j);
+			}
+			fwd_todo[y]=true;
+			size++;
+		}
+		nnz+=fwd_pattern[c].size();
+		// one forward (initialization) and one backward sweep
+		// plus the transfer of a dense row of size n
+		cost_reverse+=2*size+3*n;
+	}
+
+	fwd_nodes.clear();
+	for (int y=N-1; y>=0; y--) {
+		if (fwd_todo[y]) {
+			fwd_nodes.push_back(y);
+			fwd_todo[y]=false;
+		}
+	}
+
+	// ============================================================================
+	// Greedy coloring of the variables: two variables that appear
+	// in the same component must have different colors.
+	vector<vector<int> > rows(n); // components where each variable appears
+	for (int c=0; c<m; c++)
+		for (vector<int>::const_iterator it=fwd_pattern[c].begin(); it!=fwd_pattern[c].end(); it++)
+			rows[*it].push_back(c);
+
+	fwd_color.assign(n,-1);
+	fwd_p=0;
+	vector<int> forbidden(n,-1); // forbidden[k]==j <=> color k is forbidden for variable j
+
+	for (int j=0; j<n; j++) {
+		if (rows[j].empty()) continue;
+		for (vector<int>::const_iterator c=rows[j].begin(); c!=rows[j].end(); c++)
+			for (vector<int>::const_iterator it=fwd_pattern[*c].begin(); it!=fwd_pattern[*c].end(); it++)
+				if (fwd_color[*it]!=-1) forbidden[fwd_color[*it]]=j;
+		int k=0;
+		while (forbidden[k]==j) k++;
+		fwd_color[j]=k;
+		if (k>=fwd_p) fwd_p=k+1;
+	}
+
+	// ============================================================================
+	// Choice of the mode.
+	// In the forward mode, each node requires the local derivatives (one
+	// backward step) and a combination of the tangents of its arguments.
+	double cost_forward=fwd_nodes.size()*(2.0+2.0*fwd_p)+nnz;
+
+	fwd=(_mode==FORWARD || cost_forward<cost_reverse);
+
+	if (fwd)
+		tangent.resize(N*fwd_p);
+	else
+		tangent.clear();
+}
+
+void Gradient::forward_sweep(const BitSet& components) {
+
+	const CompiledFunction& cf=f.cf;
+	int p=fwd_p;
+
+	// nodes to be swept (in forward order)
+	vector<int> subset;
+
+	if (components.size()<fwd_nb_nonlinear) {
+		int c;
+		for (int i=0; i<components.size(); i++) {
+			c=(i==0? components.min() : components.next(c));
+			const Agenda& a=*(_eval.fwd_agenda[c]);
+			for (int y=a.first(); y!=a.end(); y=a.next(y))
+				if (!fwd_todo[y]) {
+					fwd_todo[y]=true;
+					subset.push_back(y);
+				}
+		}
+		for (vector<int>::const_iterator it=subset.begin(); it!=subset.end(); it++)
+			fwd_todo[*it]=false;
+		// forward order: the arguments of a node have a greater number
+		sort(subset.begin(), subset.end(), greater<int>());
+	}
+
+	const vector<int>& nodes=components.size()<fwd_nb_nonlinear? subset : fwd_nodes;
+
+	for (vector<int>::const_iterator it=nodes.begin(); it!=nodes.end(); it++) {
+		int y=*it;
+		Interval* t=&tangent[y*p];
+
+		switch (fwd_var[y]) {
+		case CompiledFunction::BLOCK:
+			break;
+		case CompiledFunction::SCALAR_CST:
+			for (int q=0; q<p; q++) t[q]=Interval::ZERO;
+			break;
+		case CompiledFunction::SCALAR_OP:
+		{
+			int k=cf.nb_args[y];
+			int* x=cf.args[y];
+
+			// local derivatives: backward step with g[y]=1
+			for (int a=0; a<k; a++) g[x[a]].i()=Interval::ZERO;
+			g[y].i()=Interval::ONE;
+			cf.backward<Gradient>(*this,y);
+
+			for (int q=0; q<p; q++) t[q]=Interval::ZERO;
+
+			for (int a=0; a<k; a++) {
+				const Interval& dx=g[x[a]].i();
+
+				// arguments that share the same domain (e.g., the same
+				// variable indexed twice) have already been counted
+				bool counted=false;
+				for (int b=0; b<a && !counted; b++)
+					counted=(&g[x[b]].i()==&dx);
+				if (counted) continue;
+
+				const Interval* tx=&tangent[x[a]*p];
+				for (int q=0; q<p; q++)
+					if (tx[q]!=Interval::ZERO) t[q]+=dx*tx[q]; // tangents are mostly null
+			}
+			break;
+		}
+		default: // variable
+			for (int q=0; q<p; q++) t[q]=Interval::ZERO;
+			t[fwd_color[fwd_var[y]]]=Interval::ONE;
+		}
+	}
+}
+
+void Gradient::forward_row(int c, IntervalVector& row) const {
+	row.clear();
+	const Interval* t=&tangent[_eval.bwd_agenda[c]->first()*fwd_p];
+	for (vector<int>::const_iterator it=fwd_pattern[c].begin(); it!=fwd_pattern[c].end(); it++)
+		row[*it]=t[fwd_color[*it]];
+}
+
 void Gradient::vector_fwd(int* x, int y) {
 	const ExprVector& v = (const ExprVector&) f.node(y);
 
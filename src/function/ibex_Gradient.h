@@ -15,6 +15,9 @@
 #include "ibex_Eval.h"
 #include "ibex_BwdAlgorithm.h"
 #include "ibex_Agenda.h"
+#include "ibex_SparseIntervalMatrix.h"
+
+#include <vector>
 
 namespace ibex {
 
@@ -25,6 +28,25 @@ namespace ibex {
 class Gradient : public FwdAlgorithm, public BwdAlgorithm {
 
 public:
+	/**
+	 * \brief Automatic differentiation mode of the Jacobian matrix.
+	 *
+	 * When f is a vector of expressions, all the components are evaluated once
+	 * (common subexpressions are shared) and then:
+	 * - REVERSE: one backward sweep is performed for each component.
+	 * - FORWARD: a single forward sweep propagates a vector of tangents (partial
+	 *   derivatives) for all the components. The variables are compressed by a coloring
+	 *   of the sparsity pattern: two variables that appear in the same component get
+	 *   different colors and a tangent has one entry per color (so that the
+	 *   size of the tangents is small if n is small or if the Jacobian matrix is sparse).
+	 * - AUTO: the mode with the lowest estimated cost is chosen from the
+	 *   shape of the DAG (size of the components, number of shared nodes, number of colors).
+	 *
+	 * The forward mode only applies when the components are built from scalar
+	 * operations of variables (possibly indexed). Otherwise, the reverse mode is used.
+	 */
+	typedef enum { AUTO, REVERSE, FORWARD } Mode;
+
 	/**
 	 * \brief Build the gradient algorithm.
 	 *
@@ -35,6 +57,16 @@ public:
 	 */
 	Gradient(Eval& eval);
 
+	/**
+	 * \brief Build the gradient algorithm from an evaluator and
+	 * an existing gradient algorithm of the same function.
+	 *
+	 * The linear part of the function (calculated symbolically
+	 * by the first constructor) is copied from \a grad instead of
+	 * being calculated again. See #ibex::EvalContext.
+	 */
+	Gradient(Eval& eval, const Gradient& grad);
+
 	/**
 	 * \brief Delete this.
 	 */
@@ -71,6 +103,25 @@ public:
 	 */
 	void jacobian(const Array<Domain>& d, IntervalMatrix& J);
 
+	/**
+	 * \brief Calculate the Jacobian of f on the box \a box and store the result in the sparse matrix \a J.
+	 *
+	 * Only the entries of the pattern of J are calculated (the pattern must contain
+	 * the one given by Function::jacobian_pattern()). Each row is still obtained by
+	 * a (dense) automatic differentiation but no n x m matrix is ever built.
+	 */
+	void jacobian(const IntervalVector& box, SparseIntervalMatrix& J);
+
+	/**
+	 * \brief Set the automatic differentiation mode of the Jacobian matrix (default: AUTO).
+	 */
+	void set_mode(Mode mode);
+
+	/**
+	 * \brief The mode actually used for the Jacobian matrix (REVERSE or FORWARD).
+	 */
+	Mode jacobian_mode();
+
 	/* ====================================== Forward =================================== */
 
 	inline void idx_fwd(int , int ) { /* nothing to do */ }
@@ -183,8 +234,52 @@ public:
 	IntervalMatrix coeff_matrix;
 	// True if the ith component is linear (wrt all variables)
 	bool *is_linear;
+
+private:
+	/*
+	 * Build the data of the forward mode and choose
+	 * the mode in case of AUTO (called once).
+	 */
+	void init_forward();
+
+	/*
+	 * Vector forward sweep: calculate the tangents of all the
+	 * nodes of some components (f must be evaluated before).
+	 */
+	void forward_sweep(const BitSet& components);
+
+	/*
+	 * Tangent of the root of the cth component (after forward_sweep),
+	 * stored in the entries of the pattern of the component.
+	 */
+	void forward_row(int c, IntervalVector& row) const;
+
+	Mode _mode;
+
+	/* ================ forward mode ================ */
+	bool fwd_init;                        // true if the data below are built
+	bool fwd;                             // true if the forward mode is used
+	int fwd_p;                            // number of colors (size of a tangent)
+	int fwd_nb_nonlinear;                 // number of nonlinear components
+	std::vector<int> fwd_var;             // per node: kind (see CompiledFunction::scalar_kinds)
+	std::vector<int> fwd_color;           // per variable: color (-1 if it does not appear in a nonlinear component)
+	std::vector<std::vector<int> > fwd_pattern; // per component: the variables that appear in it
+	std::vector<int> fwd_nodes;           // nodes of all the nonlinear components (in forward order)
+	std::vector<bool> fwd_todo;           // nodes to be processed by the current sweep
+	std::vector<Interval> tangent;        // tangents of the nodes (fwd_p entries per node)
+	/* ============================================== */
+
+	Gradient(const Gradient&);            // forbidden
+	Gradient& operator=(const Gradient&); // forbidden
 };
 
+/*================================== inline implementations ========================================*/
+
+inline void Gradient::set_mode(Mode mode) {
+	_mode = mode;
+	fwd_init = false;
+}
+
 } // namespace ibex
 
 #endif // __IBEX_GRADIENT_H__
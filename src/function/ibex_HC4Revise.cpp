@@ -33,8 +33,11 @@ bool HC4Revise::proj(const Domain& y, Array<Domain>& x) {
 //bool HC4Revise::proj(const Domain& y, const Array<const Domain>& x) {
 //}
 
-bool HC4Revise::proj(const Domain& y, IntervalVector& x) {
-	eval.eval(x);
+bool HC4Revise::proj(const Domain& y, IntervalVector& x, bool incremental) {
+	if (incremental)
+		eval.eval_incremental(x);
+	else
+		eval.eval(x);
 	//std::cout << "forward:" << std::endl; f.cf.print(d);
 
 	bool is_inner=false;
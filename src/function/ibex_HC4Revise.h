@@ -39,8 +39,12 @@ public:
 	 * \note if x is outside the definition domain of f, then
 	 *       x is set to the empty set although f([x])\subseteq [y]
 	 *       and the return value is "false".
+	 *
+	 * \param incremental - if true, the forward phase only recomputes the
+	 *                      nodes that depend on components of x modified since
+	 *                      the last incremental call (see #ibex::Eval::eval_incremental).
 	 */
-	bool proj(const Domain& y, IntervalVector& x);
+	bool proj(const Domain& y, IntervalVector& x, bool incremental=false);
 
 	/**
 	 * \brief Ratio for the contraction of a
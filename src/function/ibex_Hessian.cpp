@@ -0,0 +1,468 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Hessian.cpp
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_Function.h"
+#include "ibex_Hessian.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace ibex {
+
+Hessian::Hessian(Eval& e) : f(e.f), _eval(e), d(e.d), _init(false), ad(false), p(0) {
+
+}
+
+namespace {
+
+/*
+ * Store the supports (sorted) in compressed form.
+ */
+void compress(const vector<vector<int> >& sup, vector<int>& start, vector<int>& _pos) {
+	int N=sup.size();
+	start.resize(N+1);
+	start[0]=0;
+	for (int y=0; y<N; y++)
+		start[y+1]=start[y]+sup[y].size();
+	_pos.resize(start[N]);
+	for (int y=0; y<N; y++)
+		copy(sup[y].begin(), sup[y].end(), _pos.begin()+start[y]);
+}
+
+} // end anonymous namespace
+
+void Hessian::init() {
+
+	_init=true;
+	ad=false;
+
+	const CompiledFunction& cf=f.cf;
+	int N=cf.n;
+	int n=f.nb_var();
+
+	cf.scalar_kinds(f.args(),kind);
+
+	for (int y=0; y<N; y++)
+		if (kind[y]==CompiledFunction::OTHER) return;
+
+	// variables f depends on
+	pos.assign(n,-1);
+	for (int y=0; y<N; y++)
+		if (kind[y]>=0) pos[kind[y]]=0;
+
+	var.clear();
+	for (int j=0; j<n; j++)
+		if (pos[j]!=-1) {
+			pos[j]=var.size();
+			var.push_back(j);
+		}
+	p=var.size();
+
+	// parents of each node
+	par_start.assign(N+1,0);
+	for (int y=0; y<N; y++)
+		if (kind[y]==CompiledFunction::SCALAR_OP)
+			for (int a=0; a<cf.nb_args[y]; a++)
+				par_start[cf.args[y][a]+1]++;
+
+	for (int y=0; y<N; y++)
+		par_start[y+1]+=par_start[y];
+
+	par_node.resize(par_start[N]);
+	par_arg.resize(par_start[N]);
+	vector<int> next(par_start.begin(), par_start.end()-1);
+	for (int y=0; y<N; y++)
+		if (kind[y]==CompiledFunction::SCALAR_OP)
+			for (int a=0; a<cf.nb_args[y]; a++) {
+				int x=cf.args[y][a];
+				par_node[next[x]]=y;
+				par_arg[next[x]++]=a;
+			}
+
+	vector<int> mark(p,-1); // to merge supports
+	vector<vector<int> > sup(N);
+
+	// support of the tangents (the arguments of a node have greater indices)
+	for (int y=N-1; y>=0; y--) {
+		if (kind[y]>=0)
+			sup[y].push_back(pos[kind[y]]);
+		else if (kind[y]==CompiledFunction::SCALAR_OP) {
+			for (int a=0; a<cf.nb_args[y]; a++) {
+				const vector<int>& sa=sup[cf.args[y][a]];
+				for (vector<int>::const_iterator it=sa.begin(); it!=sa.end(); it++)
+					if (mark[*it]!=y) { mark[*it]=y; sup[y].push_back(*it); }
+			}
+			sort(sup[y].begin(), sup[y].end());
+		}
+	}
+	compress(sup,tan_start,tan_pos);
+
+	// support of the tangents of the adjoints (the parents of a node have smaller indices)
+	fill(mark.begin(), mark.end(), -1);
+	vector<vector<int> > asup(N);
+	for (int x=0; x<N; x++) {
+		for (int e=par_start[x]; e<par_start[x+1]; e++) {
+			int y=par_node[e];
+			int a=par_arg[e];
+			for (vector<int>::const_iterator it=asup[y].begin(); it!=asup[y].end(); it++)
+				if (mark[*it]!=x) { mark[*it]=x; asup[x].push_back(*it); }
+			for (int b=0; b<cf.nb_args[y]; b++) {
+				if (!has_d2(y,a,b)) continue;
+				int xb=cf.args[y][b];
+				for (int k=tan_start[xb]; k<tan_start[xb+1]; k++)
+					if (mark[tan_pos[k]]!=x) { mark[tan_pos[k]]=x; asup[x].push_back(tan_pos[k]); }
+			}
+		}
+		sort(asup[x].begin(), asup[x].end());
+	}
+	compress(asup,adj_start,adj_pos);
+
+	d1.resize(3*N);
+	d2.resize(9*N);
+	tan.resize(tan_start[N]);
+	adj.resize(N);
+	adj_tan.resize(adj_start[N]);
+	work.assign(p,Interval::ZERO);
+
+	ad=true;
+}
+
+void Hessian::hessian(const IntervalVector& box, IntervalMatrix& H) {
+
+	if (!f.expr().dim.is_scalar()) {
+		ibex_error("Cannot called \"hessian\" on a vector-valued function");
+	}
+
+	assert(box.size()==f.nb_var());
+	assert(H.nb_rows()==f.nb_var());
+	assert(H.nb_cols()==f.nb_var());
+
+	if (!_init) init();
+
+	if (!ad) {
+		// Jacobian matrix of the symbolic gradient
+		f.diff().jacobian(box,H);
+		return;
+	}
+
+	if (_eval.eval(box).is_empty()) {
+		// outside definition domain -> empty Hessian
+		H.set_empty();
+		return;
+	}
+
+	H.clear();
+
+	if (p==0) return; // f is constant
+
+	const CompiledFunction& cf=f.cf;
+	int N=cf.n;
+
+	// ============================ forward sweep ============================
+	// The tangents are accumulated in the dense vector "work", which is
+	// reset to zero after each node.
+	for (int y=N-1; y>=0; y--) {
+
+		if (kind[y]>=0) {
+			tan[tan_start[y]]=Interval::ONE; // variable
+			continue;
+		}
+
+		if (kind[y]!=CompiledFunction::SCALAR_OP) continue;
+
+		partials(y,&d1[3*y],&d2[9*y]);
+
+		for (int a=0; a<cf.nb_args[y]; a++) {
+			const Interval& da=d1[3*y+a];
+			if (da==Interval::ZERO) continue;
+			int x=cf.args[y][a];
+			for (int k=tan_start[x]; k<tan_start[x+1]; k++)
+				work[tan_pos[k]]+=da*tan[k];
+		}
+
+		for (int k=tan_start[y]; k<tan_start[y+1]; k++) {
+			tan[k]=work[tan_pos[k]];
+			work[tan_pos[k]]=Interval::ZERO;
+		}
+	}
+
+	// ============================ backward sweep ============================
+	// The adjoint of a node (and its tangent) is pulled from its parents,
+	// all processed before.
+	adj[0]=Interval::ONE; // the root
+
+	for (int x=1; x<N; x++) {
+
+		adj[x]=Interval::ZERO;
+
+		for (int e=par_start[x]; e<par_start[x+1]; e++) {
+			int y=par_node[e];
+			int a=par_arg[e];
+			const Interval& ay=adj[y];
+			const Interval& da=d1[3*y+a];
+
+			adj[x] += ay*da;
+
+			// derivative of ay*da: (tangent of ay)*da + ay*(tangent of da)
+			if (da!=Interval::ZERO)
+				for (int k=adj_start[y]; k<adj_start[y+1]; k++)
+					work[adj_pos[k]]+=adj_tan[k]*da;
+
+			if (ay==Interval::ZERO) continue;
+
+			for (int b=0; b<cf.nb_args[y]; b++) {
+				const Interval& dab=d2[9*y+3*a+b];
+				if (dab==Interval::ZERO) continue;
+				Interval c=ay*dab;
+				int xb=cf.args[y][b];
+				for (int k=tan_start[xb]; k<tan_start[xb+1]; k++)
+					work[tan_pos[k]]+=c*tan[k];
+			}
+		}
+
+		for (int k=adj_start[x]; k<adj_start[x+1]; k++) {
+			adj_tan[k]=work[adj_pos[k]];
+			work[adj_pos[k]]=Interval::ZERO;
+		}
+	}
+
+	// ============================ result ============================
+	// a variable can appear in several nodes (e.g., x[0] indexed twice)
+	for (int x=0; x<N; x++) {
+		if (kind[x]<0) continue;
+		for (int k=adj_start[x]; k<adj_start[x+1]; k++)
+			H[kind[x]][var[adj_pos[k]]] += adj_tan[k];
+	}
+
+	// the Hessian matrix is symmetric
+	for (int i=0; i<p; i++) {
+		for (int j=i; j<p; j++) {
+			Interval h=H[var[i]][var[j]] & H[var[j]][var[i]];
+			if (h.is_empty()) {
+				H.set_empty();
+				return;
+			}
+			H[var[i]][var[j]]=h;
+			H[var[j]][var[i]]=h;
+		}
+	}
+}
+
+bool Hessian::has_d2(int y, int a, int b) const {
+
+	switch (f.cf.code[y]) {
+	case CompiledFunction::ADD:
+	case CompiledFunction::SUB:
+	case CompiledFunction::MINUS:
+		return false;
+	case CompiledFunction::MUL:
+		return a!=b;
+	default:
+		return true;
+	}
+}
+
+void Hessian::partials(int y, Interval* d1, Interval* d2) const {
+
+	const CompiledFunction& cf=f.cf;
+	int* x=cf.args[y];
+
+	for (int i=0; i<9; i++) d2[i]=Interval::ZERO;
+
+	const Interval& x1=d[x[0]].i();
+	const Interval& fy=d[y].i();
+
+	switch (cf.code[y]) {
+	case CompiledFunction::CHI:
+	{
+		// chi(a,b,c)=b if a<=0, c otherwise
+		if (x1.ub()<0) {
+			d1[0]=Interval::ZERO; d1[1]=Interval::ONE; d1[2]=Interval::ZERO;
+		} else if (x1.lb()>0) {
+			d1[0]=Interval::ZERO; d1[1]=Interval::ZERO; d1[2]=Interval::ONE;
+		} else {
+			// not differentiable
+			d1[0]=Interval::ALL_REALS; d1[1]=Interval(0,1); d1[2]=Interval(0,1);
+			for (int i=0; i<9; i++) d2[i]=Interval::ALL_REALS;
+		}
+		break;
+	}
+	case CompiledFunction::ADD:
+		d1[0]=Interval::ONE;  d1[1]=Interval::ONE;
+		break;
+	case CompiledFunction::SUB:
+		d1[0]=Interval::ONE;  d1[1]=-Interval::ONE;
+		break;
+	case CompiledFunction::MUL:
+		d1[0]=d[x[1]].i();    d1[1]=x1;
+		d2[1]=Interval::ONE;  d2[3]=Interval::ONE;
+		break;
+	case CompiledFunction::DIV:
+	{
+		const Interval& x2=d[x[1]].i();
+		Interval s=sqr(x2);
+		d1[0]=1.0/x2;
+		d1[1]=-x1/s;
+		d2[1]=-1.0/s; d2[3]=d2[1];
+		d2[4]=2.0*x1/(s*x2);
+		break;
+	}
+	case CompiledFunction::MAX:
+	case CompiledFunction::MIN:
+	{
+		const Interval& x2=d[x[1]].i();
+		bool max=(cf.code[y]==CompiledFunction::MAX);
+		if (x1.lb()>x2.ub()) {
+			d1[0]=max? Interval::ONE : Interval::ZERO;
+			d1[1]=max? Interval::ZERO : Interval::ONE;
+		} else if (x2.lb()>x1.ub()) {
+			d1[0]=max? Interval::ZERO : Interval::ONE;
+			d1[1]=max? Interval::ONE : Interval::ZERO;
+		} else {
+			// not differentiable
+			d1[0]=Interval(0,1); d1[1]=Interval(0,1);
+			d2[0]=d2[1]=d2[3]=d2[4]=Interval::ALL_REALS;
+		}
+		break;
+	}
+	case CompiledFunction::ATAN2:
+	{
+		const Interval& x2=d[x[1]].i();
+		Interval r=sqr(x1)+sqr(x2);
+		Interval r2=sqr(r);
+		d1[0]=x2/r;
+		d1[1]=-x1/r;
+		d2[0]=-2.0*x1*x2/r2;
+		d2[1]=(sqr(x1)-sqr(x2))/r2; d2[3]=d2[1];
+		d2[4]=2.0*x1*x2/r2;
+		break;
+	}
+	case CompiledFunction::MINUS:
+		d1[0]=-Interval::ONE;
+		break;
+	case CompiledFunction::SIGN:
+		if (x1.contains(0)) {
+			// not differentiable
+			d1[0]=Interval::POS_REALS;
+			d2[0]=Interval::ALL_REALS;
+		} else
+			d1[0]=Interval::ZERO;
+		break;
+	case CompiledFunction::ABS:
+		if (x1.lb()>0) d1[0]=Interval::ONE;
+		else if (x1.ub()<0) d1[0]=-Interval::ONE;
+		else {
+			// not differentiable
+			d1[0]=Interval(-1,1);
+			d2[0]=Interval::ALL_REALS;
+		}
+		break;
+	case CompiledFunction::POWER:
+	{
+		int e=((const ExprPower&) f.node(y)).expon;
+		if (e==0) d1[0]=Interval::ZERO;
+		else if (e==1) d1[0]=Interval::ONE;
+		else if (e==2) {
+			d1[0]=2.0*x1;
+			d2[0]=Interval(2);
+		} else {
+			d1[0]=e*pow(x1,e-1);
+			d2[0]=e*(e-1)*pow(x1,e-2);
+		}
+		break;
+	}
+	case CompiledFunction::SQR:
+		d1[0]=2.0*x1;
+		d2[0]=Interval(2);
+		break;
+	case CompiledFunction::SQRT:
+		d1[0]=0.5/fy;
+		d2[0]=-0.25/(x1*fy);
+		break;
+	case CompiledFunction::EXP:
+		d1[0]=fy;
+		d2[0]=fy;
+		break;
+	case CompiledFunction::LOG:
+		d1[0]=1.0/x1;
+		d2[0]=-1.0/sqr(x1);
+		break;
+	case CompiledFunction::COS:
+		d1[0]=-sin(x1);
+		d2[0]=-fy;
+		break;
+	case CompiledFunction::SIN:
+		d1[0]=cos(x1);
+		d2[0]=-fy;
+		break;
+	case CompiledFunction::TAN:
+		d1[0]=1.0+sqr(fy);
+		d2[0]=2.0*fy*d1[0];
+		break;
+	case CompiledFunction::COSH:
+		d1[0]=sinh(x1);
+		d2[0]=fy;
+		break;
+	case CompiledFunction::SINH:
+		d1[0]=cosh(x1);
+		d2[0]=fy;
+		break;
+	case CompiledFunction::TANH:
+		d1[0]=1.0-sqr(fy);
+		d2[0]=-2.0*fy*d1[0];
+		break;
+	case CompiledFunction::ACOS:
+	{
+		Interval s=1.0-sqr(x1);
+		d1[0]=-1.0/sqrt(s);
+		d2[0]=d1[0]*x1/s;
+		break;
+	}
+	case CompiledFunction::ASIN:
+	{
+		Interval s=1.0-sqr(x1);
+		d1[0]=1.0/sqrt(s);
+		d2[0]=d1[0]*x1/s;
+		break;
+	}
+	case CompiledFunction::ATAN:
+	{
+		Interval s=1.0+sqr(x1);
+		d1[0]=1.0/s;
+		d2[0]=-2.0*x1/sqr(s);
+		break;
+	}
+	case CompiledFunction::ACOSH:
+	{
+		Interval s=sqr(x1)-1.0;
+		d1[0]=1.0/sqrt(s);
+		d2[0]=-d1[0]*x1/s;
+		break;
+	}
+	case CompiledFunction::ASINH:
+	{
+		Interval s=1.0+sqr(x1);
+		d1[0]=1.0/sqrt(s);
+		d2[0]=-d1[0]*x1/s;
+		break;
+	}
+	case CompiledFunction::ATANH:
+	{
+		Interval s=1.0-sqr(x1);
+		d1[0]=1.0/s;
+		d2[0]=2.0*x1/sqr(s);
+		break;
+	}
+	default:
+		assert(false); // not a scalar operation
+	}
+}
+
+} // namespace ibex
@@ -0,0 +1,117 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Hessian.h
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_HESSIAN_H__
+#define __IBEX_HESSIAN_H__
+
+#include "ibex_Eval.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup symbolic
+ *
+ * \brief Calculates the Hessian matrix of a real-valued function.
+ *
+ * The Hessian matrix is calculated by automatic differentiation in
+ * "forward-over-reverse" mode on the compiled function:
+ * - a forward sweep calculates the value of each node (see #ibex::Eval), its
+ *   local first and second partial derivatives and the tangent of the node (the
+ *   gradient of the node w.r.t. the variables f depends on);
+ * - a backward sweep calculates the adjoint of each node (as in #ibex::Gradient)
+ *   and the tangent of the adjoint, i.e., the derivative of the adjoint w.r.t.
+ *   the variables. The tangents of the adjoints of the variables form the Hessian matrix.
+ *
+ * The tangents are sparse: the tangent of a node only contains the variables
+ * it structurally depends on, so that the cost of the calculation is related to
+ * the sparsity of the Hessian matrix rather than to the number of variables.
+ * As the Hessian matrix is symmetric, the entries (i,j) and (j,i), calculated
+ * separately, are intersected.
+ *
+ * This mode applies when the DAG only contains scalar operations
+ * of (possibly indexed) variables. Otherwise, the Hessian matrix is obtained by
+ * differentiating the symbolic gradient of f (see #ibex::Function::diff()).
+ *
+ * If a function is not twice differentiable on the box (e.g., abs, max or sign of
+ * an argument that contains 0), the corresponding second derivatives are (-oo,+oo).
+ */
+class Hessian {
+public:
+	/**
+	 * \brief Build the Hessian algorithm.
+	 *
+	 * The data of the evaluator is shared (the values of the nodes).
+	 */
+	Hessian(Eval& eval);
+
+	/**
+	 * \brief Calculate the Hessian matrix of f on the box \a box and store the result in \a H.
+	 */
+	void hessian(const IntervalVector& box, IntervalMatrix& H);
+
+	Function& f;
+	Eval& _eval;
+	ExprDomain& d;
+
+private:
+	Hessian(const Hessian&);            // forbidden
+	Hessian& operator=(const Hessian&); // forbidden
+
+	/*
+	 * Classify the nodes and allocate the data (called once).
+	 */
+	void init();
+
+	/*
+	 * First and second partial derivatives of the scalar operation y w.r.t.
+	 * its arguments, stored in d1 (3 entries) and d2 (3x3 entries, row by row).
+	 */
+	void partials(int y, Interval* d1, Interval* d2) const;
+
+	/*
+	 * True if the second partial derivative of the scalar operation y
+	 * w.r.t. its arguments a and b is not structurally zero.
+	 */
+	bool has_d2(int y, int a, int b) const;
+
+	bool _init;                   // true if the data below are built
+	bool ad;                      // true if the automatic differentiation applies
+	int p;                        // number of variables f depends on
+	std::vector<int> kind;        // kind of each node (see CompiledFunction::scalar_kinds)
+	std::vector<int> pos;         // position of each variable (-1 if f does not depend on it)
+	std::vector<int> var;         // variable of each position
+
+	/*
+	 * The tangents are sparse: the tangent of a node only has entries for the
+	 * positions of its support, i.e., the variables the node depends on (for the
+	 * tangent of the value) or the variables its adjoint depends on (for the tangent
+	 * of the adjoint). The supports are calculated once from the structure of the DAG
+	 * and stored in compressed form: the support of the yth node is
+	 * tan_pos[tan_start[y]...tan_start[y+1]-1] (same for adj_pos).
+	 */
+	std::vector<int> tan_start, tan_pos;
+	std::vector<int> adj_start, adj_pos;
+
+	// parents of each node: par_node[par_start[y]...par_start[y+1]-1],
+	// par_arg gives the argument number of y in the parent.
+	std::vector<int> par_start, par_node, par_arg;
+
+	std::vector<Interval> d1;     // first partial derivatives of each node
+	std::vector<Interval> d2;     // second partial derivatives of each node
+	std::vector<Interval> tan;    // tangent of each node (sparse)
+	std::vector<Interval> adj;    // adjoint of each node
+	std::vector<Interval> adj_tan;// tangent of the adjoint of each node (sparse)
+	std::vector<Interval> work;   // dense tangent (p entries)
+};
+
+} // namespace ibex
+
+#endif // __IBEX_HESSIAN_H__
@@ -13,7 +13,7 @@
 
 namespace ibex {
 
-InHC4Revise::InHC4Revise(Eval& e) : f(e.f), eval(e), d(e.d), p_eval(f), p(p_eval.d) {
+InHC4Revise::InHC4Revise(Eval& e) : f(e.f), eval(e), d(e.d), p_eval(e), p(p_eval.d) {
 
 }
 
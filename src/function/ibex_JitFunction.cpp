@@ -0,0 +1,890 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_JitFunction.cpp
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_JitFunction.h"
+#include "ibex_Lock.h"
+
+#include <map>
+#include <sstream>
+#include <fstream>
+#include <cstdio>
+#include <cstdlib>
+#include <cassert>
+
+#ifdef _IBEX_WITH_JIT_
+#include <vector>
+#include <cerrno>
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * Version of the generated code. Must be incremented each time
+ * the runtime table or the calling conventions are modified
+ * (invalidates the libraries cached on disk).
+ */
+const int JIT_VERSION=1;
+
+/*
+ * Entries of the runtime table, i.e., the interval operations
+ * called by the native code.
+ */
+enum {
+	RT_COPY, RT_SUBSET, RT_INTER,
+
+	F_CHI, F_ADD, F_MUL, F_SUB, F_DIV, F_MAX, F_MIN, F_ATAN2,
+	F_MINUS, F_SIGN, F_ABS, F_POWER, F_SQR, F_SQRT, F_EXP, F_LOG,
+	F_COS, F_SIN, F_TAN, F_COSH, F_SINH, F_TANH,
+	F_ACOS, F_ASIN, F_ATAN, F_ACOSH, F_ASINH, F_ATANH,
+
+	B_CHI, B_ADD, B_MUL, B_SUB, B_DIV, B_MAX, B_MIN, B_ATAN2,
+	B_MINUS, B_SIGN, B_ABS, B_POWER, B_SQR, B_SQRT, B_EXP, B_LOG,
+	B_COS, B_SIN, B_TAN, B_COSH, B_SINH, B_TANH,
+	B_ACOS, B_ASIN, B_ATAN, B_ACOSH, B_ASINH, B_ATANH,
+
+	G_CHI, G_ADD, G_MUL, G_SUB, G_DIV, G_MAX, G_MIN, G_ATAN2,
+	G_MINUS, G_SIGN, G_ABS, G_POWER, G_SQR, G_SQRT, G_EXP, G_LOG,
+	G_COS, G_SIN, G_TAN, G_COSH, G_SINH, G_TANH,
+	G_ACOS, G_ASIN, G_ATAN, G_ACOSH, G_ASINH, G_ATANH,
+
+	NB_RT
+};
+
+/*
+ * The runtime functions. All the forward (resp. backward) functions
+ * return 0 if the result (resp. one of the contracted domains) is empty.
+ * The gradient functions add the partial derivatives to the gradient
+ * domains of the arguments (same rules as in Gradient).
+ */
+int rt_copy  (const Interval* x, Interval* y) { *y=*x; return 1; }
+int rt_subset(const Interval* y, const Interval* x) { return x->is_subset(*y); }
+int rt_inter (const Interval* y, Interval* x) { return !(*x &= *y).is_empty(); }
+
+int f_chi  (const Interval* a, const Interval* b, const Interval* c, Interval* y) { return !(*y=chi(*a,*b,*c)).is_empty(); }
+int f_add  (const Interval* x1, const Interval* x2, Interval* y) { return !(*y=*x1+*x2).is_empty(); }
+int f_mul  (const Interval* x1, const Interval* x2, Interval* y) { return !(*y=*x1**x2).is_empty(); }
+int f_sub  (const Interval* x1, const Interval* x2, Interval* y) { return !(*y=*x1-*x2).is_empty(); }
+int f_div  (const Interval* x1, const Interval* x2, Interval* y) { return !(*y=*x1/ *x2).is_empty(); }
+int f_max  (const Interval* x1, const Interval* x2, Interval* y) { return !(*y=max(*x1,*x2)).is_empty(); }
+int f_min  (const Interval* x1, const Interval* x2, Interval* y) { return !(*y=min(*x1,*x2)).is_empty(); }
+int f_atan2(const Interval* x1, const Interval* x2, Interval* y) { return !(*y=atan2(*x1,*x2)).is_empty(); }
+int f_minus(const Interval* x, Interval* y) { return !(*y=-*x).is_empty(); }
+int f_power(const Interval* x, int p, Interval* y) { return !(*y=pow(*x,p)).is_empty(); }
+
+int b_chi  (const Interval* y, Interval* a, Interval* b, Interval* c) { return bwd_chi(*y,*a,*b,*c); }
+int b_add  (const Interval* y, Interval* x1, Interval* x2) { return bwd_add(*y,*x1,*x2); }
+int b_mul  (const Interval* y, Interval* x1, Interval* x2) { return bwd_mul(*y,*x1,*x2); }
+int b_sub  (const Interval* y, Interval* x1, Interval* x2) { return bwd_sub(*y,*x1,*x2); }
+int b_div  (const Interval* y, Interval* x1, Interval* x2) { return bwd_div(*y,*x1,*x2); }
+int b_max  (const Interval* y, Interval* x1, Interval* x2) { return bwd_max(*y,*x1,*x2); }
+int b_min  (const Interval* y, Interval* x1, Interval* x2) { return bwd_min(*y,*x1,*x2); }
+int b_atan2(const Interval* y, Interval* x1, Interval* x2) { return bwd_atan2(*y,*x1,*x2); }
+int b_minus(const Interval* y, Interval* x) { return !(*x &= -*y).is_empty(); }
+int b_power(const Interval* y, int p, Interval* x) { return bwd_pow(*y,p,*x); }
+
+#define JIT_UNARY(op) \
+	int f_##op(const Interval* x, Interval* y) { return !(*y=op(*x)).is_empty(); } \
+	int b_##op(const Interval* y, Interval* x) { return bwd_##op(*y,*x); }
+
+JIT_UNARY(sign)  JIT_UNARY(abs)   JIT_UNARY(sqr)   JIT_UNARY(sqrt)
+JIT_UNARY(exp)   JIT_UNARY(log)   JIT_UNARY(cos)   JIT_UNARY(sin)
+JIT_UNARY(tan)   JIT_UNARY(cosh)  JIT_UNARY(sinh)  JIT_UNARY(tanh)
+JIT_UNARY(acos)  JIT_UNARY(asin)  JIT_UNARY(atan)  JIT_UNARY(acosh)
+JIT_UNARY(asinh) JIT_UNARY(atanh)
+
+#undef JIT_UNARY
+
+void g_chi(const Interval* gy, const Interval* a, const Interval* b, const Interval* c, Interval* ga, Interval* gb, Interval* gc) {
+	Interval da,db,dc;
+
+	if (a->ub()<0) {
+		da=Interval::ZERO;
+		db=Interval::ONE;
+		dc=Interval::ZERO;
+	} else if (a->lb()>0) {
+		da=Interval::ZERO;
+		db=Interval::ZERO;
+		dc=Interval::ONE;
+	} else {
+		if (b->is_degenerated() && c->is_degenerated()) {
+			if (b->ub()<c->ub()) da=Interval::POS_REALS;
+			else if (b->ub()>c->ub()) da=Interval::NEG_REALS;
+			else da=Interval::ZERO;
+		} else
+			da=Interval::ALL_REALS;
+		db=Interval(0,1);
+		dc=Interval(0,1);
+	}
+
+	*ga += *gy * da;
+	*gb += *gy * db;
+	*gc += *gy * dc;
+}
+
+void g_add(const Interval* gy, const Interval*, const Interval*, Interval* g1, Interval* g2) {
+	*g1 += *gy;
+	*g2 += *gy;
+}
+
+void g_mul(const Interval* gy, const Interval* x1, const Interval* x2, Interval* g1, Interval* g2) {
+	*g1 += *gy * *x2;
+	*g2 += *gy * *x1;
+}
+
+void g_sub(const Interval* gy, const Interval*, const Interval*, Interval* g1, Interval* g2) {
+	*g1 += *gy;
+	*g2 += -*gy;
+}
+
+void g_div(const Interval* gy, const Interval* x1, const Interval* x2, Interval* g1, Interval* g2) {
+	*g1 += *gy / *x2;
+	*g2 += *gy*(-*x1)/sqr(*x2);
+}
+
+void g_max(const Interval* gy, const Interval* x1, const Interval* x2, Interval* g1, Interval* g2) {
+	if (x1->lb() > x2->ub())      *g1 += *gy;
+	else if (x2->lb() > x1->ub()) *g2 += *gy;
+	else {
+		*g1 += *gy * Interval(0,1);
+		*g2 += *gy * Interval(0,1);
+	}
+}
+
+void g_min(const Interval* gy, const Interval* x1, const Interval* x2, Interval* g1, Interval* g2) {
+	if (x1->lb() > x2->ub())      *g2 += *gy;
+	else if (x2->lb() > x1->ub()) *g1 += *gy;
+	else {
+		*g1 += *gy * Interval(0,1);
+		*g2 += *gy * Interval(0,1);
+	}
+}
+
+void g_atan2(const Interval* gy, const Interval* x1, const Interval* x2, Interval* g1, Interval* g2) {
+	*g1 += *gy * *x2 / (sqr(*x2) + sqr(*x1));
+	*g2 += *gy * - *x1 / (sqr(*x2) + sqr(*x1));
+}
+
+void g_minus(const Interval* gy, const Interval*, Interval* gx) { *gx += -1.0**gy; }
+
+void g_sign(const Interval* gy, const Interval* x, Interval* gx) {
+	if (x->contains(0)) *gx += *gy*Interval::POS_REALS;
+}
+
+void g_abs(const Interval* gy, const Interval* x, Interval* gx) {
+	if (x->lb()>0) *gx += 1.0**gy;
+	else if (x->ub()<0) *gx += -1.0**gy;
+	else *gx += Interval(-1,1)**gy;
+}
+
+void g_power(const Interval* gy, const Interval* x, int p, Interval* gx) { *gx += *gy * p * pow(*x, p-1); }
+
+void g_sqr  (const Interval* gy, const Interval* x, Interval* gx) { *gx += *gy * 2.0 * *x; }
+void g_sqrt (const Interval* gy, const Interval* x, Interval* gx) { *gx += *gy * 0.5 / sqrt(*x); }
+void g_exp  (const Interval* gy, const Interval* x, Interval* gx) { *gx += *gy * exp(*x); }
+void g_log  (const Interval* gy, const Interval* x, Interval* gx) { *gx += *gy / *x; }
+void g_cos  (const Interval* gy, const Interval* x, Interval* gx) { *gx += *gy * -sin(*x); }
+void g_sin  (const Interval* gy, const Interval* x, Interval* gx) { *gx += *gy * cos(*x); }
+void g_tan  (const Interval* gy, const Interval* x, Interval* gx) { *gx += *gy * (1.0 + sqr(tan(*x))); }
+void g_cosh (const Interval* gy, const Interval* x, Interval* gx) { *gx += *gy * sinh(*x); }
+void g_sinh (const Interval* gy, const Interval* x, Interval* gx) { *gx += *gy * cosh(*x); }
+void g_tanh (const Interval* gy, const Interval* x, Interval* gx) { *gx += *gy * (1.0 - sqr(tanh(*x))); }
+void g_acos (const Interval* gy, const Interval* x, Interval* gx) { *gx += *gy * -1.0 / sqrt(1.0-sqr(*x)); }
+void g_asin (const Interval* gy, const Interval* x, Interval* gx) { *gx += *gy * 1.0 / sqrt(1.0-sqr(*x)); }
+void g_atan (const Interval* gy, const Interval* x, Interval* gx) { *gx += *gy * 1.0 / (1.0+sqr(*x)); }
+void g_acosh(const Interval* gy, const Interval* x, Interval* gx) { *gx += *gy * 1.0 / sqrt(sqr(*x) -1.0); }
+void g_asinh(const Interval* gy, const Interval* x, Interval* gx) { *gx += *gy * 1.0 / sqrt(1.0+sqr(*x)); }
+void g_atanh(const Interval* gy, const Interval* x, Interval* gx) { *gx += *gy * 1.0 / (1.0-sqr(*x)); }
+
+typedef void (*rt_fn)();
+
+/*
+ * The runtime table.
+ */
+class Runtime {
+public:
+	Runtime() {
+		for (int i=0; i<NB_RT; i++) table[i]=NULL;
+
+		set(RT_COPY,rt_copy);   set(RT_SUBSET,rt_subset); set(RT_INTER,rt_inter);
+
+		set(F_CHI,f_chi);       set(B_CHI,b_chi);       set(G_CHI,g_chi);
+		set(F_ADD,f_add);       set(B_ADD,b_add);       set(G_ADD,g_add);
+		set(F_MUL,f_mul);       set(B_MUL,b_mul);       set(G_MUL,g_mul);
+		set(F_SUB,f_sub);       set(B_SUB,b_sub);       set(G_SUB,g_sub);
+		set(F_DIV,f_div);       set(B_DIV,b_div);       set(G_DIV,g_div);
+		set(F_MAX,f_max);       set(B_MAX,b_max);       set(G_MAX,g_max);
+		set(F_MIN,f_min);       set(B_MIN,b_min);       set(G_MIN,g_min);
+		set(F_ATAN2,f_atan2);   set(B_ATAN2,b_atan2);   set(G_ATAN2,g_atan2);
+		set(F_MINUS,f_minus);   set(B_MINUS,b_minus);   set(G_MINUS,g_minus);
+		set(F_SIGN,f_sign);     set(B_SIGN,b_sign);     set(G_SIGN,g_sign);
+		set(F_ABS,f_abs);       set(B_ABS,b_abs);       set(G_ABS,g_abs);
+		set(F_POWER,f_power);   set(B_POWER,b_power);   set(G_POWER,g_power);
+		set(F_SQR,f_sqr);       set(B_SQR,b_sqr);       set(G_SQR,g_sqr);
+		set(F_SQRT,f_sqrt);     set(B_SQRT,b_sqrt);     set(G_SQRT,g_sqrt);
+		set(F_EXP,f_exp);       set(B_EXP,b_exp);       set(G_EXP,g_exp);
+		set(F_LOG,f_log);       set(B_LOG,b_log);       set(G_LOG,g_log);
+		set(F_COS,f_cos);       set(B_COS,b_cos);       set(G_COS,g_cos);
+		set(F_SIN,f_sin);       set(B_SIN,b_sin);       set(G_SIN,g_sin);
+		set(F_TAN,f_tan);       set(B_TAN,b_tan);       set(G_TAN,g_tan);
+		set(F_COSH,f_cosh);     set(B_COSH,b_cosh);     set(G_COSH,g_cosh);
+		set(F_SINH,f_sinh);     set(B_SINH,b_sinh);     set(G_SINH,g_sinh);
+		set(F_TANH,f_tanh);     set(B_TANH,b_tanh);     set(G_TANH,g_tanh);
+		set(F_ACOS,f_acos);     set(B_ACOS,b_acos);     set(G_ACOS,g_acos);
+		set(F_ASIN,f_asin);     set(B_ASIN,b_asin);     set(G_ASIN,g_asin);
+		set(F_ATAN,f_atan);     set(B_ATAN,b_atan);     set(G_ATAN,g_atan);
+		set(F_ACOSH,f_acosh);   set(B_ACOSH,b_acosh);   set(G_ACOSH,g_acosh);
+		set(F_ASINH,f_asinh);   set(B_ASINH,b_asinh);   set(G_ASINH,g_asinh);
+		set(F_ATANH,f_atanh);   set(B_ATANH,b_atanh);   set(G_ATANH,g_atanh);
+
+		for (int i=0; i<NB_RT; i++) assert(table[i]!=NULL);
+	}
+
+	template<class F>
+	void set(int i, F f) { table[i]=reinterpret_cast<rt_fn>(f); }
+
+	rt_fn table[NB_RT];
+};
+
+const Runtime runtime;
+
+/*
+ * Index of a component of a symbol in the box.
+ */
+int flat_index(const Dim& dim, const DoubleIndex& idx) {
+	switch (dim.type()) {
+	case Dim::COL_VECTOR: return idx.first_row();
+	case Dim::ROW_VECTOR: return idx.first_col();
+	default:              return idx.first_row()*dim.nb_cols()+idx.first_col();
+	}
+}
+
+/*
+ * FNV-1a hash of a string (hexadecimal).
+ */
+string source_hash(const string& s) {
+	unsigned long long h=14695981039346656037ULL;
+	for (size_t i=0; i<s.size(); i++) {
+		h ^= (unsigned char) s[i];
+		h *= 1099511628211ULL;
+	}
+	char buf[17];
+	sprintf(buf,"%016llx",h);
+	return buf;
+}
+
+/*
+ * Cache of the libraries loaded in the process (hash -> library).
+ */
+struct CachedLibrary {
+	string source;
+	void* handle;
+};
+
+map<string,CachedLibrary> cache;
+
+Lock cache_lock;
+
+} // end anonymous namespace
+
+/*
+ * Generator of the native code.
+ *
+ * The code is emitted by running the forward (resp. backward)
+ * algorithm of the compiled function: each operation prints the
+ * corresponding call to the runtime table.
+ */
+class JitGenerator : public FwdAlgorithm, public BwdAlgorithm {
+public:
+	typedef enum { FWD, HC4, GRAD } mode;
+
+	JitGenerator(JitFunction& jit, ostream& os) : jit(jit), os(os), m(FWD), root(jit.f.nodes.rank(jit.f.expr())), supported(true) { }
+
+	/*
+	 * Emit the code of a phase.
+	 */
+	void emit(mode _m) {
+		m=_m;
+		if (m==FWD)
+			jit.f.forward<JitGenerator>(*this);
+		else
+			jit.f.backward<JitGenerator>(*this);
+	}
+
+	/*
+	 * Domain of a node in the generated code.
+	 */
+	string dom(int y) const {
+		ostringstream s;
+		if (jit.var[y]!=-1) s << "x+" << jit.var[y];
+		else s << "d+" << y;
+		return s.str();
+	}
+
+	/*
+	 * Gradient domain of a node in the generated code.
+	 */
+	string grad(int y) const {
+		ostringstream s;
+		if (jit.var[y]!=-1) s << "gx+" << jit.var[y];
+		else s << "g+" << y;
+		return s.str();
+	}
+
+	/*
+	 * Emit the code of an operation with one argument.
+	 */
+	void unary(int f, int b, int g, int x, int y) {
+		switch (m) {
+		case FWD:  os << "\tif (!((F1) rt[" << f << "])(" << dom(x) << "," << dom(y) << ")) return 0;\n"; break;
+		case HC4:  os << "\tif (!((B1) rt[" << b << "])(" << dom(y) << "," << dom(x) << ")) return -1;\n"; break;
+		case GRAD: os << "\t((G1) rt[" << g << "])(" << grad(y) << "," << dom(x) << "," << grad(x) << ");\n"; break;
+		}
+	}
+
+	/*
+	 * Emit the code of an operation with two arguments.
+	 */
+	void binary(int f, int b, int g, int x1, int x2, int y) {
+		switch (m) {
+		case FWD:  os << "\tif (!((F2) rt[" << f << "])(" << dom(x1) << "," << dom(x2) << "," << dom(y) << ")) return 0;\n"; break;
+		case HC4:  os << "\tif (!((B2) rt[" << b << "])(" << dom(y) << "," << dom(x1) << "," << dom(x2) << ")) return -1;\n"; break;
+		case GRAD: os << "\t((G2) rt[" << g << "])(" << grad(y) << "," << dom(x1) << "," << dom(x2) << "," << grad(x1) << "," << grad(x2) << ");\n"; break;
+		}
+	}
+
+	void unsupported() { supported=false; }
+
+	JitFunction& jit;
+	ostream& os;
+	mode m;
+	const int root;
+	bool supported;
+
+	// ================== forward phase ==================
+	void idx_fwd   (int, int y)    { if (jit.var[y]==-1) unsupported(); }
+	void idx_cp_fwd(int, int y)    { if (jit.var[y]==-1) unsupported(); }
+	void symbol_fwd(int)           { /* nothing to do (non-scalar symbols are only accessed by indices) */ }
+	void cst_fwd   (int y)         {
+		if (!jit.f.node(y).dim.is_scalar()) unsupported();
+		else os << "\t((F1) rt[" << RT_COPY << "])(c+" << y << ",d+" << y << ");\n";
+	}
+	void vector_fwd(int* x, int y) {
+		if (y!=root) { unsupported(); return; }
+		const ExprVector& v=(const ExprVector&) jit.f.node(y);
+		for (int i=0; i<v.nb_args; i++)
+			if (!v.arg(i).dim.is_scalar()) unsupported();
+	}
+	void apply_fwd (int*, int)     { unsupported(); }
+	void chi_fwd   (int a, int b, int c, int y) {
+		os << "\tif (!((F3) rt[" << F_CHI << "])(" << dom(a) << "," << dom(b) << "," << dom(c) << "," << dom(y) << ")) return 0;\n";
+	}
+	void add_fwd   (int x1, int x2, int y) { binary(F_ADD,B_ADD,G_ADD,x1,x2,y); }
+	void mul_fwd   (int x1, int x2, int y) { binary(F_MUL,B_MUL,G_MUL,x1,x2,y); }
+	void sub_fwd   (int x1, int x2, int y) { binary(F_SUB,B_SUB,G_SUB,x1,x2,y); }
+	void div_fwd   (int x1, int x2, int y) { binary(F_DIV,B_DIV,G_DIV,x1,x2,y); }
+	void max_fwd   (int x1, int x2, int y) { binary(F_MAX,B_MAX,G_MAX,x1,x2,y); }
+	void min_fwd   (int x1, int x2, int y) { binary(F_MIN,B_MIN,G_MIN,x1,x2,y); }
+	void atan2_fwd (int x1, int x2, int y) { binary(F_ATAN2,B_ATAN2,G_ATAN2,x1,x2,y); }
+	void minus_fwd (int x, int y)  { unary(F_MINUS,B_MINUS,G_MINUS,x,y); }
+	void sign_fwd  (int x, int y)  { unary(F_SIGN,B_SIGN,G_SIGN,x,y); }
+	void abs_fwd   (int x, int y)  { unary(F_ABS,B_ABS,G_ABS,x,y); }
+	void power_fwd (int x, int y, int p) {
+		os << "\tif (!((FP) rt[" << F_POWER << "])(" << dom(x) << "," << p << "," << dom(y) << ")) return 0;\n";
+	}
+	void sqr_fwd   (int x, int y)  { unary(F_SQR,B_SQR,G_SQR,x,y); }
+	void sqrt_fwd  (int x, int y)  { unary(F_SQRT,B_SQRT,G_SQRT,x,y); }
+	void exp_fwd   (int x, int y)  { unary(F_EXP,B_EXP,G_EXP,x,y); }
+	void log_fwd   (int x, int y)  { unary(F_LOG,B_LOG,G_LOG,x,y); }
+	void cos_fwd   (int x, int y)  { unary(F_COS,B_COS,G_COS,x,y); }
+	void sin_fwd   (int x, int y)  { unary(F_SIN,B_SIN,G_SIN,x,y); }
+	void tan_fwd   (int x, int y)  { unary(F_TAN,B_TAN,G_TAN,x,y); }
+	void cosh_fwd  (int x, int y)  { unary(F_COSH,B_COSH,G_COSH,x,y); }
+	void sinh_fwd  (int x, int y)  { unary(F_SINH,B_SINH,G_SINH,x,y); }
+	void tanh_fwd  (int x, int y)  { unary(F_TANH,B_TANH,G_TANH,x,y); }
+	void acos_fwd  (int x, int y)  { unary(F_ACOS,B_ACOS,G_ACOS,x,y); }
+	void asin_fwd  (int x, int y)  { unary(F_ASIN,B_ASIN,G_ASIN,x,y); }
+	void atan_fwd  (int x, int y)  { unary(F_ATAN,B_ATAN,G_ATAN,x,y); }
+	void acosh_fwd (int x, int y)  { unary(F_ACOSH,B_ACOSH,G_ACOSH,x,y); }
+	void asinh_fwd (int x, int y)  { unary(F_ASINH,B_ASINH,G_ASINH,x,y); }
+	void atanh_fwd (int x, int y)  { unary(F_ATANH,B_ATANH,G_ATANH,x,y); }
+
+	// vector/matrix operations are not supported
+	void minus_V_fwd(int, int)     { unsupported(); }
+	void minus_M_fwd(int, int)     { unsupported(); }
+	void trans_V_fwd(int, int)     { unsupported(); }
+	void trans_M_fwd(int, int)     { unsupported(); }
+	void add_V_fwd (int, int, int) { unsupported(); }
+	void add_M_fwd (int, int, int) { unsupported(); }
+	void mul_SV_fwd(int, int, int) { unsupported(); }
+	void mul_SM_fwd(int, int, int) { unsupported(); }
+	void mul_VV_fwd(int, int, int) { unsupported(); }
+	void mul_MV_fwd(int, int, int) { unsupported(); }
+	void mul_VM_fwd(int, int, int) { unsupported(); }
+	void mul_MM_fwd(int, int, int) { unsupported(); }
+	void sub_V_fwd (int, int, int) { unsupported(); }
+	void sub_M_fwd (int, int, int) { unsupported(); }
+
+	// ================== backward phase (HC4 or gradient) ==================
+	void idx_bwd   (int, int)      { }
+	void idx_cp_bwd(int, int)      { }
+	void symbol_bwd(int)           { }
+	void cst_bwd   (int)           { }
+	void vector_bwd(int*, int)     { }
+	void apply_bwd (int*, int)     { }
+	void chi_bwd   (int a, int b, int c, int y) {
+		if (m==HC4)
+			os << "\tif (!((B3) rt[" << B_CHI << "])(" << dom(y) << "," << dom(a) << "," << dom(b) << "," << dom(c) << ")) return -1;\n";
+		else
+			os << "\t((G3) rt[" << G_CHI << "])(" << grad(y) << "," << dom(a) << "," << dom(b) << "," << dom(c) << ","
+			   << grad(a) << "," << grad(b) << "," << grad(c) << ");\n";
+	}
+	void add_bwd   (int x1, int x2, int y) { add_fwd(x1,x2,y); }
+	void mul_bwd   (int x1, int x2, int y) { mul_fwd(x1,x2,y); }
+	void sub_bwd   (int x1, int x2, int y) { sub_fwd(x1,x2,y); }
+	void div_bwd   (int x1, int x2, int y) { div_fwd(x1,x2,y); }
+	void max_bwd   (int x1, int x2, int y) { max_fwd(x1,x2,y); }
+	void min_bwd   (int x1, int x2, int y) { min_fwd(x1,x2,y); }
+	void atan2_bwd (int x1, int x2, int y) { atan2_fwd(x1,x2,y); }
+	void minus_bwd (int x, int y)  { minus_fwd(x,y); }
+	void sign_bwd  (int x, int y)  { sign_fwd(x,y); }
+	void abs_bwd   (int x, int y)  { abs_fwd(x,y); }
+	void power_bwd (int x, int y, int p) {
+		if (m==HC4)
+			os << "\tif (!((BP) rt[" << B_POWER << "])(" << dom(y) << "," << p << "," << dom(x) << ")) return -1;\n";
+		else
+			os << "\t((GP) rt[" << G_POWER << "])(" << grad(y) << "," << dom(x) << "," << p << "," << grad(x) << ");\n";
+	}
+	void sqr_bwd   (int x, int y)  { sqr_fwd(x,y); }
+	void sqrt_bwd  (int x, int y)  { sqrt_fwd(x,y); }
+	void exp_bwd   (int x, int y)  { exp_fwd(x,y); }
+	void log_bwd   (int x, int y)  { log_fwd(x,y); }
+	void cos_bwd   (int x, int y)  { cos_fwd(x,y); }
+	void sin_bwd   (int x, int y)  { sin_fwd(x,y); }
+	void tan_bwd   (int x, int y)  { tan_fwd(x,y); }
+	void cosh_bwd  (int x, int y)  { cosh_fwd(x,y); }
+	void sinh_bwd  (int x, int y)  { sinh_fwd(x,y); }
+	void tanh_bwd  (int x, int y)  { tanh_fwd(x,y); }
+	void acos_bwd  (int x, int y)  { acos_fwd(x,y); }
+	void asin_bwd  (int x, int y)  { asin_fwd(x,y); }
+	void atan_bwd  (int x, int y)  { atan_fwd(x,y); }
+	void acosh_bwd (int x, int y)  { acosh_fwd(x,y); }
+	void asinh_bwd (int x, int y)  { asinh_fwd(x,y); }
+	void atanh_bwd (int x, int y)  { atanh_fwd(x,y); }
+
+	// (only called if the forward phase is supported)
+	void minus_V_bwd(int, int)     { }
+	void minus_M_bwd(int, int)     { }
+	void trans_V_bwd(int, int)     { }
+	void trans_M_bwd(int, int)     { }
+	void add_V_bwd (int, int, int) { }
+	void add_M_bwd (int, int, int) { }
+	void mul_SV_bwd(int, int, int) { }
+	void mul_SM_bwd(int, int, int) { }
+	void mul_VV_bwd(int, int, int) { }
+	void mul_MV_bwd(int, int, int) { }
+	void mul_VM_bwd(int, int, int) { }
+	void mul_MM_bwd(int, int, int) { }
+	void sub_V_bwd (int, int, int) { }
+	void sub_M_bwd (int, int, int) { }
+};
+
+JitFunction::JitFunction(Function& f) : f(f), _compiled(false), nb_nodes(f.nodes.size()),
+		m(f.image_dim()), var(new int[nb_nodes]), out(new int[m]), cst(new Interval[nb_nodes]),
+		d(new Interval[nb_nodes]), g(new Interval[nb_nodes]), _fwd(NULL), _bwd(NULL), _grad(NULL) {
+
+	// first variable of each symbol in the box
+	int* offset=new int[f.nb_arg()];
+	for (int k=0, i=0; k<f.nb_arg(); k++) {
+		offset[k]=i;
+		i+=f.arg(k).dim.size();
+	}
+
+	for (int y=0; y<nb_nodes; y++) {
+		const ExprNode& e=f.node(y);
+
+		var[y]=-1;
+
+		if (const ExprSymbol* s=dynamic_cast<const ExprSymbol*>(&e)) {
+			if (e.dim.is_scalar()) var[y]=offset[s->key];
+		} else if (const ExprIndex* idx=dynamic_cast<const ExprIndex*>(&e)) {
+			const ExprSymbol* s=dynamic_cast<const ExprSymbol*>(&idx->expr);
+			if (s && e.dim.is_scalar()) var[y]=offset[s->key]+flat_index(s->dim, idx->index);
+		} else if (const ExprConstant* c=dynamic_cast<const ExprConstant*>(&e)) {
+			if (e.dim.is_scalar()) cst[y]=c->get_value();
+		}
+	}
+
+	delete[] offset;
+
+	string source;
+
+	if (generate(source)) {
+		_hash=source_hash(source);
+		_compiled=load(source);
+	}
+}
+
+JitFunction::~JitFunction() {
+	delete[] var;
+	delete[] out;
+	delete[] cst;
+	delete[] d;
+	delete[] g;
+}
+
+bool JitFunction::generate(string& source) {
+
+	if (f.expr().dim.is_matrix()) return false;
+
+	// the native code sees intervals as arrays of doubles
+	if (sizeof(Interval)%sizeof(double)!=0) return false;
+
+	int root=f.nodes.rank(f.expr());
+
+	if (m==1 && f.expr().dim.is_scalar())
+		out[0]=root;
+	else {
+		const ExprVector* vec=dynamic_cast<const ExprVector*>(&f.expr());
+		if (!vec) return false;
+		for (int i=0; i<m; i++)
+			out[i]=f.nodes.rank(vec->arg(i));
+	}
+
+	ostringstream os;
+	JitGenerator gen(*this,os);
+
+	os << "// Native code of a function, generated by Ibex (version " << JIT_VERSION << ")\n"
+	   << "typedef void (*R)();\n"
+	   << "typedef struct { double v[" << sizeof(Interval)/sizeof(double) << "]; } I;\n"
+	   << "typedef int (*F1)(const I*, I*);\n"
+	   << "typedef int (*F2)(const I*, const I*, I*);\n"
+	   << "typedef int (*F3)(const I*, const I*, const I*, I*);\n"
+	   << "typedef int (*FP)(const I*, int, I*);\n"
+	   << "typedef int (*B1)(const I*, I*);\n"
+	   << "typedef int (*B2)(const I*, I*, I*);\n"
+	   << "typedef int (*B3)(const I*, I*, I*, I*);\n"
+	   << "typedef int (*BP)(const I*, int, I*);\n"
+	   << "typedef void (*G1)(const I*, const I*, I*);\n"
+	   << "typedef void (*G2)(const I*, const I*, const I*, I*, I*);\n"
+	   << "typedef void (*G3)(const I*, const I*, const I*, const I*, I*, I*, I*);\n"
+	   << "typedef void (*GP)(const I*, const I*, int, I*);\n\n";
+
+	// forward: return 0 if the image is empty
+	os << "static int fwd(const R* rt, const I* x, const I* c, I* d) {\n";
+	gen.emit(JitGenerator::FWD);
+	os << "\treturn 1;\n}\n\n";
+
+	if (!gen.supported) return false;
+
+	os << "extern \"C\" int ibex_jit_fwd(const R* rt, const I* x, const I* c, I* d) {\n"
+	   << "\treturn fwd(rt,x,c,d);\n}\n\n";
+
+	// HC4: return -1 if x is empty, 1 if f(x) is included in y, 0 otherwise
+	os << "extern \"C\" int ibex_jit_bwd(const R* rt, const I* y, I* x, const I* c, I* d) {\n"
+	   << "\tif (!fwd(rt,x,c,d)) return -1;\n"
+	   << "\tif (";
+	for (int i=0; i<m; i++)
+		os << (i>0? " && " : "") << "((F1) rt[" << RT_SUBSET << "])(y+" << i << "," << gen.dom(out[i]) << ")";
+	os << ") return 1;\n";
+	for (int i=0; i<m; i++)
+		os << "\tif (!((B1) rt[" << RT_INTER << "])(y+" << i << "," << gen.dom(out[i]) << ")) return -1;\n";
+	gen.emit(JitGenerator::HC4);
+	os << "\treturn 0;\n}\n\n";
+
+	// gradient: return 0 if the image is empty. The gradient domains
+	// must be initialized to 0, except the root's one, to 1.
+	os << "extern \"C\" int ibex_jit_grad(const R* rt, const I* x, const I* c, I* d, I* g, I* gx) {\n"
+	   << "\tif (!fwd(rt,x,c,d)) return 0;\n";
+	if (m==1 && f.expr().dim.is_scalar())
+		gen.emit(JitGenerator::GRAD);
+	os << "\treturn 1;\n}\n";
+
+	source=os.str();
+	return true;
+}
+
+#ifdef _IBEX_WITH_JIT_
+
+namespace {
+
+/*
+ * Read a whole file (empty string if the file does not exist).
+ */
+string read_file(const string& filename) {
+	ifstream f(filename.c_str(), ios::in | ios::binary);
+	if (!f) return "";
+	ostringstream s;
+	s << f.rdbuf();
+	return s.str();
+}
+
+/*
+ * True if the path is a directory (resp. a regular file and not a symbolic link)
+ * owned by the user, that cannot be written by the group or the others.
+ */
+bool is_private(const string& path, bool dir) {
+	struct stat st;
+	if (dir) {
+		if (stat(path.c_str(), &st)!=0 || !S_ISDIR(st.st_mode)) return false;
+	} else {
+		if (lstat(path.c_str(), &st)!=0 || !S_ISREG(st.st_mode)) return false;
+	}
+	return st.st_uid==geteuid() && (st.st_mode & (S_IWGRP | S_IWOTH))==0;
+}
+
+/*
+ * Directory of the libraries, created if necessary.
+ * Return an empty string if the directory is not private (another
+ * user could replace the libraries loaded in the process).
+ */
+string cache_dir() {
+	const char* dir=getenv("IBEX_JIT_DIR");
+	string path;
+
+	if (dir && *dir)
+		path=dir;
+	else {
+		const char* tmp=getenv("TMPDIR");
+		ostringstream s;
+		s << (tmp && *tmp? tmp : "/tmp") << "/ibex-jit-" << geteuid();
+		path=s.str();
+	}
+
+	mkdir(path.c_str(), S_IRWXU); // fails if the directory already exists
+
+	return is_private(path,true)? path : "";
+}
+
+/*
+ * Run the compiler (directly, without shell).
+ * Return true in case of success.
+ */
+bool compile(const string& cpp, const string& so) {
+	const char* cxx=getenv("IBEX_JIT_CXX");
+
+	// the compiler can be given with options (e.g., "ccache c++")
+	vector<string> args;
+	istringstream s(cxx && *cxx? cxx : "c++");
+	string word;
+	while (s >> word) args.push_back(word);
+	if (args.empty()) return false;
+
+	args.push_back("-O2");
+	args.push_back("-fPIC");
+	args.push_back("-shared");
+	args.push_back("-o");
+	args.push_back(so);
+	args.push_back(cpp);
+
+	vector<char*> argv;
+	for (vector<string>::iterator it=args.begin(); it!=args.end(); it++)
+		argv.push_back(const_cast<char*>(it->c_str()));
+	argv.push_back(NULL);
+
+	pid_t pid=fork();
+
+	if (pid==-1) return false;
+
+	if (pid==0) {
+		// the outputs of the compiler are discarded
+		int null=open("/dev/null", O_WRONLY);
+		if (null!=-1) {
+			dup2(null,STDOUT_FILENO);
+			dup2(null,STDERR_FILENO);
+		}
+		execvp(argv[0], &argv[0]);
+		_exit(127);
+	}
+
+	int status;
+	while (waitpid(pid, &status, 0)==-1)
+		if (errno!=EINTR) return false;
+
+	return WIFEXITED(status) && WEXITSTATUS(status)==0;
+}
+
+/*
+ * Open the library from the disk cache or compile it.
+ */
+void* open_library(const string& hash, const string& source) {
+	string dir=cache_dir();
+	if (dir.empty()) return NULL;
+
+	string base=dir+"/ibex-jit-"+hash;
+	string cpp=base+".cpp";
+	string so=base+".so";
+
+	// the library has already been compiled by this process or another one
+	if (read_file(cpp)==source && is_private(so,false)) {
+		void* handle=dlopen(so.c_str(), RTLD_NOW | RTLD_LOCAL);
+		if (handle) return handle;
+	}
+
+	// the files are renamed once complete, so that concurrent
+	// processes never see incomplete files
+	ostringstream pid;
+	pid << "." << getpid();
+	string tmp_cpp=base+pid.str()+".cpp";
+	string tmp_so=so+pid.str();
+
+	{
+		ofstream f(tmp_cpp.c_str(), ios::out | ios::binary);
+		if (!f) return NULL;
+		f << source;
+		if (!f) return NULL;
+	}
+
+	if (!compile(tmp_cpp, tmp_so) || chmod(tmp_so.c_str(), S_IRWXU)!=0 || rename(tmp_so.c_str(), so.c_str())!=0) {
+		remove(tmp_cpp.c_str());
+		remove(tmp_so.c_str());
+		return NULL;
+	}
+
+	rename(tmp_cpp.c_str(), cpp.c_str());
+
+	if (!is_private(so,false)) return NULL;
+
+	return dlopen(so.c_str(), RTLD_NOW | RTLD_LOCAL);
+}
+
+} // end anonymous namespace
+
+bool JitFunction::load(const string& source) {
+	ScopedLock l(cache_lock);
+
+	void* handle;
+
+	map<string,CachedLibrary>::iterator it=cache.find(_hash);
+
+	if (it!=cache.end()) {
+		// collision of hash values: the function is not compiled
+		if (it->second.source!=source) return false;
+		handle=it->second.handle;
+	} else {
+		handle=open_library(_hash, source);
+		if (!handle) return false;
+		CachedLibrary& lib=cache[_hash];
+		lib.source=source;
+		lib.handle=handle;
+	}
+
+	*(void**) (&_fwd)  = dlsym(handle, "ibex_jit_fwd");
+	*(void**) (&_bwd)  = dlsym(handle, "ibex_jit_bwd");
+	*(void**) (&_grad) = dlsym(handle, "ibex_jit_grad");
+
+	return _fwd && _bwd && _grad;
+}
+
+#else
+
+bool JitFunction::load(const string&) {
+	return false;
+}
+
+#endif
+
+Interval JitFunction::eval(const IntervalVector& box) {
+	assert(f.expr().dim.is_scalar());
+
+	if (!_compiled)
+		return f.eval(box);
+
+	if (box.is_empty() || !_fwd(runtime.table, &box[0], cst, d))
+		return Interval::EMPTY_SET;
+
+	return var[out[0]]!=-1? box[var[out[0]]] : d[out[0]];
+}
+
+IntervalVector JitFunction::eval_vector(const IntervalVector& box) {
+	assert(f.expr().dim.is_vector());
+
+	if (!_compiled)
+		return f.eval_vector(box);
+
+	IntervalVector res(m);
+
+	if (box.is_empty() || !_fwd(runtime.table, &box[0], cst, d))
+		res.set_empty();
+	else
+		for (int i=0; i<m; i++)
+			res[i]=var[out[i]]!=-1? box[var[out[i]]] : d[out[i]];
+
+	return res;
+}
+
+bool JitFunction::backward(const Interval& y, IntervalVector& x) {
+	assert(f.expr().dim.is_scalar());
+
+	if (!_compiled)
+		return f.backward(y,x);
+
+	if (x.is_empty()) return false;
+
+	switch (_bwd(runtime.table, &y, &x[0], cst, d)) {
+	case -1: x.set_empty(); return false;
+	case 1:  return true;
+	default: return false;
+	}
+}
+
+bool JitFunction::backward(const IntervalVector& y, IntervalVector& x) {
+	assert(f.expr().dim.is_vector());
+	assert(y.size()==m);
+
+	if (!_compiled)
+		return f.backward(y,x);
+
+	if (x.is_empty()) return false;
+
+	switch (_bwd(runtime.table, &y[0], &x[0], cst, d)) {
+	case -1: x.set_empty(); return false;
+	case 1:  return true;
+	default: return false;
+	}
+}
+
+void JitFunction::gradient(const IntervalVector& x, IntervalVector& gx) {
+
+	if (!f.expr().dim.is_scalar()) {
+		ibex_error("Cannot called \"gradient\" on a vector-valued function");
+	}
+
+	if (!_compiled) {
+		f.gradient(x,gx);
+		return;
+	}
+
+	if (x.is_empty()) {
+		gx.set_empty();
+		return;
+	}
+
+	for (int i=0; i<nb_nodes; i++)
+		g[i]=Interval::ZERO;
+
+	gx.clear();
+
+	if (var[out[0]]!=-1) gx[var[out[0]]]=Interval::ONE;
+	else g[out[0]]=Interval::ONE;
+
+	if (!_grad(runtime.table, &x[0], cst, d, g, &gx[0]))
+		gx.set_empty();
+}
+
+} // end namespace ibex
@@ -0,0 +1,183 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_JitFunction.h
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_JIT_FUNCTION_H__
+#define __IBEX_JIT_FUNCTION_H__
+
+#include "ibex_Function.h"
+
+#include <string>
+
+namespace ibex {
+
+/**
+ * \ingroup symbolic
+ *
+ * \brief Native code of a function (just-in-time compilation).
+ *
+ * The forward/backward algorithms of #ibex::Function interpret the
+ * compiled expression (see #ibex::CompiledFunction): each node costs a
+ * dispatch on its operation code and accesses to generic domains. For
+ * a function evaluated millions of times (e.g., inside a branch & bound),
+ * this class generates a C++ source file where the operations of the
+ * expression are unrolled into straight-line code, for the evaluation,
+ * the HC4 projection and the gradient. The file is compiled at runtime
+ * by the system compiler into a shared library which is loaded in the
+ * process. The interval operations themselves are still performed by
+ * the interval library (through a table of functions given to the native
+ * code), so that the results are exactly the same as the ones of #eval(),
+ * #backward() and #gradient() in #ibex::Function.
+ *
+ * The libraries are cached, on disk and in memory, with a key
+ * which is the hash of the generated source. The source does not depend
+ * on the values of the constants (they are passed at runtime), so that
+ * two functions with the same structure share the same library.
+ *
+ * The compiler is given by the environment variable IBEX_JIT_CXX ("c++"
+ * by default, possibly followed by options; the command is run without shell)
+ * and the files are created in the directory given by IBEX_JIT_DIR
+ * ($TMPDIR/ibex-jit-<uid> or /tmp/ibex-jit-<uid> by default, created if necessary).
+ * As the libraries are loaded in the process, this directory must be private:
+ * the code is not compiled if the directory does not belong to the user or
+ * can be written by other users, and a library which does not belong to the
+ * user is never loaded.
+ *
+ * Only the functions whose nodes are all scalar (except symbols, whose
+ * components can be indexed, and the root node, which can be a vector of
+ * scalar expressions) are compiled. If the function cannot be compiled
+ * (unsupported expression, no compiler available, etc.), all the methods
+ * resort to the standard algorithms (see #compiled()).
+ *
+ * As any forward algorithm, an object of this class is not thread-safe.
+ */
+class JitFunction {
+public:
+	/**
+	 * \brief Generate, compile and load the native code of f.
+	 *
+	 * The code is only compiled if it is not already in the cache.
+	 */
+	JitFunction(Function& f);
+
+	/**
+	 * \brief Delete this.
+	 *
+	 * The library is kept in the cache.
+	 */
+	~JitFunction();
+
+	/**
+	 * \brief True if the native code is available.
+	 */
+	bool compiled() const;
+
+	/**
+	 * \brief Image of a box by a real-valued function.
+	 */
+	Interval eval(const IntervalVector& box);
+
+	/**
+	 * \brief Image of a box by a vector-valued function.
+	 */
+	IntervalVector eval_vector(const IntervalVector& box);
+
+	/**
+	 * \brief Contract x w.r.t. f(x)=y (real-valued function).
+	 *
+	 * \return true if f(x) is included in y.
+	 * \see #ibex::HC4Revise::proj(const Domain&, IntervalVector&).
+	 */
+	bool backward(const Interval& y, IntervalVector& x);
+
+	/**
+	 * \brief Contract x w.r.t. f(x)=y (vector-valued function).
+	 *
+	 * \return true if f(x) is included in y.
+	 */
+	bool backward(const IntervalVector& y, IntervalVector& x);
+
+	/**
+	 * \brief Gradient of a real-valued function.
+	 */
+	void gradient(const IntervalVector& x, IntervalVector& g);
+
+	/**
+	 * \brief Hash of the generated source code (key in the cache).
+	 *
+	 * Empty string if the function cannot be compiled.
+	 */
+	const std::string& hash() const;
+
+	/**
+	 * \brief The function.
+	 */
+	Function& f;
+
+private:
+	JitFunction(const JitFunction&);            // forbidden
+	JitFunction& operator=(const JitFunction&); // forbidden
+
+	/*
+	 * Generate the source code. Return false if f
+	 * cannot be compiled.
+	 */
+	bool generate(std::string& source);
+
+	/*
+	 * Load the library from the cache or compile it.
+	 * Return false if the code is not available.
+	 */
+	bool load(const std::string& source);
+
+	bool _compiled;
+
+	std::string _hash;
+
+	int nb_nodes;      // number of nodes of the function
+
+	int m;             // number of components of the image
+
+	int* var;          // for each node, the variable (index in the box) if
+	                   // the node is a scalar symbol or a component of a symbol,
+	                   // -1 otherwise
+
+	int* out;          // the nodes of the image components
+
+	Interval* cst;     // values of the constant nodes
+
+	Interval* d;       // domains of the nodes
+
+	Interval* g;       // gradient domains of the nodes
+
+	// entry points of the native code
+	typedef void (*rt_fn)();
+	typedef int (*fwd_code)(const rt_fn*, const Interval* x, const Interval* c, Interval* d);
+	typedef int (*bwd_code)(const rt_fn*, const Interval* y, Interval* x, const Interval* c, Interval* d);
+	typedef int (*grad_code)(const rt_fn*, const Interval* x, const Interval* c, Interval* d, Interval* g, Interval* gx);
+
+	fwd_code  _fwd;
+	bwd_code  _bwd;
+	grad_code _grad;
+
+	friend class JitGenerator;
+};
+
+/*============================================ inline implementation ============================================ */
+
+inline bool JitFunction::compiled() const {
+	return _compiled;
+}
+
+inline const std::string& JitFunction::hash() const {
+	return _hash;
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_JIT_FUNCTION_H__
@@ -14,6 +14,8 @@
 #include <math.h>
 #include <float.h>
 #include <stack>
+#include <set>
+#include <vector>
 
 #define TOO_LARGE 1e30
 #define TOO_SMALL 1e-10
@@ -359,6 +361,127 @@ void gauss_seidel(const IntervalMatrix& A, const IntervalVector& b, IntervalVect
 	} while (red >= ratio);
 }
 
+void precond(SparseIntervalMatrix& A, IntervalVector& b) {
+	int n=(A.nb_rows());
+	assert(n == A.nb_cols()); //throw NotSquareMatrixException();  // not well-constraint problem
+	assert(n == b.size());
+
+	Vector c(n); // inverse of the diagonal of Mid(A)
+
+	for (int i=0; i<n; i++) {
+		int k=A.find(i,i);
+		if (k==-1 || A.val(k).is_unbounded() || A.val(k).mid()==0) throw SingularMatrixException();
+		c[i]=1.0/A.val(k).mid();
+	}
+
+	for (int i=0; i<n; i++) {
+		for (int k=A.row_begin(i); k<A.row_end(i); k++)
+			A.val(k) *= c[i];
+		b[i] *= c[i];
+	}
+}
+
+void gauss_seidel(const SparseIntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double ratio) {
+	int n=(A.nb_rows());
+	assert(n == (A.nb_cols())); // throw NotSquareMatrixException();
+	assert(n == (x.size()) && n == (b.size()));
+
+	if (A.is_empty()) { x.set_empty(); return; }
+
+	int* diag=new int[n]; // position of the diagonal entries (-1 if not in the pattern)
+	for (int i=0; i<n; i++)
+		diag[i]=A.find(i,i);
+
+	double red;
+	Interval old, proj, tmp;
+
+	do {
+		red = 0;
+		for (int i=0; i<n; i++) {
+			old = x[i];
+			proj = b[i];
+
+			for (int k=A.row_begin(i); k<A.row_end(i); k++)
+				if (k!=diag[i]) proj -= A.val(k)*x[A.col(k)];
+			tmp=diag[i]==-1? Interval::ZERO : A.val(diag[i]);
+
+			bwd_mul(proj,tmp,x[i]);
+
+			if (x[i].is_empty()) { x.set_empty(); delete[] diag; return; }
+
+			double gain=old.rel_distance(x[i]);
+			if (gain>red) red=gain;
+		}
+	} while (red >= ratio);
+
+	delete[] diag;
+}
+
+void gauss_elimination(const SparseIntervalMatrix& A, const IntervalVector& b, IntervalVector& x) {
+	int n=(A.nb_rows());
+	assert(n == (A.nb_cols())); // throw NotSquareMatrixException();
+	assert(n == (x.size()) && n == (b.size()));
+
+	if (A.is_empty() || b.is_empty()) { x.set_empty(); return; }
+
+	// Rows of the upper triangular factor U (including the diagonal entry in first position).
+	// The lower factor is not stored: b is eliminated at the same time.
+	vector<vector<int> > ucol(n);
+	vector<vector<Interval> > uval(n);
+	IntervalVector c(b);
+
+	IntervalVector w(n);         // current row (dense)
+	vector<bool> nz(n,false);    // nonzero pattern of w
+	set<int> cols;               // columns of the nonzero entries of w
+
+	for (int i=0; i<n; i++) {
+		for (int k=A.row_begin(i); k<A.row_end(i); k++) {
+			w[A.col(k)]=A.val(k);
+			nz[A.col(k)]=true;
+			cols.insert(A.col(k));
+		}
+
+		// eliminate the entries below the diagonal, in increasing order
+		// (the fill-in of an elimination only appears on the right)
+		for (set<int>::iterator it=cols.begin(); it!=cols.end() && *it<i; ++it) {
+			int j=*it;
+			Interval l=w[j]/uval[j][0];
+			for (unsigned int p=1; p<ucol[j].size(); p++) {
+				int jj=ucol[j][p];
+				if (!nz[jj]) {
+					w[jj]=Interval::ZERO;
+					nz[jj]=true;
+					cols.insert(jj);
+				}
+				w[jj]-=l*uval[j][p];
+			}
+			c[i]-=l*c[j];
+		}
+
+		if (!nz[i] || w[i].contains(0)) throw SingularMatrixException();
+
+		for (set<int>::iterator it=cols.lower_bound(i); it!=cols.end(); ++it) {
+			ucol[i].push_back(*it);
+			uval[i].push_back(w[*it]);
+		}
+
+		for (set<int>::iterator it=cols.begin(); it!=cols.end(); ++it)
+			nz[*it]=false;
+		cols.clear();
+	}
+
+	// back substitution
+	IntervalVector y(n);
+	for (int i=n-1; i>=0; i--) {
+		Interval s=c[i];
+		for (unsigned int p=1; p<ucol[i].size(); p++)
+			s-=uval[i][p]*y[ucol[i][p]];
+		y[i]=s/uval[i][0];
+	}
+
+	x &= y;
+}
+
 bool inflating_gauss_seidel(const IntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double min_dist, double mu_max) {
 	int n=(A.nb_rows());
 	assert(n == (A.nb_cols()));
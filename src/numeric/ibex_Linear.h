@@ -12,6 +12,7 @@
 #define __IBEX_LINEAR_H__
 
 #include "ibex_IntervalMatrix.h"
+#include "ibex_SparseIntervalMatrix.h"
 #include "ibex_LinearException.h"
 
 /** \file */
@@ -188,6 +189,51 @@ void precond(IntervalMatrix& A);
  */
 void gauss_seidel(const IntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double ratio=0.01);
 
+/**
+ * \brief Preconditions a sparse system \f$[A]x=[b]\f$.
+ *
+ * <br> Precondition is made by multiplying [A] and [b] with \f$C^{-1}\f$
+ * where C is the diagonal of \c Mid([A]) (Jacobi preconditioning).
+ * Contrary to #precond(IntervalMatrix&, IntervalVector&), the pattern
+ * of [A] is preserved and the complexity is linear in the number of nonzeros.
+ * This preconditioning is suited to matrices that are close to diagonally
+ * dominant (e.g., Jacobian matrices of discretized PDEs).
+ *
+ * \param A (in/output)- The interval matrix [A] to be replaced by \f$C^{-1}[A]\f$.
+ * \param b (in/output)- The interval vector [b] to be replaced by \f$C^{-1}[b]\f$.
+ *
+ * \throw SingularMatrixException if one diagonal entry of \c Mid([A]) is zero.
+ *                                In this case, A and b are not modified.
+ */
+void precond(SparseIntervalMatrix& A, IntervalVector& b);
+
+/**
+ * \brief Gauss-Seidel algorithm (sparse matrix).
+ *
+ * Same as #gauss_seidel(const IntervalMatrix&, const IntervalVector&, IntervalVector&, double)
+ * except that each sweep is linear in the number of nonzeros of [A].
+ */
+void gauss_seidel(const SparseIntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double ratio=0.01);
+
+/**
+ * \brief Interval Gaussian elimination (sparse matrix).
+ *
+ * Computes an outer approximation of \f$\Sigma([A],[b])\f$ by interval Gaussian
+ * elimination without pivoting and intersects \a x with it. Only the nonzeros of
+ * [A] and the fill-in are processed (for a band matrix, the complexity is linear in n).
+ *
+ * Contrary to Gauss-Seidel, the contraction does not depend on the initial box
+ * which makes it effective on matrices like discretized Laplacians, where Gauss-Seidel
+ * converges very slowly. The approximation is tight when [A] is a thin M-matrix.
+ *
+ * \param A - The interval matrix [A].
+ * \param b - The interval vector [b].
+ * \param x (in/output) - The box to be contracted in return.
+ *
+ * \throw SingularMatrixException if a pivot contains zero. In this case, x is not modified.
+ */
+void gauss_elimination(const SparseIntervalMatrix& A, const IntervalVector& b, IntervalVector& x);
+
 /**
  * \brief Gauss-Seidel algorithm (inflating variant).<br>
  *
@@ -11,6 +11,7 @@
 #include "ibex_Newton.h"
 #include "ibex_Linear.h"
 #include "ibex_LinearException.h"
+#include "ibex_Function.h"
 
 #include <cassert>
 
@@ -21,6 +22,8 @@ namespace ibex {
 double default_newton_prec=1e-07;
 double default_gauss_seidel_ratio=1e-04;
 
+const int SPARSE_NEWTON_MIN_DIM = 100;
+
 
 namespace {
 //
@@ -61,6 +64,10 @@ bool newton(const Fnc& f, const VarSet* vars, IntervalVector& full_box, double p
 	IntervalVector& box = vars ? *new IntervalVector(vars->var_box(full_box)) : full_box;
 	IntervalVector& full_mid = vars ? *new IntervalVector(full_box) : mid;
 
+	// the image of the first midpoint may already be in the cache (e.g., calculated by a bisector
+	// or a predicate on the same box)
+	const Function* fn=dynamic_cast<const Function*>(&f);
+
 	y1 = box.mid();
 
 	do {
@@ -83,7 +90,7 @@ bool newton(const Fnc& f, const VarSet* vars, IntervalVector& full_box, double p
 
 		if (vars) vars->set_var_box(full_mid, mid);
 
-		Fmid = f.eval_vector(full_mid);
+		Fmid = fn ? fn->cached_eval_vector(full_mid) : f.eval_vector(full_mid);
 
 		// Use the jacobian % parameters to calculate
 		// a mean-value form for Fmid
@@ -149,6 +156,75 @@ bool newton(const Fnc& f, const VarSet& vars, IntervalVector& full_box, double p
 	return newton(f,&vars,full_box,prec,ratio_gauss_seidel);
 }
 
+bool sparse_newton(const Function& f, IntervalVector& box, double prec, double ratio_gauss_seidel) {
+	int n=f.nb_var();
+	assert(f.image_dim()==n);
+
+	SparseIntervalMatrix J(n, n, f.jacobian_pattern());
+
+	IntervalVector y(n);
+	IntervalVector y1(n);
+	IntervalVector mid(n);
+	IntervalVector Fmid(n);
+	bool reducted=false;
+	double gain;
+
+	y1 = box.mid();
+
+	do {
+		f.jacobian(box,J);
+
+		if (J.is_empty()) break;
+
+		mid = box.mid();
+
+		Fmid = f.cached_eval_vector(mid);
+
+		if (Fmid.is_empty()) break; // midpoint outside of the definition domain
+
+		y = mid-box;
+		if (y==y1) break;
+		y1=y;
+
+		try {
+			precond(J, Fmid);
+
+			try {
+				gauss_elimination(J, Fmid, y);
+			} catch (SingularMatrixException& ) {
+				// Gauss-Seidel may still contract y
+			}
+
+			if (!y.is_empty())
+				gauss_seidel(J, Fmid, y, ratio_gauss_seidel);
+
+			if (y.is_empty()) {
+				reducted=true;
+				box.set_empty();
+				break;
+			}
+		} catch (LinearException& ) {
+			break;
+		}
+
+		IntervalVector box2=mid-y;
+
+		if ((box2 &= box).is_empty()) {
+			reducted=true;
+			box.set_empty();
+			break;
+		}
+		gain = box.maxdelta(box2);
+
+		if (gain >= prec) reducted = true;
+
+		box=box2;
+	}
+	while (gain >= prec);
+
+	return reducted;
+}
+
 bool inflating_newton(const Fnc& f, const VarSet* vars, const IntervalVector& full_box, IntervalVector& box_existence, IntervalVector& box_unicity, int k_max, double mu_max, double delta, double chi) {
 	int n=vars ? vars->nb_var : f.nb_var();
 	assert(f.image_dim()==n);
@@ -16,6 +16,8 @@
 
 namespace ibex {
 
+class Function;
+
 /**
  * \brief Default Newton precision
  */
@@ -51,6 +53,31 @@ bool newton(const Fnc& f, IntervalVector& box, double prec=default_newton_prec,
  */
 bool newton(const Fnc& f, const VarSet& vars, IntervalVector& full_box, double prec=default_newton_prec, double gauss_seidel_ratio=default_gauss_seidel_ratio);
 
+/**
+ * \brief Minimal number of variables for using the sparse Newton iteration in CtcNewton.
+ */
+extern const int SPARSE_NEWTON_MIN_DIM;
+
+/** \ingroup numeric
+ *
+ * \brief Multivariate Newton operator (contracting) for large sparse systems.
+ *
+ * Same as #ibex::newton(const Fnc&, IntervalVector&, double, double) except that:
+ * - the Jacobian matrix is a #ibex::SparseIntervalMatrix with the pattern
+ *   given by Function::jacobian_pattern() (the Hansen matrix is not used);
+ * - the preconditioning is made with the inverse of the diagonal of the
+ *   midpoint matrix (see #ibex::precond(SparseIntervalMatrix&, IntervalVector&));
+ * - the linear system is first contracted by interval Gaussian elimination
+ *   (see #ibex::gauss_elimination(const SparseIntervalMatrix&, const IntervalVector&, IntervalVector&))
+ *   and then by Gauss-Seidel.
+ *
+ * Each iteration is therefore linear in the number of nonzeros of the Jacobian
+ * (and the fill-in of the elimination) instead of cubic in the number of variables.
+ * This requires the system to be square and the Jacobian to be close to an H-matrix
+ * (e.g., diagonally dominant), which is typically the case for discretized PDEs.
+ */
+bool sparse_newton(const Function& f, IntervalVector& box, double prec=default_newton_prec, double gauss_seidel_ratio=default_gauss_seidel_ratio);
+
 /**
  * \ingroup numeric
  *
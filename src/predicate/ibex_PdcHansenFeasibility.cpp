@@ -28,7 +28,11 @@ BoolInterval PdcHansenFeasibility::test(const IntervalVector& box) {
 	/* Determine the "most influencing" variable thanks to
 	 * the pivoting of Gauss elimination */
 	// ==============================================================
-	Matrix A=f.jacobian(mid).mid();
+	IntervalMatrix J(m,n);
+	const Function* fn=dynamic_cast<const Function*>(&f);
+	if (fn) fn->cached_jacobian(mid,J); // the midpoint may have been differentiated by another operator
+	else f.jacobian(mid,J);
+	Matrix A=J.mid();
 	Matrix LU(m,n);
 	int *pr = new int[m];
 	int *pc = new int[n]; // the interesting output: the variables permutation
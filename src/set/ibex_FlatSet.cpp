@@ -0,0 +1,196 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_FlatSet.cpp
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_FlatSet.h"
+#include "ibex_SetBisect.h"
+
+#include <fstream>
+
+using namespace std;
+
+namespace ibex {
+
+FlatSet::FlatSet(const Set& set) : root(0), Rn(set.Rn) {
+	root = copy(set.root);
+	// release the memory reserved by the vector
+	std::vector<Node>(nodes).swap(nodes);
+}
+
+FlatSet::FlatSet(const char* filename) : root(0), Rn(1) {
+	std::ifstream is;
+	is.open(filename, ios::in | ios::binary);
+
+	int n;
+	is.read((char*) &n, sizeof(int));
+	Rn.resize(n);
+
+	root = load(is);
+	is.close();
+	std::vector<Node>(nodes).swap(nodes);
+}
+
+int FlatSet::copy(const SetNode* node) {
+	if (node->is_leaf())
+		return leaf(((const SetLeaf*) node)->status);
+
+	const SetBisect* b=(const SetBisect*) node;
+
+	int i=nodes.size();
+	Node nd;
+	nd.pt=b->pt;
+	nd.var=b->var;
+	nodes.push_back(nd);
+
+	// warning: the vector may be reallocated
+	int sub=copy(b->left);
+	nodes[i].left=is_leaf(sub) ? 1+status(sub) : 0;
+	sub=copy(b->right);
+	nodes[i].right=sub;
+	return i;
+}
+
+int FlatSet::load(std::istream& is) {
+	int var;
+	is.read((char*) &var, sizeof(int));
+
+	if (var==-1) {
+		BoolInterval status;
+		is.read((char*) &status, sizeof(BoolInterval));
+		return leaf(status);
+	}
+
+	int i=nodes.size();
+	Node nd;
+	nd.var=var;
+	is.read((char*) &nd.pt, sizeof(double));
+	nodes.push_back(nd);
+
+	int sub=load(is);
+	nodes[i].left=is_leaf(sub) ? 1+status(sub) : 0;
+	sub=load(is);
+	nodes[i].right=sub;
+	return i;
+}
+
+void FlatSet::save(const char* filename) const {
+	fstream os;
+	os.open(filename, ios::out | ios::trunc | ios::binary);
+
+	int n=Rn.size();
+	os.write((char*) &n, sizeof(int));
+
+	save(root, os);
+	os.close();
+}
+
+void FlatSet::save(int node, std::ostream& os) const {
+	if (is_leaf(node)) {
+		int no_var=-1; // to store "-1" (means: leaf)
+		BoolInterval s=status(node);
+		os.write((char*) &no_var, sizeof(int));
+		os.write((char*) &s, sizeof(BoolInterval));
+	} else {
+		const Node& nd=nodes[node];
+		int var=nd.var;
+		os.write((char*) &var, sizeof(int));
+		os.write((char*) &nd.pt, sizeof(double));
+		save(left(node), os);
+		save(nd.right, os);
+	}
+}
+
+void FlatSet::visit(SetVisitor& visitor) const {
+	IntervalVector nodebox(Rn);
+	visit(root, nodebox, visitor);
+}
+
+void FlatSet::visit(int node, IntervalVector& nodebox, SetVisitor& visitor) const {
+	if (is_leaf(node)) {
+		visitor.visit_leaf(nodebox, status(node));
+		return;
+	}
+
+	visitor.visit_node(nodebox);
+
+	// the box of the subnodes is obtained by modifying
+	// the node box in-place (and restored afterwards).
+	const Node& nd=nodes[node];
+	Interval x=nodebox[nd.var];
+
+	nodebox[nd.var]=Interval(x.lb(),nd.pt);
+	visit(left(node), nodebox, visitor);
+	nodebox[nd.var]=Interval(nd.pt,x.ub());
+	visit(nd.right, nodebox, visitor);
+	nodebox[nd.var]=x;
+}
+
+BoolInterval FlatSet::is_superset(const IntervalVector& box) const {
+	IntervalVector nodebox(Rn);
+	return is_superset(root, nodebox, box);
+}
+
+BoolInterval FlatSet::is_superset(int node, IntervalVector& nodebox, const IntervalVector& box) const {
+	if (!nodebox.intersects(box)) return YES;
+
+	if (is_leaf(node)) return status(node);
+
+	const Node& nd=nodes[node];
+	Interval x=nodebox[nd.var];
+
+	nodebox[nd.var]=Interval(x.lb(),nd.pt);
+	BoolInterval res=is_superset(left(node), nodebox, box);
+	if (res!=NO) {
+		nodebox[nd.var]=Interval(nd.pt,x.ub());
+		res = res & is_superset(nd.right, nodebox, box);
+	}
+	nodebox[nd.var]=x;
+	return res;
+}
+
+double FlatSet::dist(const Vector& pt, bool inside) const {
+	IntervalVector nodebox(Rn);
+	double lb=POS_INFINITY;
+	dist(root, nodebox, pt, inside? YES : NO, lb);
+	return ::sqrt(lb);
+}
+
+void FlatSet::dist(int node, IntervalVector& nodebox, const Vector& pt, BoolInterval _status, double& lb) const {
+
+	// square of the distance between pt and the node box
+	Interval d=Interval::ZERO;
+	for (int i=0; i<pt.size(); i++) {
+		d += sqr(nodebox[i]-pt[i]);
+	}
+	if (d.lb()>lb) return;
+
+	if (is_leaf(node)) {
+		if (status(node)==_status && d.lb()<lb)
+			lb=d.lb();
+		return;
+	}
+
+	const Node& nd=nodes[node];
+	Interval x=nodebox[nd.var];
+
+	// depth-first search: the closest subnode first
+	if (pt[nd.var]<=nd.pt) {
+		nodebox[nd.var]=Interval(x.lb(),nd.pt);
+		dist(left(node), nodebox, pt, _status, lb);
+		nodebox[nd.var]=Interval(nd.pt,x.ub());
+		dist(nd.right, nodebox, pt, _status, lb);
+	} else {
+		nodebox[nd.var]=Interval(nd.pt,x.ub());
+		dist(nd.right, nodebox, pt, _status, lb);
+		nodebox[nd.var]=Interval(x.lb(),nd.pt);
+		dist(left(node), nodebox, pt, _status, lb);
+	}
+	nodebox[nd.var]=x;
+}
+
+} // namespace ibex
@@ -0,0 +1,188 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_FlatSet.h
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_FLAT_SET_H__
+#define __IBEX_FLAT_SET_H__
+
+#include "ibex_Set.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup iset
+ * \brief Compact (read-only) representation of a set
+ *
+ * In a #ibex::Set, every node of the tree is a separate object
+ * allocated on the heap, with a virtual table, a pointer to its father
+ * and pointers to its subnodes. This class stores the same tree
+ * in a single array of bisection nodes in depth-first order (each
+ * leaf is encoded in its father), which takes about 4 times less
+ * memory and makes traversals much more cache-friendly.
+ *
+ * The set cannot be modified: it is built from a #ibex::Set or loaded
+ * from a file (the file format is the one of #ibex::Set::save()).
+ */
+class FlatSet {
+public:
+
+	/**
+	 * \brief Build a flat copy of a set.
+	 */
+	FlatSet(const Set& set);
+
+	/**
+	 * \brief Load a set from a data file.
+	 *
+	 * \see #ibex::Set::save().
+	 */
+	FlatSet(const char* filename);
+
+	/**
+	 * \brief Serialize the set and save it into a file
+	 *
+	 * The file can be loaded either by a FlatSet or a Set.
+	 */
+	void save(const char* filename) const;
+
+	/**
+	 * \brief Visit the set
+	 *
+	 * Nodes and leaves are visited in the same order as
+	 * #ibex::Set::visit(SetVisitor&) const.
+	 */
+	void visit(SetVisitor& visitor) const;
+
+	/**
+	 * \brief YES only if this set is a superset of the box
+	 *
+	 * \see #ibex::Set::is_superset(const IntervalVector&) const.
+	 */
+	BoolInterval is_superset(const IntervalVector& box) const;
+
+	/**
+	 * \brief Distance of the point "pt" wrt the set (if inside is true)
+	 * of the complementary of the set (if inside is false).
+	 *
+	 * \see #ibex::Set::dist(const Vector&, bool) const.
+	 */
+	double dist(const Vector& pt, bool inside) const;
+
+	/**
+	 * \brief True if this set is empty
+	 */
+	bool is_empty() const;
+
+	/**
+	 * \brief Number of leaves.
+	 */
+	int nb_leaves() const;
+
+	/**
+	 * \brief Memory used by the tree (in bytes).
+	 */
+	size_t memory() const;
+
+	/**
+	 * \brief Dimension of the set.
+	 */
+	int nb_var() const;
+
+protected:
+
+	/*
+	 * A bisection node (16 bytes).
+	 *
+	 * A subnode is either the index of another bisection node (>=0)
+	 * or a leaf encoded by a negative number (see leaf() and status()).
+	 * Since the nodes are stored in depth-first order, the left
+	 * subnode, if not a leaf, is always the next node in the array:
+	 * only its status is stored if it is a leaf.
+	 */
+	struct Node {
+		double pt;             // bisection point
+		unsigned int var : 28; // bisected variable
+		unsigned int left : 4; // 0 if the left subnode is the next node, 1+status if it is a leaf
+		int right;             // right subnode
+	};
+
+	/** Left subnode of the ith node. */
+	int left(int i) const;
+
+	/** Encode a leaf of the given status. */
+	static int leaf(BoolInterval status);
+
+	/** True if the subnode is a leaf. */
+	static bool is_leaf(int node);
+
+	/** Status of a leaf. */
+	static BoolInterval status(int node);
+
+	/** Copy the subtree of a set node (return the encoded node). */
+	int copy(const SetNode* node);
+
+	/** Read a subtree in a file (return the encoded node). */
+	int load(std::istream& is);
+
+	void save(int node, std::ostream& os) const;
+
+	void visit(int node, IntervalVector& nodebox, SetVisitor& visitor) const;
+
+	BoolInterval is_superset(int node, IntervalVector& nodebox, const IntervalVector& box) const;
+
+	void dist(int node, IntervalVector& nodebox, const Vector& pt, BoolInterval status, double& lb) const;
+
+	/** The bisection nodes. */
+	std::vector<Node> nodes;
+
+	/** Root node. */
+	int root;
+
+	/** (-oo,oo)x..x(-oo,oo) */
+	IntervalVector Rn;
+};
+
+/*============================================ inline implementation ============================================ */
+
+inline int FlatSet::leaf(BoolInterval status) {
+	return -1-((int) status);
+}
+
+inline bool FlatSet::is_leaf(int node) {
+	return node<0;
+}
+
+inline BoolInterval FlatSet::status(int node) {
+	return (BoolInterval) (-1-node);
+}
+
+inline int FlatSet::left(int i) const {
+	return nodes[i].left==0 ? i+1 : leaf((BoolInterval) (nodes[i].left-1));
+}
+
+inline bool FlatSet::is_empty() const {
+	return is_leaf(root) && status(root)==NO;
+}
+
+inline int FlatSet::nb_leaves() const {
+	return nodes.size()+1;
+}
+
+inline size_t FlatSet::memory() const {
+	return nodes.capacity()*sizeof(Node);
+}
+
+inline int FlatSet::nb_var() const {
+	return Rn.size();
+}
+
+} // namespace ibex
+
+#endif // __IBEX_FLAT_SET_H__
@@ -90,6 +90,27 @@ Set& Set::operator|=(const Set& set) {
 	return *this;
 }
 
+Set& Set::inter(const Set& set, int nb_threads, double grain) {
+	assert(set.Rn.size()==Rn.size());
+#pragma omp parallel num_threads(nb_threads)
+#pragma omp single
+	root = root->inter(false, Rn, set.root, Rn, grain);
+	return *this;
+}
+
+Set& Set::union_(const Set& set, int nb_threads, double grain) {
+#pragma omp parallel num_threads(nb_threads)
+#pragma omp single
+	root = root->union_(Rn, set.root, Rn, grain);
+	return *this;
+}
+
+void Set::contract(Array<Sep>& sep, double eps, double grain) {
+#pragma omp parallel num_threads(sep.size())
+#pragma omp single
+	root = root->inter(false, Rn, sep, eps, grain);
+}
+
 BoolInterval Set::is_superset(const IntervalVector& box) const {
 	return root->is_superset(Rn,box);
 }
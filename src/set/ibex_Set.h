@@ -88,6 +88,36 @@ public:
 	 */
 	Set& operator|=(const Set& set);
 
+	/**
+	 * \brief Intersection with another set (multi-threaded)
+	 *
+	 * Same as #operator&=(const Set&) except that the work is shared by a
+	 * team of \a nb_threads threads: the two subnodes of a node whose box
+	 * has a diameter greater than \a grain are processed by separate tasks.
+	 *
+	 * \note Threads are only created if Ibex is compiled with OpenMP.
+	 */
+	Set& inter(const Set& set, int nb_threads, double grain);
+
+	/**
+	 * \brief Union with another set (multi-threaded)
+	 *
+	 * Same as #operator|=(const Set&). See #inter(const Set&, int, double).
+	 */
+	Set& union_(const Set& set, int nb_threads, double grain);
+
+	/**
+	 * \brief Contract this set with a separator (multi-threaded)
+	 *
+	 * Same as Sep::contract(Set&, double) except that the separator is applied
+	 * by a team of threads. Separators are not thread-safe so each thread
+	 * uses its own copy: all the separators in \a sep must represent the same
+	 * set and the number of threads is the size of the array.
+	 *
+	 * \see #inter(const Set&, int, double).
+	 */
+	void contract(Array<Sep>& sep, double eps, double grain);
+
 	/**
 	 * \brief True if this set is empty
 	 *
@@ -136,6 +166,7 @@ public:
 
 protected:
 	friend class Sep;
+	friend class FlatSet;
 
 	/**
 	 * \brief Inflate a box by one float.
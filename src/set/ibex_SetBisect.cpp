@@ -104,11 +104,14 @@ SetNode* SetBisect::inter(bool iset, const IntervalVector& nodebox, const Interv
  *   "_no_diff"), except if this node is a leaf and if we are in "irregular" mode.
  * - The approach allows to manage the "regular" mode easily.
  */
-SetNode* SetBisect::inter(bool iset, const IntervalVector& nodebox, Sep& sep, double eps) {
+SetNode* SetBisect::inter(bool iset, const IntervalVector& nodebox, Array<Sep>& _sep, double eps, double grain) {
 
 	IntervalVector box1(nodebox);
 	IntervalVector box2(nodebox);
 
+	// see SetLeaf::inter
+	Sep& sep=thread_sep(_sep);
+
 	sep.separate(box1,box2);
 
 	SetNode* this2=this;
@@ -123,9 +126,17 @@ SetNode* SetBisect::inter(bool iset, const IntervalVector& nodebox, Sep& sep, do
 
 	SetBisect* bis = (SetBisect*) this2;
 
-	bis->left = bis->left->inter(iset, left_box(nodebox), sep, eps);
+	if (nodebox.max_diam()>grain) {
+#pragma omp task default(shared)
+		bis->left = bis->left->inter(iset, left_box(nodebox), _sep, eps, grain);
+#pragma omp task default(shared)
+		bis->right = bis->right->inter(iset,right_box(nodebox), _sep, eps, grain);
+#pragma omp taskwait
+	} else {
+		bis->left = bis->left->inter(iset, left_box(nodebox), _sep, eps, grain);
+		bis->right = bis->right->inter(iset,right_box(nodebox), _sep, eps, grain);
+	}
 	bis->left->father = bis;
-	bis->right = bis->right->inter(iset,right_box(nodebox), sep, eps);
 	bis->right->father = bis;
 
 	// status of children may have changed --> try merge or update status
@@ -209,7 +209,7 @@ bool SetLeaf::is_leaf() const {
 	return true;
 }
 
-SetNode* SetLeaf::inter(bool iset, const IntervalVector& nodebox, Sep& sep, double eps) {
+SetNode* SetLeaf::inter(bool iset, const IntervalVector& nodebox, Array<Sep>& _sep, double eps, double grain) {
 
 	if (status==NO || (iset && status==YES))
 		return this;
@@ -217,6 +217,10 @@ SetNode* SetLeaf::inter(bool iset, const IntervalVector& nodebox, Sep& sep, doub
 	IntervalVector box1(nodebox);
 	IntervalVector box2(nodebox);
 
+	// note: the statuses of the separator are read before any task is created
+	// (another task may then use the separator of this thread).
+	Sep& sep=thread_sep(_sep);
+
 	sep.separate(box1,box2);
 
 	if (nodebox.max_diam()<=eps) {
@@ -262,14 +266,22 @@ SetNode* SetLeaf::inter(bool iset, const IntervalVector& nodebox, Sep& sep, doub
 				SetNode* right = new SetLeaf(status);
 
 				SetBisect* bis = new SetBisect(var, pt);
-				bis->left = left->inter(iset, p.first, sep, eps);
+				if (box.max_diam()>grain) {
+#pragma omp task default(shared)
+					bis->left = left->inter(iset, p.first, _sep, eps, grain);
+#pragma omp task default(shared)
+					bis->right = right->inter(iset, p.second, _sep, eps, grain);
+#pragma omp taskwait
+				} else {
+					bis->left = left->inter(iset, p.first, _sep, eps, grain);
+					bis->right = right->inter(iset, p.second, _sep, eps, grain);
+				}
 				bis->left->father = bis;
-				bis->right = right->inter(iset, p.second, sep, eps);
 				bis->right->father = bis;
 				root4=bis->try_merge();
 			} else {
 				root4=new SetLeaf(status);
-				root4=root4->inter(iset, box, sep, eps);
+				root4=root4->inter(iset, box, _sep, eps, grain);
 			}
 
 			//TODO : we may have two sons with same status!
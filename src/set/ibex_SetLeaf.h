@@ -39,7 +39,7 @@ public:
 	virtual SetNode* inter(bool iset, const IntervalVector& nodebox, const IntervalVector& x, BoolInterval x_status);
 
 	/** \see SetNode */
-	virtual SetNode* inter(bool iset, const IntervalVector& nodebox, Sep& sep, double eps);
+	virtual SetNode* inter(bool iset, const IntervalVector& nodebox, Array<Sep>& sep, double eps, double grain);
 
 	/** \see SetNode */
 	virtual SetNode* union_(const IntervalVector& nodebox, const IntervalVector& x, BoolInterval x_status);
@@ -10,6 +10,8 @@
 #include "ibex_SetNode.h"
 #include "ibex_SetLeaf.h"
 #include "ibex_SetBisect.h"
+#include "ibex_Sep.h"
+#include "ibex_Lock.h"
  #include <unistd.h>
 
 using namespace std;
@@ -24,6 +26,15 @@ SetNode::~SetNode() {
 
 }
 
+Sep& SetNode::thread_sep(Array<Sep>& sep) {
+	return sep.size()==1 ? sep[0] : sep[thread_num()];
+}
+
+SetNode* SetNode::inter(bool iset, const IntervalVector& nodebox, Sep& sep, double eps) {
+	Array<Sep> _sep(sep);
+	return inter(iset, nodebox, _sep, eps, POS_INFINITY);
+}
+
 
 namespace {
 
@@ -61,7 +72,7 @@ pair<bool,int> largest_diameter(const IntervalVector& box1, const IntervalVector
 
 // TODO: merge this code with union_
 
-SetNode* SetNode::inter(bool iset, const IntervalVector& nodebox, const SetNode* other, const IntervalVector& otherbox) {
+SetNode* SetNode::inter(bool iset, const IntervalVector& nodebox, const SetNode* other, const IntervalVector& otherbox, double grain) {
 
 	if (nodebox.is_disjoint(otherbox))
 		return this;
@@ -89,14 +100,30 @@ SetNode* SetNode::inter(bool iset, const IntervalVector& nodebox, const SetNode*
 				bis = new SetBisect(var, pt);
 				bis->left  = new SetLeaf(((SetLeaf *) this)->status);
 				bis->right = new SetLeaf(((SetLeaf *) this)->status);
-				bis->left  = bis->left->inter(iset, p.first, other, otherbox);
-				bis->right = bis->right->inter(iset, p.second, other, otherbox);
+				if (nodebox.max_diam()>grain) {
+#pragma omp task default(shared)
+					bis->left  = bis->left->inter(iset, p.first, other, otherbox, grain);
+#pragma omp task default(shared)
+					bis->right = bis->right->inter(iset, p.second, other, otherbox, grain);
+#pragma omp taskwait
+				} else {
+					bis->left  = bis->left->inter(iset, p.first, other, otherbox, grain);
+					bis->right = bis->right->inter(iset, p.second, other, otherbox, grain);
+				}
 				delete this;
 			}
 			else {
 				bis = (SetBisect*) this;
-				bis->left  = bis->left->inter(iset,bis->left_box(nodebox), other, otherbox);
-				bis->right = bis->right->inter(iset,bis->right_box(nodebox), other, otherbox);
+				if (nodebox.max_diam()>grain) {
+#pragma omp task default(shared)
+					bis->left  = bis->left->inter(iset,bis->left_box(nodebox), other, otherbox, grain);
+#pragma omp task default(shared)
+					bis->right = bis->right->inter(iset,bis->right_box(nodebox), other, otherbox, grain);
+#pragma omp taskwait
+				} else {
+					bis->left  = bis->left->inter(iset,bis->left_box(nodebox), other, otherbox, grain);
+					bis->right = bis->right->inter(iset,bis->right_box(nodebox), other, otherbox, grain);
+				}
 			}
 
 			bis->left->father = bis;
@@ -105,17 +132,17 @@ SetNode* SetNode::inter(bool iset, const IntervalVector& nodebox, const SetNode*
 
 		} else {
 			SetBisect* bisect_node = (SetBisect*) other;
-			SetNode* this2 = inter(iset, nodebox, bisect_node->left, bisect_node->left_box(otherbox));
+			SetNode* this2 = inter(iset, nodebox, bisect_node->left, bisect_node->left_box(otherbox), grain);
 			//cout << "this2: "; this2->print(cout,nodebox,0);
 			// warning: cannot use this anymore (use this2 instead)
-			SetNode* this3 = this2->inter(iset, nodebox, bisect_node->right, bisect_node->right_box(otherbox));
+			SetNode* this3 = this2->inter(iset, nodebox, bisect_node->right, bisect_node->right_box(otherbox), grain);
 			//cout << "this3: "; this3->print(cout,nodebox,0);
 			return this3;
 		}
 	}
 }
 
-SetNode* SetNode::union_(const IntervalVector& nodebox, const SetNode* other, const IntervalVector& otherbox) {
+SetNode* SetNode::union_(const IntervalVector& nodebox, const SetNode* other, const IntervalVector& otherbox, double grain) {
 
 	if (nodebox.is_disjoint(otherbox))
 		return this;
@@ -140,14 +167,30 @@ SetNode* SetNode::union_(const IntervalVector& nodebox, const SetNode* other, co
 				bis = new SetBisect(var, pt);
 				bis->left  = new SetLeaf(((SetLeaf *) this)->status);
 				bis->right = new SetLeaf(((SetLeaf *) this)->status);
-				bis->left  = bis->left->union_(p.first, other, otherbox);
-				bis->right = bis->right->union_(p.second, other, otherbox);
+				if (nodebox.max_diam()>grain) {
+#pragma omp task default(shared)
+					bis->left  = bis->left->union_(p.first, other, otherbox, grain);
+#pragma omp task default(shared)
+					bis->right = bis->right->union_(p.second, other, otherbox, grain);
+#pragma omp taskwait
+				} else {
+					bis->left  = bis->left->union_(p.first, other, otherbox, grain);
+					bis->right = bis->right->union_(p.second, other, otherbox, grain);
+				}
 				delete this;
 			}
 			else {
 				bis = (SetBisect*) this;
-				bis->left  = bis->left->union_(bis->left_box(nodebox), other, otherbox);
-				bis->right = bis->right->union_(bis->right_box(nodebox), other, otherbox);
+				if (nodebox.max_diam()>grain) {
+#pragma omp task default(shared)
+					bis->left  = bis->left->union_(bis->left_box(nodebox), other, otherbox, grain);
+#pragma omp task default(shared)
+					bis->right = bis->right->union_(bis->right_box(nodebox), other, otherbox, grain);
+#pragma omp taskwait
+				} else {
+					bis->left  = bis->left->union_(bis->left_box(nodebox), other, otherbox, grain);
+					bis->right = bis->right->union_(bis->right_box(nodebox), other, otherbox, grain);
+				}
 			}
 
 			bis->left->father = bis;
@@ -156,9 +199,9 @@ SetNode* SetNode::union_(const IntervalVector& nodebox, const SetNode* other, co
 
 		} else {
 			SetBisect* bisect_node = (SetBisect*) other;
-			SetNode* this2 = this->union_(nodebox, bisect_node->left, bisect_node->left_box(otherbox));
+			SetNode* this2 = this->union_(nodebox, bisect_node->left, bisect_node->left_box(otherbox), grain);
 			// warning: cannot use this anymore (use this2 instead)
-			return this2->union_(nodebox, bisect_node->right, bisect_node->right_box(otherbox));
+			return this2->union_(nodebox, bisect_node->right, bisect_node->right_box(otherbox), grain);
 		}
 
 		// *********************************************************************************************
@@ -14,6 +14,7 @@
 #include "ibex_BoolInterval.h"
 #include "ibex_BoolInterval.h"
 #include "ibex_SetVisitor.h"
+#include "ibex_Array.h"
 
 namespace ibex {
 
@@ -51,14 +52,27 @@ public:
 	/**
 	 * \brief Intersection with an (i-)set represented implicitly by a Sep
 	 */
-	virtual SetNode* inter(bool iset, const IntervalVector& nodebox, Sep& sep, double eps)=0;
+	SetNode* inter(bool iset, const IntervalVector& nodebox, Sep& sep, double eps);
+
+	/**
+	 * \brief Intersection with an (i-)set represented implicitly by a Sep (task-parallel version)
+	 *
+	 * \param sep   - one separator per thread (separators are not thread-safe).
+	 *                If the array has only one element, it is used by all the threads.
+	 * \param grain - the two subnodes of a node whose box has a diameter greater
+	 *                than grain are processed by two separate tasks (if the function
+	 *                is called inside an OpenMP parallel region).
+	 */
+	virtual SetNode* inter(bool iset, const IntervalVector& nodebox, Array<Sep>& sep, double eps, double grain)=0;
 
 	/**
 	 * \brief Intersection with an explicit (i-)set "other"
 	 *
 	 * Important: what is outside of "other" is considered to be "IN"
+	 *
+	 * \param grain - see #inter(bool, const IntervalVector&, Array<Sep>&, double, double).
 	 */
-	SetNode* inter(bool iset, const IntervalVector& nodebox, const SetNode* other, const IntervalVector& otherbox);
+	SetNode* inter(bool iset, const IntervalVector& nodebox, const SetNode* other, const IntervalVector& otherbox, double grain=POS_INFINITY);
 
 	/**
 	 * \brief Intersection with an (i-)set reduced to a single box "x" of status "x_status".
@@ -73,8 +87,10 @@ public:
 	 * \brief Union with an explicit set "other"
 	 *
 	 * Important:  what is outside of "other" is considered to be "OUT"
+	 *
+	 * \param grain - see #inter(bool, const IntervalVector&, Array<Sep>&, double, double).
 	 */
-	SetNode* union_(const IntervalVector& nodebox, const SetNode* other, const IntervalVector& otherbox);
+	SetNode* union_(const IntervalVector& nodebox, const SetNode* other, const IntervalVector& otherbox, double grain=POS_INFINITY);
 
 	/**
 	 * \brief Union with an set reduced to a single box "x" of status "x_status".
@@ -111,6 +127,11 @@ public:
 	 */
 	virtual SetNode* contract_no_diff(BoolInterval status, const IntervalVector& nodebox, const IntervalVector& box)=0;
 
+protected:
+	/**
+	 * \brief The separator of the current thread.
+	 */
+	static Sep& thread_sep(Array<Sep>& sep);
 };
 
 } // namespace ibex
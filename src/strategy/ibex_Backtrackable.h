@@ -11,6 +11,8 @@
 #ifndef __IBEX_BACKTRACKABLE_H__
 #define __IBEX_BACKTRACKABLE_H__
 
+#include "ibex_CellArena.h"
+
 #include <utility>
 
 namespace ibex {
@@ -28,6 +30,10 @@ namespace ibex {
  * by aggregating children node structures when backtracking (this might be done in a future release).
  *
  * This class is an interface to be implemented by any operator data class associated to a cell.
+ *
+ * Backtrackable data is created in the current arena of the thread (see #ibex::CellArena::current()),
+ * i.e., in the arena of the cell when it is created via #ibex::Cell::add() or
+ * #ibex::Cell::bisect(). So the same pool of memory is used for a cell and its data.
  */
 class Backtrackable {
 public:
@@ -49,6 +55,16 @@ public:
 	 * \brief Delete *this.
 	 */
 	virtual ~Backtrackable() { }
+
+	/**
+	 * \brief Allocate backtrackable data (in the current arena).
+	 */
+	static void* operator new(size_t size) { return CellArena::new_object(size, CellArena::current()); }
+
+	/**
+	 * \brief Free backtrackable data.
+	 */
+	static void operator delete(void* p) { CellArena::delete_object(p); }
 };
 
 } // end namespace ibex
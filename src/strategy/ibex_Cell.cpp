@@ -10,32 +10,139 @@
 
 #include "ibex_Cell.h"
 #include <limits.h>
+#include <new>
+#include <map>
+#include <string>
 
 namespace ibex {
 
 namespace {
 
 unsigned long id_count=0;
+
+// slot of each class of backtrackable data,
+// indexed by typeid(T).name() (see Cell::get_data)
+std::map<std::string,int>& slots() {
+	static std::map<std::string,int> _slots;
+	return _slots;
+}
+
+}
+
+Cell::Cell(const IntervalVector& box) : box(box), arena(NULL), data(NULL), nb_data(0) {
+	init_id();
 }
 
- Cell::Cell(const IntervalVector& box) : box(box), id(id_count++) {
-	 assert(id_count<ULONG_MAX);
+Cell::Cell(const IntervalVector& box, CellArena& arena) : box(box), arena(&arena), data(NULL), nb_data(0) {
+	init_id();
+}
+
+void Cell::init_id() {
+	// cells may be created concurrently by the parallel strategies
+#pragma omp atomic capture
+	id=id_count++;
+	assert(id<ULONG_MAX);
+}
+
+int Cell::new_slot(const char* classname) {
+	int i;
+	// slots may be assigned concurrently by the parallel strategies
+#pragma omp critical(ibex_cell_slots)
+	{
+		// (the class may already have a slot if slot<T>() is
+		// instantiated in several shared libraries)
+		std::map<std::string,int>::const_iterator it=slots().find(classname);
+		if (it!=slots().end())
+			i=it->second;
+		else {
+			i=slots().size();
+			slots()[classname]=i;
+		}
+	}
+	return i;
+}
+
+int Cell::find_slot(const char* classname) {
+	int i=-1;
+#pragma omp critical(ibex_cell_slots)
+	{
+		std::map<std::string,int>::const_iterator it=slots().find(classname);
+		if (it!=slots().end()) i=it->second;
+	}
+	return i;
+}
+
+Backtrackable* Cell::get_data(const char* classname) const {
+	int i=find_slot(classname);
+	return i>=0 && i<nb_data ? data[i] : NULL;
+}
+
+void Cell::resize_data(int n) {
+	Backtrackable** new_data=arena?
+			(Backtrackable**) arena->alloc(n*sizeof(Backtrackable*)) :
+			new Backtrackable*[n];
+
+	for (int i=0; i<n; i++)
+		new_data[i]= i<nb_data? data[i] : NULL;
+
+	if (data) {
+		if (arena) arena->free(data, nb_data*sizeof(Backtrackable*));
+		else delete[] data;
+	}
+
+	data=new_data;
+	nb_data=n;
 }
 
 std::pair<Cell*,Cell*> Cell::bisect(const IntervalVector& left, const IntervalVector& right) {
-	Cell* cleft = new Cell(left);
-	Cell* cright = new Cell(right);
-	for (IBEXMAP(Backtrackable*)::iterator it=data.begin(); it!=data.end(); it++) {
-		std::pair<Backtrackable*,Backtrackable*> child_data=it->second->down();
-		cleft->data.insert_new(it->first,child_data.first);
-		cright->data.insert_new(it->first,child_data.second);
+	return bisect(left, right, arena);
+}
+
+std::pair<Cell*,Cell*> Cell::bisect(const IntervalVector& left, const IntervalVector& right, CellArena* arena) {
+	Cell* cleft = arena? new (*arena) Cell(left,*arena) : new Cell(left);
+	Cell* cright = arena? new (*arena) Cell(right,*arena) : new Cell(right);
+
+	// backtrackable data of the subcells are created in the arena of the subcells
+	CellArena::Scope scope(arena);
+
+	if (nb_data>0) {
+		cleft->resize_data(nb_data);
+		cright->resize_data(nb_data);
+	}
+
+	for (int i=0; i<nb_data; i++) {
+		if (!data[i]) continue;
+		std::pair<Backtrackable*,Backtrackable*> child_data=data[i]->down();
+		cleft->data[i]=child_data.first;
+		cright->data[i]=child_data.second;
 	}
 	return std::pair<Cell*,Cell*>(cleft,cright);
 }
 
 Cell::~Cell() {
-	for (IBEXMAP(Backtrackable*)::iterator it=data.begin(); it!=data.end(); it++)
-		delete it->second;
+	for (int i=0; i<nb_data; i++)
+		if (data[i]) delete data[i];
+
+	if (data) {
+		if (arena) arena->free(data, nb_data*sizeof(Backtrackable*));
+		else delete[] data;
+	}
+}
+
+void* Cell::operator new(size_t size) {
+	return CellArena::new_object(size, NULL);
+}
+
+void* Cell::operator new(size_t size, CellArena& arena) {
+	return CellArena::new_object(size, &arena);
+}
+
+void Cell::operator delete(void* p) {
+	CellArena::delete_object(p);
+}
+
+void Cell::operator delete(void* p, CellArena&) {
+	CellArena::delete_object(p);
 }
 
 
@@ -13,7 +13,9 @@
 
 #include "ibex_IntervalVector.h"
 #include "ibex_Backtrackable.h"
-#include "ibex_SymbolMap.h"
+#include "ibex_CellArena.h"
+
+#include <cassert>
 #include <typeinfo>
 
 namespace ibex {
@@ -47,6 +49,16 @@ public:
 	 */
 	Cell(const IntervalVector& box);
 
+	/**
+	 * \brief Create the root cell with data stored in an arena.
+	 *
+	 * The backtrackable data and all the descendant cells
+	 * (see #bisect(), unless another arena is given) are allocated in the arena. To allocate the cell
+	 * itself in the arena, use new (arena) Cell(box, arena).
+	 * The box is an ordinary vector (allocated in the heap).
+	 */
+	Cell(const IntervalVector& box, CellArena& arena);
+
 	/**
 	 * \brief Bisect this cell.
 	 *
@@ -61,6 +73,17 @@ public:
 	 */
 	std::pair<Cell*,Cell*> bisect(const IntervalVector& left, const IntervalVector& right);
 
+	/**
+	 * \brief Bisect this cell and create the subcells in \a arena.
+	 *
+	 * Same as #bisect(const IntervalVector&, const IntervalVector&) except that
+	 * the subcells (and their data) are allocated in \a arena instead of the arena
+	 * of this cell (NULL means: in the heap). This allows a thread of a parallel
+	 * strategy to create the cells in its own arena, including when the bisected
+	 * cell has been created by another thread.
+	 */
+	std::pair<Cell*,Cell*> bisect(const IntervalVector& left, const IntervalVector& right, CellArena* arena);
+
 	/**
 	 * \brief Delete *this.
 	 */
@@ -74,52 +97,136 @@ public:
 	/**
 	 * \brief Retrieve backtrackable data from this cell.
 	 *
-	 * The data is identified by its classname.
+	 * The data is identified by its class (see #slot()).
 	 * \pre Class \a T is a subclass of #ibex::Backtrackable.
 	 */
 	template<typename T>
 	T& get() {
-		return (T&) *data[typeid(T).name()];
+		int i=slot<T>();
+		assert(i<nb_data && data[i]);
+		return (T&) *data[i];
 	}
 
 	/**
 	 * \brief Retrieve backtrackable data from this cell.
 	 *
-	 * The data is identified by its classname.
+	 * The data is identified by its class (see #slot()).
 	 * \pre Class \a T is a subclass of #ibex::Backtrackable.
 	 */
 	template<typename T>
 	const T& get() const {
-		return (T&) *data[typeid(T).name()];
+		int i=slot<T>();
+		assert(i<nb_data && data[i]);
+		return (const T&) *data[i];
+	}
+
+	/**
+	 * \brief True if this cell contains backtrackable data of class T.
+	 */
+	template<typename T>
+	bool has() const {
+		int i=slot<T>();
+		return i<nb_data && data[i]!=NULL;
 	}
 
 	/**
 	 * \brief Add backtrackable data into this cell.
 	 *
-	 * The data is identified by its classname.
+	 * The data is identified by its class (see #slot()).
 	 * \pre Class \a T is a subclass of #ibex::Backtrackable.
 	 */
 	template<typename T>
 	void add() {
-		const char* id=typeid(T).name();
-		if (!data.used(id)) data.insert_new(id,new T());
+		int i=slot<T>();
+		if (i>=nb_data) resize_data(i+1);
+		if (!data[i]) {
+			CellArena::Scope scope(arena);
+			data[i]=new T();
+		}
 	}
 
 	/**
-	 * \brief The box
+	 * \brief Retrieve backtrackable data from the name of its class.
+	 *
+	 * Deprecated. Kept for compatibility with the former map of data
+	 * of cells (indexed by typeid(T).name()). Use #get() or #has() instead.
+	 *
+	 * \return NULL if this cell has no data of this class.
 	 */
-	IntervalVector box;
+	Backtrackable* get_data(const char* classname) const;
+
+	/**
+	 * \brief The slot of backtrackable data of class T.
+	 *
+	 * A slot (a small integer) is assigned to each class of backtrackable
+	 * data the first time the data is added/retrieved. The data of a
+	 * cell is then stored in an array indexed by slots, so that retrieving
+	 * data does not require any lookup.
+	 */
+	template<typename T>
+	static int slot() {
+		static const int i=new_slot(typeid(T).name());
+		return i;
+	}
+
 	/**
-	 * \brief Other data.
+	 * \brief Allocate a cell in the heap.
 	 */
-	SymbolMap<Backtrackable*> data;
+	static void* operator new(size_t size);
 
+	/**
+	 * \brief Allocate a cell in an arena.
+	 */
+	static void* operator new(size_t size, CellArena& arena);
+
+	/**
+	 * \brief Free a cell.
+	 */
+	static void operator delete(void* p);
+
+	/**
+	 * \brief Free a cell (if the constructor throws an exception).
+	 */
+	static void operator delete(void* p, CellArena& arena);
+
+	/**
+	 * \brief The box
+	 */
+	IntervalVector box;
 	/**
 	 * Cell unique identifier
 	 */
 	unsigned long id;
 
+	/**
+	 * \brief The arena where the data of the cell are stored.
+	 *
+	 * NULL if the data are stored in the heap.
+	 */
+	CellArena* const arena;
+
 private:
+	Cell(const Cell&); // forbidden
+	Cell& operator=(const Cell&); // forbidden
+
+	/* Set the identifier. */
+	void init_id();
+
+	/* Get a new slot for backtrackable data of a class. */
+	static int new_slot(const char* classname);
+
+	/* Get the slot of a class (-1 if none). */
+	static int find_slot(const char* classname);
+
+	/* Enlarge the array of backtrackable data to n slots. */
+	void resize_data(int n);
+
+	/* Backtrackable data (NULL if not used), indexed by slots. */
+	Backtrackable** data;
+
+	/* Number of slots in the array. */
+	int nb_data;
+
 	/* A constant to be used when no variable has been split yet (root cell). */
 	//static const int ROOT_CELL;
 };
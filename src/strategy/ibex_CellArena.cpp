@@ -0,0 +1,168 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CellArena.cpp
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_CellArena.h"
+
+#include <cassert>
+#include <cstdlib>
+#include <new>
+
+using namespace std;
+
+namespace ibex {
+
+const size_t CellArena::DEFAULT_SLAB_SIZE=1<<16;
+
+namespace {
+
+/*
+ * Header of an object created by new_object(...).
+ * The size is a multiple of 16 bytes so that the object
+ * itself is 16-bytes aligned.
+ */
+union ObjectHeader {
+	struct {
+		CellArena* arena;
+		size_t size;
+	} info;
+	char padding[16];
+};
+
+// the current arena of each thread
+CellArena* current_arena=NULL;
+#pragma omp threadprivate(current_arena)
+
+}
+
+CellArena::CellArena(size_t slab_size) : ptr(NULL), left(0), slab_size(slab_size),
+		_nb_allocs(0), _nb_objects(0), released(false) {
+	assert(slab_size>=MAX_SIZE);
+	for (int i=0; i<NB_CLASSES; i++)
+		free_list[i]=NULL;
+}
+
+CellArena::~CellArena() {
+	for (vector<char*>::iterator it=slabs.begin(); it!=slabs.end(); it++)
+		::free(*it);
+}
+
+void* CellArena::alloc(size_t size) {
+	size_t bytes=((size+GRAIN-1)/GRAIN)*GRAIN;
+
+	if (bytes==0) bytes=GRAIN;
+
+	if (bytes>MAX_SIZE) {
+		void* p=malloc(bytes);
+		if (!p) throw bad_alloc();
+		ScopedLock l(lock);
+		_nb_allocs++;
+		_nb_objects++;
+		return p;
+	}
+
+	int c=bytes/GRAIN-1;
+
+	ScopedLock l(lock);
+
+	_nb_allocs++;
+	_nb_objects++;
+
+	if (free_list[c]) {
+		void* p=free_list[c];
+		free_list[c]=*((void**) p);
+		return p;
+	}
+
+	if (left<bytes) {
+		// note: the end of the current slab is lost
+		// (less than MAX_SIZE bytes)
+		ptr=(char*) malloc(slab_size); // malloc returns 16-bytes aligned blocks
+		if (!ptr) throw bad_alloc();
+		slabs.push_back(ptr);
+		left=slab_size;
+	}
+
+	void* p=ptr;
+	ptr+=bytes;
+	left-=bytes;
+	return p;
+}
+
+void CellArena::free(void* p, size_t size) {
+	size_t bytes=((size+GRAIN-1)/GRAIN)*GRAIN;
+
+	if (bytes==0) bytes=GRAIN;
+
+	bool last;
+
+	if (bytes>MAX_SIZE) {
+		::free(p);
+		ScopedLock l(lock);
+		last = (--_nb_objects==0 && released);
+	} else {
+		int c=bytes/GRAIN-1;
+		ScopedLock l(lock);
+		*((void**) p)=free_list[c];
+		free_list[c]=p;
+		last = (--_nb_objects==0 && released);
+	}
+
+	if (last) delete this;
+}
+
+void CellArena::release() {
+	bool empty;
+	{
+		ScopedLock l(lock);
+		released=true;
+		empty=(_nb_objects==0);
+	}
+	if (empty) delete this;
+}
+
+void* CellArena::new_object(size_t size, CellArena* arena) {
+	size_t bytes=size+sizeof(ObjectHeader);
+	ObjectHeader* h;
+
+	if (arena)
+		h=(ObjectHeader*) arena->alloc(bytes);
+	else {
+		h=(ObjectHeader*) malloc(bytes);
+		if (!h) throw bad_alloc();
+	}
+
+	h->info.arena=arena;
+	h->info.size=bytes;
+	return h+1;
+}
+
+void CellArena::delete_object(void* p) {
+	if (!p) return;
+
+	ObjectHeader* h=((ObjectHeader*) p)-1;
+
+	if (h->info.arena)
+		h->info.arena->free(h,h->info.size);
+	else
+		::free(h);
+}
+
+CellArena* CellArena::current() {
+	return current_arena;
+}
+
+CellArena::Scope::Scope(CellArena* arena) : prev(current_arena) {
+	current_arena=arena;
+}
+
+CellArena::Scope::~Scope() {
+	current_arena=prev;
+}
+
+} // end namespace ibex
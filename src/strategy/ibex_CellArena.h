@@ -0,0 +1,180 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CellArena.h
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_CELL_ARENA_H__
+#define __IBEX_CELL_ARENA_H__
+
+#include "ibex_Lock.h"
+
+#include <vector>
+#include <cstddef>
+
+namespace ibex {
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Memory arena for the cells of a search tree.
+ *
+ * A search creates and deletes a huge number of small objects of the
+ * same sizes: cells and backtrackable data. This arena serves them
+ * from large blocks of memory ("slabs") instead of the heap. Freed memory
+ * is kept in a free list (one per size) and reused by the next
+ * allocations of the same size, so that, once the search tree has reached
+ * its maximal width, no more memory is requested to the system.
+ *
+ * All the slabs are returned to the system at once, when the owner
+ * of the arena has released it (see #release()) and all the objects
+ * have been freed.
+ *
+ * The arena can be shared by several threads (the operations are
+ * protected by a lock if Ibex is compiled with OpenMP). However, the
+ * parallel strategies give an arena to each worker, in which the worker
+ * creates its cells (see #ibex::Cell::bisect(const IntervalVector&, const IntervalVector&, CellArena*)),
+ * so that the lock is only contended when a cell taken from another
+ * worker is freed.
+ *
+ * \see #ibex::Cell(const IntervalVector&, CellArena&).
+ */
+class CellArena {
+public:
+	/**
+	 * \brief Create an empty arena.
+	 *
+	 * \param slab_size - size (in bytes) of the blocks requested to the system.
+	 */
+	CellArena(size_t slab_size=DEFAULT_SLAB_SIZE);
+
+	/**
+	 * \brief Default size of slabs (64KB).
+	 */
+	static const size_t DEFAULT_SLAB_SIZE;
+
+	/**
+	 * \brief Allocate \a size bytes.
+	 *
+	 * The memory is 16-bytes aligned.
+	 */
+	void* alloc(size_t size);
+
+	/**
+	 * \brief Free memory allocated with alloc(size).
+	 */
+	void free(void* p, size_t size);
+
+	/**
+	 * \brief Release the arena.
+	 *
+	 * Must be called by the owner instead of deleting the arena. The
+	 * memory is returned to the system immediately if there is no more
+	 * object in the arena, otherwise when the last object is freed
+	 * (e.g., cells remaining in a buffer).
+	 */
+	void release();
+
+	/**
+	 * \brief Number of allocations so far.
+	 */
+	unsigned long nb_allocs() const;
+
+	/**
+	 * \brief Number of slabs (i.e., memory requests to the system) so far.
+	 */
+	unsigned long nb_slabs() const;
+
+	/**
+	 * \brief Number of objects currently allocated.
+	 */
+	unsigned long nb_objects() const;
+
+	/**
+	 * \brief Create an object in an arena (or in the heap if arena==NULL).
+	 *
+	 * Used by class-specific operator new. The arena (and the size)
+	 * are stored in a header before the object so that the object can
+	 * be deleted without knowing its arena.
+	 */
+	static void* new_object(size_t size, CellArena* arena);
+
+	/**
+	 * \brief Delete an object created by new_object(...).
+	 */
+	static void delete_object(void* p);
+
+	/**
+	 * \brief The current arena of the calling thread.
+	 *
+	 * This is the arena where new backtrackable data
+	 * is created (NULL means: in the heap).
+	 *
+	 * \see #ibex::Backtrackable.
+	 */
+	static CellArena* current();
+
+	/**
+	 * \brief Set the current arena of the calling thread during a scope.
+	 */
+	class Scope {
+	public:
+		/** \brief Set the current arena to \a arena. */
+		Scope(CellArena* arena);
+
+		/** \brief Restore the previous current arena. */
+		~Scope();
+	private:
+		CellArena* prev;
+	};
+
+private:
+	~CellArena(); // see release()
+	CellArena(const CellArena&); // forbidden
+	CellArena& operator=(const CellArena&); // forbidden
+
+	/*
+	 * The memory is allocated by multiples of 16 bytes up to MAX_SIZE.
+	 * Larger blocks are directly allocated in the heap.
+	 */
+	static const size_t GRAIN=16;
+	static const size_t MAX_SIZE=1024;
+	static const int NB_CLASSES=MAX_SIZE/GRAIN;
+
+	/* free lists (one per size class) */
+	void* free_list[NB_CLASSES];
+
+	/* current slab */
+	char* ptr;
+	size_t left;
+
+	const size_t slab_size;
+	std::vector<char*> slabs;
+
+	unsigned long _nb_allocs;
+	unsigned long _nb_objects;
+	bool released;
+
+	Lock lock;
+};
+
+/*============================================ inline implementation ============================================ */
+
+inline unsigned long CellArena::nb_allocs() const {
+	return _nb_allocs;
+}
+
+inline unsigned long CellArena::nb_slabs() const {
+	return slabs.size();
+}
+
+inline unsigned long CellArena::nb_objects() const {
+	return _nb_objects;
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_CELL_ARENA_H__
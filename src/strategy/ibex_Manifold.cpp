@@ -11,6 +11,7 @@
 
 #include <cassert>
 #include <fstream>
+#include <cstdio>
 
 using namespace std;
 
@@ -18,15 +19,39 @@ namespace ibex {
 
 const int Manifold::SIGNATURE_LENGTH = 20;
 const char* Manifold::SIGNATURE = "IBEX MANIFOLD FILE\n";
-const int Manifold::FORMAT_VERSION = 1;
+const int Manifold::FORMAT_VERSION = 2;
 
 Manifold::Manifold(int n, int m, int nb_ineq) : n(n), m(m), nb_ineq(nb_ineq),
-		status(Solver::INFEASIBLE), time(0), nb_cells(0) {
+		status(Solver::INFEASIBLE), time(0), nb_cells(0), _input(NULL) {
 
 }
 
-Manifold::~Manifold() {
+Manifold::Manifold(const Manifold& manif) : n(manif.n), m(manif.m), nb_ineq(manif.nb_ineq),
+		status(manif.status), inner(manif.inner), boundary(manif.boundary), unknown(manif.unknown),
+		pending(manif.pending), time(manif.time), nb_cells(manif.nb_cells),
+		_input(manif._input? new ManifoldFile(manif._input->filename.c_str()) : NULL) {
+
+}
 
+Manifold& Manifold::operator=(const Manifold& manif) {
+	if (this==&manif) return *this;
+	n = manif.n;
+	m = manif.m;
+	nb_ineq = manif.nb_ineq;
+	status = manif.status;
+	inner = manif.inner;
+	boundary = manif.boundary;
+	unknown = manif.unknown;
+	pending = manif.pending;
+	time = manif.time;
+	nb_cells = manif.nb_cells;
+	if (_input) delete _input;
+	_input = manif._input? new ManifoldFile(manif._input->filename.c_str()) : NULL;
+	return *this;
+}
+
+Manifold::~Manifold() {
+	if (_input) delete _input;
 }
 
 void Manifold::clear() {
@@ -37,6 +62,19 @@ void Manifold::clear() {
 	pending.clear();
 	time = 0;
 	nb_cells = 0;
+	if (_input) {
+		delete _input;
+		_input = NULL;
+	}
+}
+
+const vector<SolverOutputBox>& Manifold::boxes(SolverOutputBox::sol_status status) const {
+	switch(status) {
+	case SolverOutputBox::INNER:    return inner;
+	case SolverOutputBox::BOUNDARY: return boundary;
+	case SolverOutputBox::UNKNOWN:  return unknown;
+	default:                        return pending;
+	}
 }
 
 int Manifold::read_int(ifstream& f) {
@@ -118,21 +156,44 @@ void Manifold::write_signature(ofstream& f) const {
 	write_int(f, FORMAT_VERSION);
 }
 
-void Manifold::write_output_box(ofstream& f, const SolverOutputBox& sol) const {
-	const IntervalVector& box=(sol);
-	for (int i=0; i<sol.existence().size(); i++) {
-		write_double(f,box[i].lb());
-		write_double(f,box[i].ub());
-	}
-	write_int(f,sol.status);
-	if (sol.varset!=NULL) {
-		for (int i=0; i<sol.varset->nb_param; i++) {
-			write_int(f,(sol.varset->param(i)) + 1);
+void Manifold::load(const char* filename, bool lazy) {
+
+	clear();
+
+	int version=ManifoldFile::version(filename);
+
+	if (version==-1) ibex_error("[manifold]: not a \"manifold\" file.");
+
+	if (version>=2) {
+		ManifoldFile* file=new ManifoldFile(filename);
+
+		if (file->n!=n || file->m!=m || file->nb_ineq!=nb_ineq) {
+			delete file;
+			ibex_error("[manifold]: bad input file (number of variables/equalities/inequalities does not match).");
 		}
+
+		status = file->status;
+		time = file->time;
+		nb_cells = file->nb_cells;
+
+		if (lazy)
+			_input = file;
+		else {
+			for (int i=0; i<file->size(); i++) {
+				SolverOutputBox sol=file->output_box(i);
+				switch(sol.status) {
+				case 0: inner.push_back(sol); break;
+				case 1: boundary.push_back(sol); break;
+				case 2: unknown.push_back(sol); break;
+				case 3: pending.push_back(sol); break;
+				}
+			}
+			delete file;
+		}
+		return;
 	}
-}
 
-void Manifold::load(const char* filename) {
+	// ======== version 1 (one record per box) =========
 	ifstream f;
 
 	f.open(filename, ios::in | ios::binary);
@@ -147,7 +208,7 @@ void Manifold::load(const char* filename) {
 
 	if (read_int(f)!=nb_ineq) ibex_error("[manifold]: bad input file (number of inequalities does not match).");
 
-	read_int(f); // status
+	status = (Solver::Status) read_int(f);
 
 	int nb_inner = read_int(f);
 	int nb_boundary = read_int(f);
@@ -158,7 +219,6 @@ void Manifold::load(const char* filename) {
 	time = read_double(f);
 	nb_cells = read_int(f);
 
-	IntervalVector box(n);
 	for (int i=0; i<nb_sols; i++) {
 		SolverOutputBox sol = read_output_box(f);
 
@@ -171,39 +231,102 @@ void Manifold::load(const char* filename) {
 	}
 }
 
+void Manifold::write_column(ofstream& f, int column) const {
+
+	vector<double> buf(n); // one row of a bounds column
+
+	for (int s=0; s<4; s++) {
+		SolverOutputBox::sol_status _status=(SolverOutputBox::sol_status) s;
+
+		// boxes of the input file (the column is contiguous)
+		int nb=nb_input(_status);
+		if (nb>0) {
+			int i=_input->first(_status);
+			switch(column) {
+			case 0: f.write((char*) _input->lb(i), ((size_t) nb)*n*sizeof(double)); break;
+			case 1: f.write((char*) _input->ub(i), ((size_t) nb)*n*sizeof(double)); break;
+			case 2: f.write((char*) (_input->_status+i), nb*sizeof(int)); break;
+			default:
+				if (_input->_params)
+					f.write((char*) _input->params(i), ((size_t) nb)*(n-m)*sizeof(int));
+				else
+					for (size_t k=0; k<((size_t) nb)*(n-m); k++) write_int(f,0);
+			}
+		}
+
+		// boxes in memory
+		const vector<SolverOutputBox>& v=boxes(_status);
+		for (vector<SolverOutputBox>::const_iterator it=v.begin(); it!=v.end(); it++) {
+			const IntervalVector& box=*it;
+			switch(column) {
+			case 0:
+				for (unsigned int j=0; j<n; j++) buf[j]=box[j].lb();
+				f.write((char*) &buf[0], n*sizeof(double));
+				break;
+			case 1:
+				for (unsigned int j=0; j<n; j++) buf[j]=box[j].ub();
+				f.write((char*) &buf[0], n*sizeof(double));
+				break;
+			case 2:
+				write_int(f,it->status);
+				break;
+			default:
+				for (unsigned int j=0; j<n-m; j++)
+					write_int(f, it->varset? (it->varset->param(j)) + 1 : 0);
+			}
+		}
+	}
+}
+
 void Manifold::write(const char* filename) const {
 	ofstream f;
 
-	f.open(filename, ios::out | ios::binary);
+	// write in a temporary file first (the input file may be mapped)
+	string tmp=string(filename)+".tmp";
+
+	f.open(tmp.c_str(), ios::out | ios::binary);
 
 	if (f.fail())
 		ibex_error("[manifold]: cannot create output file.\n");
 
 	write_signature(f);
-	write_int(f,n);
-	write_int(f,m);
-	write_int(f,nb_ineq);
-	write_int(f,status);
-	write_int(f,inner.size());
-	write_int(f,boundary.size());
-	write_int(f,unknown.size());
-	write_int(f,pending.size());
-	write_double(f,time);
-	write_int(f,nb_cells);
-
-	for (vector<SolverOutputBox>::const_iterator it=inner.begin(); it!=inner.end(); it++)
-		write_output_box(f,*it);
-
-	for (vector<SolverOutputBox>::const_iterator it=boundary.begin(); it!=boundary.end(); it++)
-		write_output_box(f,*it);
-
-	for (vector<SolverOutputBox>::const_iterator it=unknown.begin(); it!=unknown.end(); it++)
-		write_output_box(f,*it);
 
-	for (vector<SolverOutputBox>::const_iterator it=pending.begin(); it!=pending.end(); it++)
-		write_output_box(f,*it);
+	ManifoldFile::Header h;
+	h.n = n;
+	h.m = m;
+	h.nb_ineq = nb_ineq;
+	h.status = status;
+	h.count[0] = nb_inner();
+	h.count[1] = nb_boundary();
+	h.count[2] = nb_unknown();
+	h.count[3] = nb_pending();
+	h.nb_cells = nb_cells;
+	h.reserved = 0;
+	h.time = time;
+
+	uint64_t N=size();
+	uint64_t status_size=((N*sizeof(int)+7)/8)*8; // aligned on 8 bytes
+
+	h.offset[0] = ManifoldFile::HEADER_POS + sizeof(ManifoldFile::Header);
+	h.offset[1] = h.offset[0] + N*n*sizeof(double);
+	h.offset[2] = h.offset[1] + N*n*sizeof(double);
+	h.offset[3] = m>0 && m<n ? h.offset[2] + status_size : 0;
+
+	// padding after the signature + version
+	for (size_t i=SIGNATURE_LENGTH+sizeof(int); i<ManifoldFile::HEADER_POS; i++) f.put(0);
+
+	f.write((char*) &h, sizeof(h));
+
+	write_column(f,0);
+	write_column(f,1);
+	write_column(f,2);
+	for (uint64_t i=N*sizeof(int); i<status_size; i++) f.put(0);
+	if (h.offset[3]!=0) write_column(f,3);
 
 	f.close();
+
+	if (f.fail() || rename(tmp.c_str(), filename)!=0)
+		ibex_error("[manifold]: cannot write output file.\n");
 }
 
 string Manifold::format() {
@@ -284,28 +407,26 @@ void Manifold::write_txt(const char* filename, bool MMA) const {
 	if (MMA) file << "},"; else file << '\n';
 	file << status;
 	if (MMA) file << ",{"; else file << '\n';
-	file << inner.size() << s << boundary.size() << s << unknown.size() << s << pending.size();
+	file << nb_inner() << s << nb_boundary() << s << nb_unknown() << s << nb_pending();
 	if (MMA) file << "},{"; else file << '\n';
 	file << time << s << nb_cells;
 	if (MMA) file << "}"; else file << '\n';
 
 	if (MMA) file << ",{";
 	bool first_sol=true;
-	for (vector<SolverOutputBox>::const_iterator it=inner.begin(); it!=inner.end(); it++) {
-		if (!first_sol && MMA) file << ','; else first_sol=false;
-		write_txt(file,*it,MMA);
-	}
-	for (vector<SolverOutputBox>::const_iterator it=boundary.begin(); it!=boundary.end(); it++) {
-		if (!first_sol && MMA) file << ','; else first_sol=false;
-		write_txt(file,*it,MMA);
-	}
-	for (vector<SolverOutputBox>::const_iterator it=unknown.begin(); it!=unknown.end(); it++) {
-		if (!first_sol && MMA) file << ','; else first_sol=false;
-		write_txt(file,*it,MMA);
-	}
-	for (vector<SolverOutputBox>::const_iterator it=pending.begin(); it!=pending.end(); it++) {
-		if (!first_sol && MMA) file << ','; else first_sol=false;
-		write_txt(file,*it,MMA);
+	for (int st=0; st<4; st++) {
+		SolverOutputBox::sol_status _status=(SolverOutputBox::sol_status) st;
+		// boxes of the input file first
+		int nb=nb_input(_status);
+		for (int i=0; i<nb; i++) {
+			if (!first_sol && MMA) file << ','; else first_sol=false;
+			write_txt(file,_input->output_box(_input->first(_status)+i),MMA);
+		}
+		const vector<SolverOutputBox>& v=boxes(_status);
+		for (vector<SolverOutputBox>::const_iterator it=v.begin(); it!=v.end(); it++) {
+			if (!first_sol && MMA) file << ','; else first_sol=false;
+			write_txt(file,*it,MMA);
+		}
 	}
 	if (MMA) file << '}';
 
@@ -318,17 +439,16 @@ ostream& operator<<(ostream& os, const Manifold& manif) {
 
 	int i=0;
 
-	for (vector<SolverOutputBox>::const_iterator it=manif.inner.begin(); it!=manif.inner.end(); it++) {
-		cout << " sol n°" << (i++) << " = " << *it << endl;
-	}
-	for (vector<SolverOutputBox>::const_iterator it=manif.boundary.begin(); it!=manif.boundary.end(); it++) {
-		cout << " sol n°" << (i++) << " = " << *it << endl;
-	}
-	for (vector<SolverOutputBox>::const_iterator it=manif.unknown.begin(); it!=manif.unknown.end(); it++) {
-		cout << " sol n°" << (i++) << " = " << *it << endl;
-	}
-	for (vector<SolverOutputBox>::const_iterator it=manif.pending.begin(); it!=manif.pending.end(); it++) {
-		cout << " sol n°" << (i++) << " = " << *it << endl;
+	for (int st=0; st<4; st++) {
+		SolverOutputBox::sol_status _status=(SolverOutputBox::sol_status) st;
+		int nb=manif.nb_input(_status);
+		for (int j=0; j<nb; j++) {
+			cout << " sol n°" << (i++) << " = " << manif._input->output_box(manif._input->first(_status)+j) << endl;
+		}
+		const vector<SolverOutputBox>& v=manif.boxes(_status);
+		for (vector<SolverOutputBox>::const_iterator it=v.begin(); it!=v.end(); it++) {
+			cout << " sol n°" << (i++) << " = " << *it << endl;
+		}
 	}
 	return os;
 }
@@ -12,6 +12,7 @@
 
 #include "ibex_IntervalVector.h"
 #include "ibex_Solver.h"
+#include "ibex_ManifoldFile.h"
 
 #include <fstream>
 #include <vector>
@@ -31,6 +32,16 @@ public:
 
 	Manifold(int n, int m, int nb_ineq);
 
+	/**
+	 * \brief Duplicate a manifold.
+	 */
+	Manifold(const Manifold& manif);
+
+	/**
+	 * \brief Assignment.
+	 */
+	Manifold& operator=(const Manifold& manif);
+
 	/**
 	 * Delete this.
 	 */
@@ -38,11 +49,28 @@ public:
 
 	/**
 	 * \brief Load a manifold from a file.
+	 *
+	 * If lazy is true and the file is in the columnar format (version 2),
+	 * the file is only mapped in memory (see #ibex::ManifoldFile): its inner,
+	 * boundary and pending boxes are part of this manifold but they are not
+	 * stored in the vectors (see #input()). The unknown boxes of the file are
+	 * not part of the manifold: they are meant to be processed again
+	 * (see #ibex::Solver::start(const char*)).
+	 *
+	 * Otherwise, all the boxes are loaded in the vectors.
 	 */
-	void load(const char* filename);
+	void load(const char* filename, bool lazy=false);
 
 	/**
 	 * \brief Write the manifold into a file.
+	 *
+	 * The file is in the columnar format (version 2): a header with
+	 * the position of each column followed by the lower bounds, the
+	 * upper bounds, the status and the parameters of all the boxes.
+	 * See #ibex::ManifoldFile.
+	 *
+	 * The file is first written under a temporary name and then renamed,
+	 * so that it can replace the input file (see #load()).
 	 */
 	void write(const char* filename) const;
 
@@ -65,6 +93,33 @@ public:
 	 */
 	int size() const;
 
+	/**
+	 * \brief Number of inner boxes (including the input file).
+	 */
+	int nb_inner() const;
+
+	/**
+	 * \brief Number of boundary boxes (including the input file).
+	 */
+	int nb_boundary() const;
+
+	/**
+	 * \brief Number of unknown boxes.
+	 */
+	int nb_unknown() const;
+
+	/**
+	 * \brief Number of pending boxes (including the input file).
+	 */
+	int nb_pending() const;
+
+	/**
+	 * \brief The file loaded lazily, if any.
+	 *
+	 * NULL by default. See #load(const char*, bool).
+	 */
+	const ManifoldFile* input() const;
+
 	/**
 	 * \brief Return the format of the report.
 	 */
@@ -94,6 +149,9 @@ public:
 
 	/*
 	 * \brief Inner boxes
+	 *
+	 * Note: if the manifold has been loaded lazily, the
+	 * boxes of the input file are not in this vector.
 	 */
 	std::vector<SolverOutputBox> inner;
 
@@ -128,6 +186,9 @@ public:
 	static const int FORMAT_VERSION;
 
 protected:
+	friend class ManifoldFile;
+	friend class ManifoldStream;
+	friend std::ostream& operator<<(std::ostream& os, const Manifold& manif);
 
 	static const int  SIGNATURE_LENGTH;
 	static const char* SIGNATURE;
@@ -140,8 +201,24 @@ protected:
 	void write_int(std::ofstream& f, int x) const;
 	void write_double(std::ofstream& f, double x) const;
 	void write_signature(std::ofstream& f) const;
-	void write_output_box(std::ofstream& f, const SolverOutputBox& sol) const;
+	void write_column(std::ofstream& f, int column) const;
 	void write_txt(std::ofstream& file, const SolverOutputBox& sol, bool MMA) const;
+
+	/**
+	 * Number of boxes of the input file with a given status
+	 * (unknown boxes excluded).
+	 */
+	int nb_input(SolverOutputBox::sol_status status) const;
+
+	/**
+	 * The boxes of a given status (vector).
+	 */
+	const std::vector<SolverOutputBox>& boxes(SolverOutputBox::sol_status status) const;
+
+	/**
+	 * Input file (loaded lazily).
+	 */
+	ManifoldFile* _input;
 };
 
 std::ostream& operator<<(std::ostream& os, const Manifold& manif);
@@ -155,7 +232,31 @@ inline double Solver::get_time() const { return time; }
 inline double Solver::get_nb_cells() const { return nb_cells; }
 
 inline int Manifold::size() const {
-	return inner.size() + boundary.size() + unknown.size() + pending.size();
+	return nb_inner() + nb_boundary() + nb_unknown() + nb_pending();
+}
+
+inline int Manifold::nb_input(SolverOutputBox::sol_status status) const {
+	return _input && status!=SolverOutputBox::UNKNOWN ? _input->nb(status) : 0;
+}
+
+inline int Manifold::nb_inner() const {
+	return inner.size() + nb_input(SolverOutputBox::INNER);
+}
+
+inline int Manifold::nb_boundary() const {
+	return boundary.size() + nb_input(SolverOutputBox::BOUNDARY);
+}
+
+inline int Manifold::nb_unknown() const {
+	return unknown.size();
+}
+
+inline int Manifold::nb_pending() const {
+	return pending.size() + nb_input(SolverOutputBox::PENDING);
+}
+
+inline const ManifoldFile* Manifold::input() const {
+	return _input;
 }
 
 
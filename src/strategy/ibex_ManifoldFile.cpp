@@ -0,0 +1,132 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ManifoldFile.cpp
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_ManifoldFile.h"
+#include "ibex_Manifold.h"
+
+#include <fstream>
+#include <cstring>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace std;
+
+namespace ibex {
+
+// signature (padded) + version
+const size_t ManifoldFile::HEADER_POS = 24;
+
+int ManifoldFile::version(const char* filename) {
+	ifstream f;
+	f.open(filename, ios::in | ios::binary);
+	if (f.fail()) return -1;
+
+	char sig[Manifold::SIGNATURE_LENGTH];
+	int version;
+	f.read(sig, Manifold::SIGNATURE_LENGTH);
+	f.read((char*) &version, sizeof(int));
+	if (f.fail() || strncmp(sig,Manifold::SIGNATURE,Manifold::SIGNATURE_LENGTH)!=0)
+		return -1;
+	return version;
+}
+
+ManifoldFile::ManifoldFile(const char* filename) : filename(filename), data(NULL), length(0) {
+
+	if (version(filename)!=2)
+		ibex_error("[manifold]: not a \"manifold\" file (version 2).");
+
+	int fd=open(filename, O_RDONLY);
+	if (fd==-1) ibex_error("[manifold]: cannot open input file.\n");
+
+	struct stat st;
+	if (fstat(fd,&st)==-1 || (size_t) st.st_size<HEADER_POS+sizeof(Header)) {
+		close(fd);
+		ibex_error("[manifold]: unexpected end of file.");
+	}
+
+	length=st.st_size;
+	void* addr=mmap(NULL, length, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd); // the mapping remains valid
+
+	if (addr==MAP_FAILED)
+		ibex_error("[manifold]: cannot map input file.\n");
+
+	data=(char*) addr;
+
+	Header h;
+	memcpy(&h, data+HEADER_POS, sizeof(Header));
+
+	n=h.n;
+	m=h.m;
+	nb_ineq=h.nb_ineq;
+	status=(Solver::Status) h.status;
+	time=h.time;
+	nb_cells=h.nb_cells;
+
+	for (int s=0; s<4; s++) count[s]=h.count[s];
+
+	size_t N=size();
+
+	// check that the columns are in the file
+	size_t end[4] = { h.offset[0]+N*n*sizeof(double), h.offset[1]+N*n*sizeof(double),
+			h.offset[2]+N*sizeof(int), h.offset[3]+N*(n-m)*sizeof(int) };
+
+	for (int c=0; c<4; c++) {
+		if (c==3 && h.offset[3]==0) continue;
+		if (end[c]>length || h.offset[c]%8!=0) {
+			munmap(data,length);
+			ibex_error("[manifold]: bad input file (bad column offset).");
+		}
+	}
+
+	_lb = (const double*) (data+h.offset[0]);
+	_ub = (const double*) (data+h.offset[1]);
+	_status = (const int*) (data+h.offset[2]);
+	_params = h.offset[3]==0 ? NULL : (const int*) (data+h.offset[3]);
+}
+
+ManifoldFile::~ManifoldFile() {
+	munmap(data,length);
+}
+
+void ManifoldFile::box(int i, IntervalVector& box) const {
+	const double* l=lb(i);
+	const double* u=ub(i);
+	for (unsigned int j=0; j<n; j++)
+		box[j]=Interval(l[j],u[j]);
+}
+
+SolverOutputBox ManifoldFile::output_box(int i) const {
+	SolverOutputBox sol(n);
+
+	(SolverOutputBox::sol_status&) sol.status = box_status(i);
+
+	box(i,sol._existence);
+
+	const int* p=params(i);
+
+	// parameters are only given for inner/boundary boxes
+	// (zeros otherwise)
+	if (p && p[0]!=0) {
+		BitSet _params(n);
+		for (unsigned int j=0; j<n-m; j++) {
+			if (p[j]<1 || p[j]>(int) n)
+				ibex_error("[manifold]: bad input file (bad parameter index)");
+			_params.add(p[j]-1); // index starting from 1 in the raw format
+		}
+		sol.varset = new VarSet(n,_params,false);
+	}
+
+	return sol;
+}
+
+} /* namespace ibex */
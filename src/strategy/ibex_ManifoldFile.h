@@ -0,0 +1,211 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ManifoldFile.h
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_MANIFOLD_FILE_H__
+#define __IBEX_MANIFOLD_FILE_H__
+
+#include "ibex_Solver.h"
+#include "ibex_SolverOutputBox.h"
+
+#include <string>
+#include <stdint.h>
+
+namespace ibex {
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Read-only access to a manifold file.
+ *
+ * The file is mapped in memory (nothing is read until a box is
+ * accessed), so that the boxes of a very large manifold can be
+ * queried without loading them. Only the columnar format (version 2,
+ * see #ibex::Manifold::write()) is supported.
+ *
+ * The boxes are sorted by status: first the inner boxes, then the
+ * boundary, the unknown and the pending boxes.
+ */
+class ManifoldFile {
+public:
+
+	/**
+	 * \brief Map a manifold file.
+	 */
+	ManifoldFile(const char* filename);
+
+	/**
+	 * \brief Unmap the file.
+	 */
+	~ManifoldFile();
+
+	/**
+	 * \brief Version of the format of a manifold file
+	 *
+	 * Return -1 if it is not a manifold file.
+	 */
+	static int version(const char* filename);
+
+	/**
+	 * \brief Name of the file.
+	 */
+	const std::string filename;
+
+	/**
+	 * \brief Number of variables
+	 */
+	unsigned int n;
+
+	/**
+	 * \brief Number of equalities.
+	 */
+	unsigned int m;
+
+	/**
+	 * \brief Number of inequalities.
+	 */
+	unsigned int nb_ineq;
+
+	/**
+	 * \brief Return status of the search.
+	 */
+	Solver::Status status;
+
+	/**
+	 * \brief CPU running time.
+	 */
+	double time;
+
+	/**
+	 * \brief Number of cells.
+	 */
+	unsigned int nb_cells;
+
+	/**
+	 * \brief Total number of boxes
+	 */
+	int size() const;
+
+	/**
+	 * \brief Number of boxes with a given status.
+	 */
+	int nb(SolverOutputBox::sol_status status) const;
+
+	/**
+	 * \brief Index of the first box with a given status.
+	 */
+	int first(SolverOutputBox::sol_status status) const;
+
+	/**
+	 * \brief Lower bounds of the ith box (n values).
+	 */
+	const double* lb(int i) const;
+
+	/**
+	 * \brief Upper bounds of the ith box (n values).
+	 */
+	const double* ub(int i) const;
+
+	/**
+	 * \brief Read the ith box.
+	 */
+	void box(int i, IntervalVector& box) const;
+
+	/**
+	 * \brief Status of the ith box.
+	 */
+	SolverOutputBox::sol_status box_status(int i) const;
+
+	/**
+	 * \brief Parameters of the ith box (n-m values, indices starting from 1).
+	 *
+	 * NULL if the file has no parameters (m=0 or m=n).
+	 */
+	const int* params(int i) const;
+
+	/**
+	 * \brief Read the ith box as an output box.
+	 */
+	SolverOutputBox output_box(int i) const;
+
+private:
+	friend class Manifold;
+
+	ManifoldFile(const ManifoldFile&);            // forbidden
+	ManifoldFile& operator=(const ManifoldFile&); // forbidden
+
+	/*
+	 * Header of the columnar format, after the signature
+	 * and the version number. The offsets (in bytes, from the
+	 * beginning of the file) give the position of the columns:
+	 * lower bounds, upper bounds, status and parameters (0 if none).
+	 * All the columns are aligned on 8 bytes.
+	 */
+	struct Header {
+		int n, m, nb_ineq, status;
+		int count[4];
+		int nb_cells;
+		int reserved;
+		double time;
+		uint64_t offset[4];
+	};
+
+	/* Position of the header in the file. */
+	static const size_t HEADER_POS;
+
+	/* Number of boxes of each status. */
+	int count[4];
+
+	/* Start of the mapped file. */
+	char* data;
+
+	/* Size of the mapped file. */
+	size_t length;
+
+	/* The columns. */
+	const double* _lb;
+	const double* _ub;
+	const int* _status;
+	const int* _params;
+};
+
+/*============================================ inline implementation ============================================ */
+
+inline int ManifoldFile::size() const {
+	return count[0]+count[1]+count[2]+count[3];
+}
+
+inline int ManifoldFile::nb(SolverOutputBox::sol_status status) const {
+	return count[status];
+}
+
+inline int ManifoldFile::first(SolverOutputBox::sol_status status) const {
+	int i=0;
+	for (int s=0; s<status; s++) i+=count[s];
+	return i;
+}
+
+inline const double* ManifoldFile::lb(int i) const {
+	return _lb+((size_t) i)*n;
+}
+
+inline const double* ManifoldFile::ub(int i) const {
+	return _ub+((size_t) i)*n;
+}
+
+inline SolverOutputBox::sol_status ManifoldFile::box_status(int i) const {
+	return (SolverOutputBox::sol_status) _status[i];
+}
+
+inline const int* ManifoldFile::params(int i) const {
+	return _params? _params+((size_t) i)*(n-m) : NULL;
+}
+
+} /* namespace ibex */
+
+#endif /* __IBEX_MANIFOLD_FILE_H__ */
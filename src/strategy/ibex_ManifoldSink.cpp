@@ -0,0 +1,133 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ManifoldSink.cpp
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_ManifoldSink.h"
+#include "ibex_Manifold.h"
+
+using namespace std;
+
+namespace ibex {
+
+ManifoldSink::ManifoldSink(int flush_period) : flush_period(flush_period), nb_unflushed(0) {
+	for (int s=0; s<4; s++) count[s]=0;
+}
+
+ManifoldSink::~ManifoldSink() {
+
+}
+
+void ManifoldSink::add(const SolverOutputBox& sol) {
+	write(sol);
+	count[sol.status]++;
+	if (flush_period>0 && ++nb_unflushed>=flush_period) {
+		flush();
+		nb_unflushed=0;
+	}
+}
+
+void ManifoldSink::flush() {
+
+}
+
+void ManifoldSink::end(Solver::Status status, double time, unsigned int nb_cells) {
+	flush();
+	nb_unflushed=0;
+}
+
+ManifoldStream::ManifoldStream(const char* filename, int n, int m, int nb_ineq, int flush_period) :
+		ManifoldSink(flush_period), n(n), m(m), nb_ineq(nb_ineq),
+		status(Solver::TIME_OUT), time(0), nb_cells(0) {
+
+	f.open(filename, ios::out | ios::binary);
+
+	if (f.fail())
+		ibex_error("[manifold]: cannot create output file.\n");
+
+	write_header();
+	f.flush();
+}
+
+ManifoldStream::~ManifoldStream() {
+	// no error raised from a destructor
+	if (f.is_open()) {
+		sync();
+		f.close();
+	}
+}
+
+void ManifoldStream::write_header() {
+	f.write(Manifold::SIGNATURE, Manifold::SIGNATURE_LENGTH*sizeof(char));
+	write_int(1); // version (row format)
+	write_int(n);
+	write_int(m);
+	write_int(nb_ineq);
+	write_int(status);
+	for (int s=0; s<4; s++) write_int(count[s]);
+	write_double(time);
+	write_int(nb_cells);
+}
+
+void ManifoldStream::write(const SolverOutputBox& sol) {
+	const IntervalVector& box=sol;
+	for (int i=0; i<n; i++) {
+		write_double(box[i].lb());
+		write_double(box[i].ub());
+	}
+	write_int(sol.status);
+
+	// parameters are expected for inner/boundary boxes if m<n
+	if (m<n && sol.status<=SolverOutputBox::BOUNDARY) {
+		if (sol.varset!=NULL)
+			for (int i=0; i<sol.varset->nb_param; i++)
+				write_int((sol.varset->param(i)) + 1);
+		else // m=0: all the variables are parameters
+			for (int i=0; i<n; i++)
+				write_int(i+1);
+	}
+}
+
+bool ManifoldStream::sync() {
+	// the records are written before the header
+	// so that the file remains valid if interrupted
+	f.flush();
+	streampos end=f.tellp();
+	f.seekp(0);
+	write_header();
+	f.seekp(end);
+	f.flush();
+
+	return !f.fail();
+}
+
+void ManifoldStream::flush() {
+	if (!f.is_open())
+		ibex_error("[manifold]: output file already closed.\n");
+
+	if (!sync())
+		ibex_error("[manifold]: cannot write output file.\n");
+}
+
+void ManifoldStream::close() {
+	if (!f.is_open()) return;
+
+	bool ok=sync();
+	f.close();
+
+	if (!ok || f.fail())
+		ibex_error("[manifold]: cannot write output file.\n");
+}
+
+void ManifoldStream::end(Solver::Status status, double time, unsigned int nb_cells) {
+	this->status = status;
+	this->time = time;
+	this->nb_cells = nb_cells;
+	ManifoldSink::end(status, time, nb_cells);
+}
+
+} /* namespace ibex */
@@ -0,0 +1,215 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ManifoldSink.h
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_MANIFOLD_SINK_H__
+#define __IBEX_MANIFOLD_SINK_H__
+
+#include "ibex_Solver.h"
+#include "ibex_SolverOutputBox.h"
+
+#include <fstream>
+
+namespace ibex {
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Destination of the output boxes of a solver.
+ *
+ * If a sink is given to the solver (see #ibex::Solver::sink), the
+ * output boxes are passed to the sink as soon as they are found instead
+ * of being stored in the manifold, so that the memory used does not
+ * depend on the number of boxes (up to #ibex::Solver::sink_unicity_limit
+ * in the case of well-constrained systems).
+ *
+ * A sink can be used as a callback by overriding #write(const SolverOutputBox&).
+ * See also #ibex::ManifoldStream.
+ */
+class ManifoldSink {
+public:
+
+	/**
+	 * \brief Create a sink.
+	 *
+	 * \param flush_period - see #flush_period.
+	 */
+	ManifoldSink(int flush_period=1000);
+
+	/**
+	 * \brief Delete this.
+	 */
+	virtual ~ManifoldSink();
+
+	/**
+	 * \brief Add an output box.
+	 *
+	 * Calls #write(const SolverOutputBox&) and #flush() every
+	 * #flush_period boxes.
+	 */
+	void add(const SolverOutputBox& sol);
+
+	/**
+	 * \brief Flush the boxes written so far.
+	 *
+	 * Does nothing by default.
+	 */
+	virtual void flush();
+
+	/**
+	 * \brief Called by the solver at the end of the search.
+	 *
+	 * Calls #flush() by default.
+	 *
+	 * \param status   - the status of the search
+	 * \param time     - total CPU time
+	 * \param nb_cells - total number of cells
+	 */
+	virtual void end(Solver::Status status, double time, unsigned int nb_cells);
+
+	/**
+	 * \brief Number of boxes added with a given status.
+	 */
+	int nb(SolverOutputBox::sol_status status) const;
+
+	/**
+	 * \brief Total number of boxes added.
+	 */
+	int size() const;
+
+	/**
+	 * \brief Number of boxes between two flushes.
+	 *
+	 * A value <=0 means no periodic flush.
+	 */
+	int flush_period;
+
+protected:
+
+	/**
+	 * \brief Write an output box.
+	 */
+	virtual void write(const SolverOutputBox& sol)=0;
+
+	/* Number of boxes added for each status. */
+	int count[4];
+
+	/* Number of boxes added since the last flush. */
+	int nb_unflushed;
+};
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Output boxes streamed into a manifold file.
+ *
+ * The boxes are appended to the file in the row format of
+ * the manifold files of version 1 (the header is updated at each flush).
+ * The file is therefore valid after each flush and can be loaded
+ * with #ibex::Manifold::load() or given as input paving to the solver.
+ *
+ * Until the end of the search, the status in the file is TIME_OUT
+ * (interrupted search).
+ */
+class ManifoldStream : public ManifoldSink {
+public:
+
+	/**
+	 * \brief Create a file.
+	 *
+	 * \param filename     - the file
+	 * \param n            - number of variables
+	 * \param m            - number of equalities
+	 * \param nb_ineq      - number of inequalities
+	 * \param flush_period - see #flush_period.
+	 */
+	ManifoldStream(const char* filename, int n, int m, int nb_ineq, int flush_period=1000);
+
+	/**
+	 * \brief Flush and close the file, if not already closed.
+	 *
+	 * Errors are ignored: call #close() to check the file has been
+	 * correctly written.
+	 */
+	~ManifoldStream();
+
+	/**
+	 * \brief Write the buffered boxes and update the header.
+	 */
+	virtual void flush();
+
+	/**
+	 * \brief Flush and close the file.
+	 *
+	 * Raises an error if the file could not be written.
+	 * Does nothing if the file is already closed.
+	 */
+	void close();
+
+	/**
+	 * \brief Set the status, time and number of cells, and flush.
+	 */
+	virtual void end(Solver::Status status, double time, unsigned int nb_cells);
+
+	/**
+	 * \brief Number of variables
+	 */
+	const int n;
+
+	/**
+	 * \brief Number of equalities.
+	 */
+	const int m;
+
+	/**
+	 * \brief Number of inequalities.
+	 */
+	const int nb_ineq;
+
+protected:
+
+	virtual void write(const SolverOutputBox& sol);
+
+	void write_int(int x);
+	void write_double(double x);
+	void write_header();
+
+	/*
+	 * Write the buffered boxes and update the header.
+	 * Return false in case of failure.
+	 */
+	bool sync();
+
+	std::ofstream f;
+
+	Solver::Status status;
+	double time;
+	unsigned int nb_cells;
+};
+
+/*============================================ inline implementation ============================================ */
+
+inline int ManifoldSink::nb(SolverOutputBox::sol_status status) const {
+	return count[status];
+}
+
+inline int ManifoldSink::size() const {
+	return count[0]+count[1]+count[2]+count[3];
+}
+
+inline void ManifoldStream::write_int(int x) {
+	f.write((char*) &x, sizeof(x));
+}
+
+inline void ManifoldStream::write_double(double x) {
+	f.write((char*) &x, sizeof(x));
+}
+
+} /* namespace ibex */
+
+#endif /* __IBEX_MANIFOLD_SINK_H__ */
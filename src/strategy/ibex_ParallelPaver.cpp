@@ -0,0 +1,216 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ParallelPaver.cpp
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_ParallelPaver.h"
+#include "ibex_NoBisectableVariableException.h"
+#include "ibex_Timer.h"
+#include "ibex_Lock.h"
+
+#include <deque>
+#include <cassert>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+enum { NO_INTERRUPT, TIME_OUT, CAPACITY, NO_BISECTABLE, EXCEPTION_RAISED };
+
+void delete_cells(vector<Cell*>& cells) {
+	for (vector<Cell*>::iterator it=cells.begin(); it!=cells.end(); it++)
+		delete *it;
+	cells.clear();
+}
+
+long nb_traces(const SubPaving* paving, int nb_ctc) {
+	long n=0;
+	for (int i=0; i<nb_ctc; i++) n+=paving[i].size();
+	return n;
+}
+
+}
+
+ParallelPaver::ParallelPaver(const Array<Paver>& workers) : workers(workers),
+		capacity(-1), timeout(-1), tasks_per_thread(8), nb_threads(workers.size()),
+		nb_ctc(workers[0].ctc.size()), size(0), start_time(0), interrupt(NO_INTERRUPT) {
+
+	assert(nb_threads>0);
+
+	for (int t=1; t<nb_threads; t++)
+		assert(this->workers[t].ctc.size()==nb_ctc);
+}
+
+void ParallelPaver::check_limits(long new_traces) {
+	long s;
+
+#pragma omp atomic capture
+	s = size += new_traces;
+
+	if (capacity!=-1 && s>capacity) {
+#pragma omp atomic write
+		interrupt = CAPACITY;
+	}
+
+	if (timeout>0 && wall_time()-start_time >= timeout) {
+#pragma omp atomic write
+		interrupt = TIME_OUT;
+	}
+}
+
+void ParallelPaver::check_interrupt() const {
+	switch (interrupt) {
+	case TIME_OUT:      throw TimeOutException();
+	case CAPACITY:      throw CapacityException();
+	case NO_BISECTABLE: throw NoBisectableVariableException();
+	default:            break;
+	}
+}
+
+void ParallelPaver::split(const IntervalVector& init_box, SubPaving* paving, vector<Cell*>& cells) {
+	Paver& w=workers[0];
+
+	// breadth-first search
+	deque<Cell*> queue;
+
+	Cell* root=new Cell(init_box);
+
+	// add data required by the bisector
+	// (all the workers have the same type of bisector)
+	w.bsc.add_backtrackable(*root);
+
+	queue.push_back(root);
+
+	size_t nb_cells=(size_t) nb_threads*tasks_per_thread;
+
+	while (!queue.empty() && queue.size()<nb_cells && interrupt==NO_INTERRUPT) {
+		Cell* c=queue.front();
+		queue.pop_front();
+
+		long before=nb_traces(paving,nb_ctc);
+		w.contract(*c, paving);
+		check_limits(nb_traces(paving,nb_ctc)-before);
+
+		if (c->box.is_empty()) {
+			delete c;
+			continue;
+		}
+
+		try {
+			pair<IntervalVector,IntervalVector> boxes=w.bsc.bisect(*c);
+			pair<Cell*,Cell*> new_cells=c->bisect(boxes.first,boxes.second);
+			queue.push_back(new_cells.first);
+			queue.push_back(new_cells.second);
+		} catch(NoBisectableVariableException&) {
+			interrupt = NO_BISECTABLE;
+		}
+		delete c;
+	}
+
+	cells.assign(queue.begin(), queue.end());
+}
+
+void ParallelPaver::pave(int t, Cell* root, SubPaving* paving) {
+	Paver& w=workers[t];
+
+	w.buffer.flush();
+	w.buffer.push(root);
+
+	int stop=NO_INTERRUPT;
+
+	while (!w.buffer.empty()) {
+
+#pragma omp atomic read
+		stop = interrupt;
+
+		if (stop!=NO_INTERRUPT) {
+			w.buffer.flush(); // deletes the cells
+			return;
+		}
+
+		Cell* c=w.buffer.top();
+
+		if (w.trace) cout << w.buffer << endl;
+
+		try {
+			long before=nb_traces(paving,nb_ctc);
+			w.contract(*c, paving);
+			check_limits(nb_traces(paving,nb_ctc)-before);
+
+			if (c->box.is_empty()) delete w.buffer.pop();
+			else {
+				try {
+					w.bisect(*c);
+				} catch(NoBisectableVariableException&) {
+#pragma omp atomic write
+					interrupt = NO_BISECTABLE;
+				}
+			}
+		} catch(...) {
+			w.buffer.flush(); // deletes the cells
+			throw;
+		}
+	}
+}
+
+SubPaving* ParallelPaver::pave(const IntervalVector& init_box) {
+
+	size=0;
+	interrupt=NO_INTERRUPT;
+
+	start_time=wall_time();
+
+	SubPaving* paving=new SubPaving[nb_ctc];
+
+	vector<Cell*> cells;
+
+	split(init_box, paving, cells);
+
+	int nb_cells=cells.size();
+
+	// one paving per cell, so that the result does
+	// not depend on the scheduling of the threads
+	vector<SubPaving*> sub(nb_cells, (SubPaving*) NULL);
+
+	// an exception must not escape the parallel region
+	ExceptionCapture error;
+
+	if (interrupt==NO_INTERRUPT) {
+#pragma omp parallel for schedule(dynamic,1) num_threads(nb_threads)
+		for (int i=0; i<nb_cells; i++) {
+			sub[i]=new SubPaving[nb_ctc];
+			try {
+				pave(thread_num(), cells[i], sub[i]);
+			} catch(...) {
+				error.capture();
+				// stop the other threads
+#pragma omp atomic write
+				interrupt = EXCEPTION_RAISED;
+			}
+		}
+	} else
+		delete_cells(cells);
+
+	for (int i=0; i<nb_cells; i++) {
+		if (!sub[i]) continue;
+		for (int j=0; j<nb_ctc; j++)
+			paving[j].traces.insert(paving[j].traces.end(), sub[i][j].traces.begin(), sub[i][j].traces.end());
+		delete[] sub[i];
+	}
+
+	if (interrupt!=NO_INTERRUPT) {
+		delete[] paving;
+		error.rethrow();
+		check_interrupt();
+	}
+
+	return paving;
+}
+
+} // end namespace ibex
@@ -0,0 +1,135 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ParallelPaver.h
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_PARALLEL_PAVER_H__
+#define __IBEX_PARALLEL_PAVER_H__
+
+#include "ibex_Paver.h"
+
+#include <vector>
+
+namespace ibex {
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Multi-threaded paver.
+ *
+ * The initial box is first split by the first worker (the paving
+ * algorithm of #ibex::Paver is run in a breadth-first manner until
+ * there are #tasks_per_thread cells per thread). The resulting cells are
+ * then paved independently by a pool of threads. The traces of the
+ * sub-pavings are finally merged, in the order of the cells, so that
+ * the result does not depend on the scheduling of the threads.
+ *
+ * Contractors and bisectors are not thread-safe so each thread relies
+ * on its own paver (a "worker"). All the workers must be built with the
+ * same number of contractors, in the same order.
+ *
+ * \note Threads are only created if Ibex is compiled with OpenMP
+ * (see the --with-openmp option). Otherwise, the first worker does
+ * all the job.
+ */
+class ParallelPaver {
+public:
+	/**
+	 * \brief Build a parallel paver.
+	 *
+	 * \param workers - one paver per thread. The number of threads is the
+	 *                  size of this array. The parameters of the workers
+	 *                  (ctc_loop, trace) are used but their limits
+	 *                  (capacity, timeout) are replaced by the global ones.
+	 */
+	ParallelPaver(const Array<Paver>& workers);
+
+	/**
+	 * \brief Run the paver.
+	 *
+	 * The paving returned is an array (one subpaving per contractor)
+	 * that must be disallocated by the caller.
+	 *
+	 * \throw CapacityException - if the paving exceeds #capacity.
+	 * \throw TimeOutException  - if the time exceeds #timeout.
+	 */
+	SubPaving* pave(const IntervalVector& init_box);
+
+	/**
+	 * \brief The workers.
+	 */
+	Array<Paver> workers;
+
+	/**
+	 * \brief Total number of boxes that can be stored (all threads).
+	 *
+	 * By default, it is -1 (no limit).
+	 */
+	long capacity;
+
+	/**
+	 * \brief Time limit.
+	 *
+	 * Unlike #Paver::timeout, this is a *real* time (the CPU time of
+	 * the process grows with the number of threads).
+	 * By default, it is -1 (no limit).
+	 */
+	double timeout;
+
+	/**
+	 * \brief Number of cells per thread created before the parallel phase.
+	 *
+	 * More cells give a better load balancing (the cells are handed out
+	 * dynamically to the threads). Default value is 8.
+	 */
+	int tasks_per_thread;
+
+protected:
+
+	/**
+	 * \brief Split the initial box into cells (with the first worker).
+	 *
+	 * The traces of the contractions are stored in \a paving.
+	 */
+	void split(const IntervalVector& init_box, SubPaving* paving, std::vector<Cell*>& cells);
+
+	/**
+	 * \brief Pave a cell with the worker of the thread t.
+	 */
+	void pave(int t, Cell* cell, SubPaving* paving);
+
+	/**
+	 * \brief Add the size of the new traces to the global size and check the limits.
+	 *
+	 * Called by all the threads.
+	 */
+	void check_limits(long new_traces);
+
+	/**
+	 * \brief Throw the exception of the interruption, if any.
+	 */
+	void check_interrupt() const;
+
+	/** Number of threads. */
+	const int nb_threads;
+
+	/** Number of contractors. */
+	const int nb_ctc;
+
+	/** Total number of traces. */
+	long size;
+
+	/** Start time of the paving (see #ibex::wall_time()). */
+	double start_time;
+
+	/** Set if the paving has to be stopped. */
+	int interrupt;
+};
+
+} // end namespace ibex
+
+#endif // __IBEX_PARALLEL_PAVER_H__
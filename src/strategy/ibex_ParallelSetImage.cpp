@@ -0,0 +1,126 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ParallelSetImage.cpp
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_ParallelSetImage.h"
+#include "ibex_PdcImageSubset.h"
+#include "ibex_LargestFirst.h"
+#include "ibex_Timer.h"
+#include "ibex_Lock.h"
+
+#include <deque>
+#include <stack>
+
+using namespace std;
+
+namespace ibex {
+
+ParallelSetImage::ParallelSetImage(const Array<SetImage>& workers) : workers(workers),
+		timeout(-1), tasks_per_thread(8), nb_threads(workers.size()), interrupt(0) {
+
+	assert(nb_threads>0);
+}
+
+void ParallelSetImage::pave(const IntervalVector& x, double epsilon) {
+
+	Linside.clear();
+	Lboundary.clear();
+	interrupt=0;
+
+	double start_time=wall_time();
+
+	LargestFirst lf(epsilon);
+
+	// ========= split the domain (breadth-first) =========
+	SetImage& w=workers[0];
+	PdcImageSubset p_fin(w.f,x,w.p_in);
+
+	deque<IntervalVector> queue;
+	queue.push_back(x);
+
+	size_t nb_boxes=(size_t) nb_threads*tasks_per_thread;
+
+	while (!queue.empty() && queue.size()<nb_boxes) {
+		IntervalVector xtilde=queue.front();
+		queue.pop_front();
+		if (w.image(xtilde, p_fin, epsilon, Linside, Lboundary)) {
+			pair<IntervalVector,IntervalVector> boxes=lf.bisect(xtilde);
+			queue.push_back(boxes.first);
+			queue.push_back(boxes.second);
+		}
+	}
+
+	// ========= parallel phase =========
+	int n=queue.size();
+
+	vector<vector<IntervalVector> > inside(n);
+	vector<vector<IntervalVector> > boundary(n);
+
+	// an exception must not escape the parallel region
+	ExceptionCapture error;
+
+#pragma omp parallel num_threads(nb_threads)
+	{
+		int t=thread_num();
+		SetImage& wt=workers[t];
+		PdcImageSubset p_fin_t(wt.f,x,wt.p_in);
+		LargestFirst lf_t(epsilon);
+		int stop=0;
+
+#pragma omp for schedule(dynamic,1)
+		for (int i=0; i<n; i++) {
+			stack<IntervalVector> Ldomain;
+			Ldomain.push(queue[i]);
+
+			while (!Ldomain.empty()) {
+
+				// checked by all the threads (a thread may keep on
+				// paving while the other ones have finished)
+				if (timeout>0 && wall_time()-start_time >= timeout) {
+#pragma omp atomic write
+					interrupt=1;
+				}
+
+#pragma omp atomic read
+				stop=interrupt;
+
+				if (stop) break;
+
+				IntervalVector xtilde=Ldomain.top();
+				Ldomain.pop();
+
+				try {
+					if (wt.image(xtilde, p_fin_t, epsilon, inside[i], boundary[i])) {
+						pair<IntervalVector,IntervalVector> boxes=lf_t.bisect(xtilde);
+						Ldomain.push(boxes.first);
+						Ldomain.push(boxes.second);
+					}
+				} catch(...) {
+					error.capture();
+					// stop the other threads
+#pragma omp atomic write
+					interrupt=2;
+				}
+			}
+		}
+	}
+
+	if (interrupt) {
+		Linside.clear();
+		Lboundary.clear();
+		error.rethrow();
+		throw TimeOutException();
+	}
+
+	for (int i=0; i<n; i++) {
+		Linside.insert(Linside.end(), inside[i].begin(), inside[i].end());
+		Lboundary.insert(Lboundary.end(), boundary[i].begin(), boundary[i].end());
+	}
+}
+
+} // end namespace ibex
@@ -0,0 +1,105 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ParallelSetImage.h
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_PARALLEL_SET_IMAGE_H__
+#define __IBEX_PARALLEL_SET_IMAGE_H__
+
+#include "ibex_SetImage.h"
+#include "ibex_Array.h"
+
+namespace ibex {
+
+/** \ingroup strategy
+ *
+ * \brief Multi-threaded set image.
+ *
+ * The domain is first bisected in a breadth-first manner by the first
+ * worker until there are #tasks_per_thread boxes per thread. These
+ * boxes are then processed independently by a pool of threads and the
+ * resulting subpavings are concatenated in the order of the boxes (the
+ * result does not depend on the scheduling of the threads).
+ *
+ * Each thread relies on its own #ibex::SetImage object (a "worker"),
+ * built with its own function and contractor. All the workers must
+ * represent the same function and domain.
+ *
+ * \note Threads are only created if Ibex is compiled with OpenMP
+ * (see the --with-openmp option).
+ */
+class ParallelSetImage {
+public:
+	/**
+	 * \brief Build a parallel set image algorithm.
+	 *
+	 * \param workers - one set image object per thread. The number of
+	 *                  threads is the size of this array.
+	 */
+	ParallelSetImage(const Array<SetImage>& workers);
+
+	/**
+	 * \brief Run the set image algorithm.
+	 *
+	 * \see #ibex::SetImage::pave(const IntervalVector&, double).
+	 * \throw TimeOutException - if the time exceeds #timeout.
+	 */
+	void pave(const IntervalVector& x, double epsilon);
+
+	/**
+	 * \brief Interior boxes (see #ibex::SetImage::interior()).
+	 */
+	const std::vector<IntervalVector>& interior();
+
+	/**
+	 * \brief Boundary boxes (see #ibex::SetImage::boundary()).
+	 */
+	const std::vector<IntervalVector>& boundary();
+
+	/**
+	 * \brief The workers.
+	 */
+	Array<SetImage> workers;
+
+	/**
+	 * \brief Time limit (real time).
+	 *
+	 * By default, it is -1 (no limit).
+	 */
+	double timeout;
+
+	/**
+	 * \brief Number of boxes per thread created before the parallel phase.
+	 *
+	 * Default value is 8.
+	 */
+	int tasks_per_thread;
+
+protected:
+	/** Number of threads. */
+	const int nb_threads;
+
+	/** Set if the time is out. */
+	int interrupt;
+
+	std::vector<IntervalVector> Linside;
+	std::vector<IntervalVector> Lboundary;
+};
+
+/*============================================ inline implementation ============================================ */
+
+inline const std::vector<IntervalVector>& ParallelSetImage::interior() {
+	return Linside;
+}
+
+inline const std::vector<IntervalVector>& ParallelSetImage::boundary() {
+	return Lboundary;
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_PARALLEL_SET_IMAGE_H__
@@ -0,0 +1,378 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ParallelSolver.cpp
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_ParallelSolver.h"
+#include "ibex_Manifold.h"
+#include "ibex_Lock.h"
+
+#include <deque>
+#include <cassert>
+
+using namespace std;
+
+namespace ibex {
+
+/*
+ * Queue of cells of a thread.
+ *
+ * The owner pushes and pops cells at the back (depth-first search)
+ * while thieves steal cells at the front, where the oldest cells are.
+ */
+class CellDeque {
+public:
+	deque<Cell*> cells;
+	Lock lock;
+};
+
+namespace {
+
+const int NO_INTERRUPT=-1;
+
+// a thread has raised an exception
+const int EXCEPTION_RAISED=-2;
+
+}
+
+ParallelSolver::ParallelSolver(const Array<Solver>& workers) : workers(workers),
+		time_limit(-1), cell_limit(-1), nb_threads(workers.size()),
+		deques(new CellDeque[workers.size()]), nb_pending(0), interrupt(NO_INTERRUPT),
+		manif(NULL), time(0), start_time(0), nb_cells(0), nb_steals(0) {
+
+	assert(nb_threads>0);
+
+	Solver& w=this->workers[0];
+
+	manif = new Manifold(w.n,w.m,w.nb_ineq);
+}
+
+ParallelSolver::~ParallelSolver() {
+	flush(); // in case of an interrupted search
+	delete[] deques;
+	delete manif;
+}
+
+void ParallelSolver::init_workers() {
+	for (int t=0; t<nb_threads; t++) {
+		Solver& w=workers[t];
+		if (w.sink)
+			ibex_error("[ParallelSolver]: the sink of a worker is not supported.");
+		w.buffer.flush();
+		if (w.manif) delete w.manif;
+		w.manif = new Manifold(w.n,w.m,w.nb_ineq);
+		w.nb_cells = 0;
+	}
+}
+
+Cell* ParallelSolver::root_cell(const IntervalVector& box, int t) {
+	CellArena& arena=*workers[t].arena;
+
+	Cell* c=new (arena) Cell(box,arena);
+
+	// add data required by the solver
+	c->add<BisectedVar>();
+
+	// add data required by the bisector
+	// (all the workers have the same type of bisector)
+	workers[0].bsc.add_backtrackable(*c);
+
+	return c;
+}
+
+Solver::Status ParallelSolver::solve(const IntervalVector& init_box) {
+
+	if (manif) delete manif;
+	Solver& w=workers[0];
+	manif = new Manifold(w.n,w.m,w.nb_ineq);
+
+	init_workers();
+
+	deques[0].cells.push_back(root_cell(init_box,0));
+	nb_pending = 1;
+	nb_cells = 1;
+
+	return solve();
+}
+
+Solver::Status ParallelSolver::solve(const char* input_paving) {
+
+	if (manif) delete manif;
+	Solver& w=workers[0];
+	manif = new Manifold(w.n,w.m,w.nb_ineq);
+	// the boxes of a file in the columnar format are not loaded
+	manif->load(input_paving, true);
+
+	init_workers();
+
+	// the boxes of the input paving are dealt out to the threads
+	int t=0;
+	for (vector<SolverOutputBox>::const_iterator it=manif->unknown.begin(); it!=manif->unknown.end(); it++) {
+		deques[t].cells.push_back(root_cell(it->existence(),t));
+		t = (t+1) % nb_threads;
+	}
+
+	nb_pending = manif->unknown.size();
+
+	const ManifoldFile* input=manif->input();
+	if (input) {
+		IntervalVector box(w.n);
+		int first=input->first(SolverOutputBox::UNKNOWN);
+		for (int i=first; i<first+input->nb(SolverOutputBox::UNKNOWN); i++) {
+			input->box(i,box);
+			deques[t].cells.push_back(root_cell(box,t));
+			t = (t+1) % nb_threads;
+		}
+		nb_pending += input->nb(SolverOutputBox::UNKNOWN);
+	}
+	nb_cells = 0; // no new cell created!
+
+	manif->unknown.clear();
+
+	return solve();
+}
+
+Solver::Status ParallelSolver::solve() {
+
+	interrupt = NO_INTERRUPT;
+	nb_steals = 0;
+	time = 0;
+
+	start_time=wall_time();
+
+	// an exception must not escape the parallel region
+	ExceptionCapture error;
+
+#pragma omp parallel num_threads(nb_threads)
+	{
+		try {
+			run(thread_num());
+		} catch(...) {
+			error.capture();
+			// stop the other threads
+#pragma omp atomic write
+			interrupt = EXCEPTION_RAISED;
+		}
+	}
+
+	time += wall_time()-start_time;
+
+	if (error.captured()) {
+		flush();
+		error.rethrow();
+	}
+
+	merge();
+
+	if (interrupt!=NO_INTERRUPT) {
+		flush();
+		manif->status = (Solver::Status) interrupt;
+	}
+	else if (manif->nb_unknown()>0)
+		manif->status = Solver::NOT_ALL_VALIDATED;
+	else if (manif->nb_inner()>0 || manif->nb_boundary()>0)
+		manif->status = Solver::SUCCESS;
+	else
+		manif->status = Solver::INFEASIBLE;
+
+	manif->time += time;
+	manif->nb_cells += nb_cells;
+
+	return manif->status;
+}
+
+Cell* ParallelSolver::get_cell(int t) {
+	Cell* c=NULL;
+
+	deques[t].lock.lock();
+	if (!deques[t].cells.empty()) {
+		c=deques[t].cells.back();
+		deques[t].cells.pop_back();
+	}
+	deques[t].lock.unlock();
+
+	// steal a cell (from the next thread)
+	for (int i=1; c==NULL && i<nb_threads; i++) {
+		CellDeque& victim=deques[(t+i) % nb_threads];
+
+		victim.lock.lock();
+		if (!victim.cells.empty()) {
+			c=victim.cells.front();
+			victim.cells.pop_front();
+		}
+		victim.lock.unlock();
+
+		if (c!=NULL) {
+#pragma omp atomic
+			nb_steals++;
+		}
+	}
+
+	return c;
+}
+
+void ParallelSolver::run(int t) {
+
+	Solver& w=workers[t];
+
+	pair<Cell*,Cell*> new_cells;
+
+	long pending;
+	int stop;
+
+	Backoff backoff;
+
+	while (true) {
+
+#pragma omp atomic read
+		stop = interrupt;
+
+		if (stop!=NO_INTERRUPT) break;
+
+		Cell* c=get_cell(t);
+
+		if (c==NULL) {
+#pragma omp atomic read
+			pending = nb_pending;
+
+			// no cell in the queues and no cell being processed: search is over
+			if (pending==0) break;
+
+			// cells are being processed by other threads: wait for new ones
+			backoff.pause();
+			continue;
+		}
+
+		backoff.reset();
+
+		try {
+			w.handle_cell(*c, new_cells);
+		} catch(...) {
+			delete c;
+			throw;
+		}
+
+		delete c;
+
+		if (new_cells.first) {
+			long cells;
+			// note: must be incremented before the cells are made available
+			// to the other threads
+#pragma omp atomic
+			nb_pending+=2;
+
+#pragma omp atomic capture
+			cells = nb_cells += 2;
+
+			deques[t].lock.lock();
+			deques[t].cells.push_back(new_cells.first);
+			deques[t].cells.push_back(new_cells.second);
+			deques[t].lock.unlock();
+
+			if (cell_limit >=0 && cells>=cell_limit) {
+#pragma omp atomic write
+				interrupt = Solver::CELL_OVERFLOW;
+			}
+		}
+
+#pragma omp atomic
+		nb_pending--;
+
+		if (time_limit>0 && wall_time()-start_time >= time_limit) {
+#pragma omp atomic write
+			interrupt = Solver::TIME_OUT;
+		}
+	}
+}
+
+void ParallelSolver::merge() {
+
+	Solver& w=workers[0];
+
+	// check for duplicates (see Solver::check_sol)
+	bool check_unicity=w.eqs && w.n==w.m;
+
+	for (int t=0; t<nb_threads; t++) {
+		Manifold& m=*workers[t].manif;
+
+		for (vector<SolverOutputBox>::iterator it=m.inner.begin(); it!=m.inner.end(); it++) {
+			bool is_new=true;
+			if (check_unicity) {
+				for (vector<SolverOutputBox>::iterator it2=manif->inner.begin(); is_new && it2!=manif->inner.end(); it2++) {
+					if (it2->unicity().is_superset(it->existence()))
+						is_new=false;
+				}
+				// inner boxes of the input file (the unicity box is not stored)
+				const ManifoldFile* input=manif->input();
+				if (input) {
+					IntervalVector box(w.n);
+					for (int i=0; is_new && i<input->nb(SolverOutputBox::INNER); i++) {
+						input->box(i,box);
+						if (box.is_superset(it->existence()))
+							is_new=false;
+					}
+				}
+			}
+			if (is_new) manif->inner.push_back(*it);
+		}
+
+		manif->boundary.insert(manif->boundary.end(), m.boundary.begin(), m.boundary.end());
+		manif->unknown.insert(manif->unknown.end(), m.unknown.begin(), m.unknown.end());
+
+		m.clear();
+	}
+}
+
+void ParallelSolver::flush() {
+	for (int t=0; t<nb_threads; t++) {
+		deque<Cell*>& cells=deques[t].cells;
+		while (!cells.empty()) {
+			Cell* cell=cells.back();
+			SolverOutputBox sol(manif->n);
+			(SolverOutputBox::sol_status&) sol.status = SolverOutputBox::UNKNOWN;
+			sol._existence=cell->box;
+			sol._unicity=NULL;
+			manif->unknown.push_back(sol);
+			delete cell;
+			cells.pop_back();
+		}
+	}
+	nb_pending = 0;
+}
+
+void ParallelSolver::report() {
+
+	switch(manif->status) {
+	case Solver::SUCCESS: cout << "\033[32m" << " solving successful!" << endl;
+	break;
+	case Solver::INFEASIBLE: cout << "\033[31m" << " infeasible problem" << endl;
+	break;
+	case Solver::NOT_ALL_VALIDATED: cout << "\033[31m" << " done! but some boxes have 'unknown' status." << endl;
+	break;
+	case Solver::TIME_OUT: cout << "\033[31m" << " time limit " << time_limit << "s. reached " << endl;
+	break;
+	case Solver::CELL_OVERFLOW: cout << "\033[31m" << " cell overflow" << endl;
+	}
+
+	cout << "\033[0m" << endl;
+
+	cout << " number of inner boxes:\t\t" << manif->nb_inner() << endl;
+	cout << " number of boundary boxes:\t" << manif->nb_boundary() << endl;
+	cout << " number of unknown boxes:\t" << manif->nb_unknown() << endl;
+	cout << " real time used:\t\t" << time << "s";
+	if (manif->time!=time)
+		cout << " [total=" << manif->time << "]";
+	cout << endl;
+	cout << " number of cells:\t\t" << nb_cells;
+	if (manif->nb_cells!=nb_cells)
+		cout << " [total=" << manif->nb_cells << "]";
+	cout << endl;
+	cout << " number of threads:\t\t" << nb_threads << endl;
+	cout << " number of steals:\t\t" << nb_steals << endl << endl;
+}
+
+} // end namespace ibex
@@ -0,0 +1,208 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ParallelSolver.h
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_PARALLEL_SOLVER_H__
+#define __IBEX_PARALLEL_SOLVER_H__
+
+#include "ibex_Solver.h"
+#include "ibex_Array.h"
+
+namespace ibex {
+
+class CellDeque;
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Multi-threaded solver.
+ *
+ * This class runs the branch and prune algorithm of #ibex::Solver on
+ * several threads. Each thread has its own double-ended queue of cells:
+ * the thread handles its cells in a depth-first manner and, when its
+ * queue is empty, steals the oldest (hence, largest) cell of the
+ * queue of another thread ("work stealing").
+ *
+ * Contractors and bisectors are not thread-safe so each thread
+ * relies on its own solver (a "worker"). All the workers must be built
+ * with the same parameters, on the same system (functions can be evaluated
+ * by several threads at a time, see #ibex::EvalContext) or on copies of
+ * it (see #System::COPY). The "solutions" found by the workers are merged
+ * at the end in a single manifold.
+ *
+ * The output boxes are the same as with a single #ibex::Solver (only
+ * the order of the boxes may differ) except for the time and cell limits,
+ * that are global.
+ *
+ * \note Threads are only created if Ibex is compiled with OpenMP
+ * (see the --with-openmp option). Otherwise, the first worker does
+ * all the job.
+ */
+class ParallelSolver {
+public:
+
+	/**
+	 * \brief Build a parallel solver.
+	 *
+	 * \param workers - one solver per thread. The number of threads is the
+	 *                  size of this array. The cell buffers of the workers
+	 *                  are not used. The workers must not have a sink
+	 *                  (see #Solver::sink): the output boxes are
+	 *                  always merged in the manifold.
+	 */
+	ParallelSolver(const Array<Solver>& workers);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~ParallelSolver();
+
+	/**
+	 * \brief Solve the system.
+	 *
+	 * \param init_box - the initial box (the search space)
+	 *
+	 * \return see #Solver::solve(const IntervalVector&).
+	 */
+	Solver::Status solve(const IntervalVector& init_box);
+
+	/**
+	 * \brief Continue solving of the system.
+	 *
+	 * \param filename - Name of the file containing the input paving.
+	 */
+	Solver::Status solve(const char* filename);
+
+	/**
+	 * \brief Displays on standard output a report of the last call to solve(...).
+	 */
+	void report();
+
+	/**
+	 * \brief Get the "solutions" (output boxes).
+	 */
+	const Manifold& get_manifold() const;
+
+	/**
+	 * \brief Get the (real) time spent.
+	 */
+	double get_time() const;
+
+	/**
+	 * \brief Get the number of cells.
+	 */
+	double get_nb_cells() const;
+
+	/**
+	 * \brief Get the number of cells stolen by the threads.
+	 */
+	unsigned int get_nb_steals() const;
+
+	/**
+	 * \brief The workers.
+	 */
+	Array<Solver> workers;
+
+	/**
+	 * \brief Maximum time used by the solver.
+	 *
+	 * Unlike #Solver::time_limit, this is a *real* time (the CPU time of
+	 * the process grows with the number of threads).
+	 * By default, it is -1 (no limit).
+	 */
+	double time_limit;
+
+	/**
+	 * \brief Maximal number of cells created by all the threads.
+	 *
+	 * By default, it is -1 (no limit).
+	 */
+	long cell_limit;
+
+protected:
+
+	/**
+	 * \brief Run the threads until all the cells in the queues are processed.
+	 */
+	Solver::Status solve();
+
+	/**
+	 * \brief Main loop of a thread.
+	 */
+	void run(int t);
+
+	/**
+	 * \brief Get a cell for the thread t (from its own queue or by stealing).
+	 *
+	 * \return NULL if no cell is available.
+	 */
+	Cell* get_cell(int t);
+
+	/**
+	 * \brief Reset the manifolds of the workers.
+	 */
+	void init_workers();
+
+	/**
+	 * \brief Create the cell of a box, with the data required by the workers.
+	 *
+	 * The cell is created in the arena of the worker of thread t.
+	 */
+	Cell* root_cell(const IntervalVector& box, int t);
+
+	/**
+	 * \brief Merge the manifolds of the workers into the manifold.
+	 */
+	void merge();
+
+	/**
+	 * \brief Put the remaining cells in the manifold as "unknown" boxes.
+	 */
+	void flush();
+
+	/** Number of threads. */
+	const int nb_threads;
+
+	/** One queue per thread. */
+	CellDeque* deques;
+
+	/** Number of cells either in the queues or being processed. */
+	long nb_pending;
+
+	/** Set to TIME_OUT or CELL_OVERFLOW if the search has to be stopped. */
+	int interrupt;
+
+	/** Solutions found in the current search. */
+	Manifold* manif;
+
+	/** Real running time. */
+	double time;
+
+	/** Start time of the current search (see #ibex::wall_time()). */
+	double start_time;
+
+	/** Number of cells created. */
+	long nb_cells;
+
+	/** Number of steals. */
+	unsigned int nb_steals;
+};
+
+/*============================================ inline implementation ============================================ */
+
+inline const Manifold& ParallelSolver::get_manifold() const { return *manif; }
+
+inline double ParallelSolver::get_time() const { return time; }
+
+inline double ParallelSolver::get_nb_cells() const { return nb_cells; }
+
+inline unsigned int ParallelSolver::get_nb_steals() const { return nb_steals; }
+
+} // end namespace ibex
+
+#endif // __IBEX_PARALLEL_SOLVER_H__
@@ -122,6 +122,7 @@ protected:
 	 */
 	void bisect(Cell& c);
 
+	friend class ParallelPaver;
 };
 
 
@@ -53,6 +53,29 @@ SetImage::SetImage(Function& f, Ctc& c_out, Pdc& p_in) : f(f), n(f.nb_var()), c_
 	assert(f.image_dim()==n);
 }
 
+bool SetImage::image(IntervalVector& xtilde, Pdc& p_fin, double epsilon,
+		vector<IntervalVector>& inside, vector<IntervalVector>& boundary) {
+
+	c_out.contract(xtilde);
+
+	if (xtilde.is_empty()) {
+		return false;
+	}
+
+	// use natural extension
+	IntervalVector ytilde=f.eval_vector(xtilde);
+	// improve with centered form
+	ytilde&=f.eval_vector(xtilde.mid())+f.jacobian(xtilde)*(xtilde-xtilde.mid());
+	if (p_in.test(xtilde)==YES && p_fin.test(cart_prod(xtilde,ytilde))==YES)
+		inside.push_back(ytilde);
+	else if (xtilde.max_diam()<=epsilon)
+		boundary.push_back(ytilde);
+	else
+		return true;
+
+	return false;
+}
+
 void SetImage::pave(const IntervalVector& x, double epsilon) {
 
 	Linside.clear();
@@ -64,7 +87,6 @@ void SetImage::pave(const IntervalVector& x, double epsilon) {
 
 	stack<IntervalVector> Ldomain;
 	IntervalVector xtilde(n);
-	IntervalVector ytilde(n);
 	LargestFirst lf(epsilon);
 
 	Ldomain.push(x);
@@ -72,21 +94,7 @@ void SetImage::pave(const IntervalVector& x, double epsilon) {
 		xtilde = Ldomain.top();
 		Ldomain.pop();
 
-		c_out.contract(xtilde);
-
-		if (xtilde.is_empty()) {
-			continue;
-		}
-
-		// use natural extension
-		ytilde=f.eval_vector(xtilde);
-		// improve with centered form
-		ytilde&=f.eval_vector(xtilde.mid())+f.jacobian(xtilde)*(xtilde-xtilde.mid());
-		if (p_in.test(xtilde)==YES && p_fin.test(cart_prod(xtilde,ytilde))==YES)
-			Linside.push_back(ytilde);
-		else if (xtilde.max_diam()<=epsilon)
-			Lboundary.push_back(ytilde);
-		else  {
+		if (image(xtilde, p_fin, epsilon, Linside, Lboundary)) {
 			pair<IntervalVector,IntervalVector> boxes=lf.bisect(xtilde);
 			Ldomain.push(boxes.first);
 			Ldomain.push(boxes.second);
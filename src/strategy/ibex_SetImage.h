@@ -80,6 +80,16 @@ public:
 	const std::vector<IntervalVector>& boundary();
 
 private:
+	friend class ParallelSetImage;
+
+	/*
+	 * Process one box of the domain: contract it and either
+	 * push its image into inside/boundary or return true
+	 * if it has to be bisected.
+	 */
+	bool image(IntervalVector& xtilde, Pdc& p_fin, double epsilon,
+			std::vector<IntervalVector>& inside, std::vector<IntervalVector>& boundary);
+
 	Function &f;
 	int n;
 
@@ -13,6 +13,7 @@
 #include "ibex_NoBisectableVariableException.h"
 #include "ibex_LinearException.h"
 #include "ibex_Manifold.h"
+#include "ibex_ManifoldSink.h"
 
 #include <cassert>
 
@@ -27,8 +28,8 @@ namespace {
 Solver::Solver(const System& sys, Ctc& ctc, Bsc& bsc, CellBuffer& buffer,
 		const Vector& eps_x_min, const Vector& eps_x_max) :
 		  ctc(ctc), bsc(bsc), buffer(buffer), eps_x_min(eps_x_min), eps_x_max(eps_x_max),
-		  boundary_test(ALL_TRUE), time_limit(-1), cell_limit(-1), trace(0), impact(BitSet::all(ctc.nb_var)),
-		  solve_init_box(sys.box), eqs(NULL), ineqs(NULL), params(NULL), manif(NULL) {
+		  boundary_test(ALL_TRUE), time_limit(-1), cell_limit(-1), trace(0), sink(NULL), sink_unicity_limit(100000), impact(BitSet::all(ctc.nb_var)),
+		  solve_init_box(sys.box), eqs(NULL), ineqs(NULL), params(NULL), manif(NULL), arena(new CellArena()) {
 
 	init(sys, NULL);
 
@@ -37,8 +38,8 @@ Solver::Solver(const System& sys, Ctc& ctc, Bsc& bsc, CellBuffer& buffer,
 Solver::Solver(const System& sys, const BitSet& _params, Ctc& ctc, Bsc& bsc, CellBuffer& buffer,
 		const Vector& eps_x_min, const Vector& eps_x_max) :
 		  ctc(ctc), bsc(bsc), buffer(buffer), eps_x_min(eps_x_min), eps_x_max(eps_x_max),
-		  boundary_test(ALL_TRUE), time_limit(-1), cell_limit(-1), trace(0), impact(BitSet::all(ctc.nb_var)),
-		  solve_init_box(sys.box), eqs(NULL), ineqs(NULL), params(NULL), manif(NULL) {
+		  boundary_test(ALL_TRUE), time_limit(-1), cell_limit(-1), trace(0), sink(NULL), sink_unicity_limit(100000), impact(BitSet::all(ctc.nb_var)),
+		  solve_init_box(sys.box), eqs(NULL), ineqs(NULL), params(NULL), manif(NULL), arena(new CellArena()) {
 
 	init(sys,&_params);
 
@@ -81,6 +82,10 @@ void Solver::init(const System& sys, const BitSet* _params) {
 }
 
 Solver::~Solver() {
+	// note: the memory is freed only when the
+	// last cell (possibly in the buffer) is deleted.
+	arena->release();
+
 	if (params)
 		delete params;
 
@@ -99,7 +104,9 @@ void Solver::start(const IntervalVector& init_box) {
 
 	manif = new Manifold(n,m,nb_ineq);
 
-	Cell* root=new Cell(init_box);
+	sink_unicity.clear();
+
+	Cell* root=new (*arena) Cell(init_box,*arena);
 
 	// add data required by this solver
 	root->add<BisectedVar>();
@@ -120,10 +127,11 @@ void Solver::start(const char* input_paving) {
 
 	if (manif) delete manif;
 	manif = new Manifold(n,m,nb_ineq);
-	manif->load(input_paving);
+	// the boxes of a file in the columnar format are not loaded
+	manif->load(input_paving, true);
 
 	for (vector<SolverOutputBox>::const_iterator it=manif->unknown.begin(); it!=manif->unknown.end(); it++) {
-		Cell* cell=new Cell(it->existence());
+		Cell* cell=new (*arena) Cell(it->existence(),*arena);
 
 		// add data required by this solver
 		cell->add<BisectedVar>();
@@ -134,10 +142,52 @@ void Solver::start(const char* input_paving) {
 		buffer.push(cell);
 	}
 
+	const ManifoldFile* input=manif->input();
+	if (input) {
+		IntervalVector box(n);
+		int first=input->first(SolverOutputBox::UNKNOWN);
+		for (int i=first; i<first+input->nb(SolverOutputBox::UNKNOWN); i++) {
+			input->box(i,box);
+			Cell* cell=new (*arena) Cell(box,*arena);
+			cell->add<BisectedVar>();
+			bsc.add_backtrackable(*cell);
+			buffer.push(cell);
+		}
+	}
+
 	nb_cells=0; // no new cell created!
 
 	manif->unknown.clear();
 
+	sink_unicity.clear();
+
+	if (sink) {
+		// the other boxes of the input paving are passed to the sink
+		for (vector<SolverOutputBox>::const_iterator it=manif->inner.begin(); it!=manif->inner.end(); it++) {
+			sink->add(*it);
+			if (eqs && n==m) add_sink_unicity(it->unicity());
+		}
+		for (vector<SolverOutputBox>::const_iterator it=manif->boundary.begin(); it!=manif->boundary.end(); it++)
+			sink->add(*it);
+		for (vector<SolverOutputBox>::const_iterator it=manif->pending.begin(); it!=manif->pending.end(); it++)
+			sink->add(*it);
+
+		if (input) {
+			for (int i=0; i<input->size(); i++) {
+				if (input->box_status(i)==SolverOutputBox::UNKNOWN) continue;
+				SolverOutputBox sol=input->output_box(i);
+				sink->add(sol);
+				if (eqs && n==m && sol.status==SolverOutputBox::INNER) add_sink_unicity(sol.existence());
+			}
+		}
+
+		double _time=manif->time;
+		unsigned int _nb_cells=manif->nb_cells;
+		manif->clear();
+		manif->time=_time;
+		manif->nb_cells=_nb_cells;
+	}
+
 	Timer::start();
 }
 
@@ -150,72 +200,86 @@ bool Solver::next() {
 
 		Cell* c=buffer.top();
 
-		int v=c->get<BisectedVar>().var;      // last bisected var.
+		pair<Cell*,Cell*> new_cells;
 
-		if (v!=-1)                          // no root node :  impact set to 1 for last bisected var only
-			impact.add(v);
-		else                                // root node : impact set to 1 for all variables
-			impact.fill(0,ctc.nb_var-1);
+		bool sol_found=handle_cell(*c, new_cells);
 
-		try {
-			ctc.contract(c->box,impact);
-
-			if (c->box.is_empty()) throw EmptyBoxException();
-
-			if (v!=-1)
-				impact.remove(v);
-			else                              // root node : impact set to 0 for all variables after contraction
-				impact.clear();
-
-			// certification is performed at each intermediate step
-			// if the system is under constrained
-			if (!c->box.is_empty() && m<n) {
-				SolverOutputBox new_sol=check_sol(c->box);
-				if (new_sol.status!=SolverOutputBox::UNKNOWN) {
-					if ((m==0 && new_sol.status==SolverOutputBox::INNER) ||
-							!is_too_large(new_sol.existence())) {
-						delete buffer.pop();
-						store_sol(new_sol);
-						return true;
-					} else {
-						// otherwise: continue search...
-					}
-				}
-				else {
-					// otherwise: continue search...
-				}
-			}
+		delete buffer.pop();
 
-			try {
-				if (is_too_small(c->box))
-					throw NoBisectableVariableException();
+		if (sol_found) return true;
+
+		if (new_cells.first) {
+			buffer.push(new_cells.first);
+			buffer.push(new_cells.second);
+			nb_cells+=2;
+			if (cell_limit >=0 && nb_cells>=cell_limit) throw CellLimitException();
+		}
+	}
 
-				// next line may also throw NoBisectableVariableException
-				pair<IntervalVector,IntervalVector> boxes=bsc.bisect(*c);
+	return false;
+}
 
-				pair<Cell*,Cell*> new_cells=c->bisect(boxes.first,boxes.second);
+bool Solver::handle_cell(Cell& cell, pair<Cell*,Cell*>& new_cells) {
 
-				delete buffer.pop();
-				buffer.push(new_cells.first);
-				buffer.push(new_cells.second);
-				nb_cells+=2;
-				if (cell_limit >=0 && nb_cells>=cell_limit) throw CellLimitException();
-			}
+	Cell* c=&cell;
+
+	new_cells.first = new_cells.second = NULL;
+
+	int v=c->get<BisectedVar>().var;      // last bisected var.
+
+	if (v!=-1)                          // no root node :  impact set to 1 for last bisected var only
+		impact.add(v);
+	else                                // root node : impact set to 1 for all variables
+		impact.fill(0,ctc.nb_var-1);
 
-			catch (NoBisectableVariableException&) {
-				SolverOutputBox new_sol=check_sol(c->box);
-				delete buffer.pop();
-				store_sol(new_sol);
-				return true;
+	try {
+		ctc.contract(c->box,impact);
+
+		if (c->box.is_empty()) throw EmptyBoxException();
+
+		if (v!=-1)
+			impact.remove(v);
+		else                              // root node : impact set to 0 for all variables after contraction
+			impact.clear();
+
+		// certification is performed at each intermediate step
+		// if the system is under constrained
+		if (!c->box.is_empty() && m<n) {
+			SolverOutputBox new_sol=check_sol(c->box);
+			if (new_sol.status!=SolverOutputBox::UNKNOWN) {
+				if ((m==0 && new_sol.status==SolverOutputBox::INNER) ||
+						!is_too_large(new_sol.existence())) {
+					store_sol(new_sol);
+					return true;
+				} else {
+					// otherwise: continue search...
+				}
+			}
+			else {
+				// otherwise: continue search...
 			}
 		}
-		catch (EmptyBoxException&) {
-			delete buffer.pop();
-			impact.remove(v); // note: in case of the root node, we should clear the bitset
-			// instead but since the search is over, the impact is not used anymore.
-			continue;
+
+		try {
+			if (is_too_small(c->box))
+				throw NoBisectableVariableException();
+
+			// next line may also throw NoBisectableVariableException
+			pair<IntervalVector,IntervalVector> boxes=bsc.bisect(*c);
+
+			new_cells=c->bisect(boxes.first,boxes.second,arena);
+		}
+
+		catch (NoBisectableVariableException&) {
+			SolverOutputBox new_sol=check_sol(c->box);
+			store_sol(new_sol);
+			return true;
 		}
 	}
+	catch (EmptyBoxException&) {
+		impact.remove(v); // note: in case of the root node, we should clear the bitset
+		// instead but since the search is over, the impact is not used anymore.
+	}
 
 	return false;
 }
@@ -236,9 +300,9 @@ Solver::Status Solver::solve() {
 
 		while (next()) { }
 
-		if (manif->unknown.size()>0)
+		if (nb_sols(SolverOutputBox::UNKNOWN)>0)
 			manif->status = NOT_ALL_VALIDATED;
-		else if (manif->inner.size()>0 || manif->boundary.size()>0)
+		else if (nb_sols(SolverOutputBox::INNER)>0 || nb_sols(SolverOutputBox::BOUNDARY)>0)
 			manif->status = SUCCESS;
 		else
 			manif->status = INFEASIBLE;
@@ -258,9 +322,22 @@ Solver::Status Solver::solve() {
 	manif->time += time;
 	manif->nb_cells += nb_cells;
 
+	if (sink) sink->end(manif->status, manif->time, manif->nb_cells);
+
 	return manif->status;
 }
 
+int Solver::nb_sols(SolverOutputBox::sol_status status) const {
+	int nb=0;
+	switch(status) {
+	case SolverOutputBox::INNER:    nb=manif->nb_inner(); break;
+	case SolverOutputBox::BOUNDARY: nb=manif->nb_boundary(); break;
+	case SolverOutputBox::UNKNOWN:  nb=manif->nb_unknown(); break;
+	default:                        nb=manif->nb_pending(); break;
+	}
+	return sink? nb+sink->nb(status) : nb;
+}
+
 void Solver::time_limit_check () {
 	Timer::stop();
 	time += Timer::VIRTUAL_TIMELAPSE();
@@ -354,6 +431,22 @@ SolverOutputBox Solver::check_sol(const IntervalVector& box) {
 			if (it->unicity().is_superset(sol._existence))
 				throw EmptyBoxException();
 		}
+
+		for (vector<IntervalVector>::iterator it=sink_unicity.begin(); it!=sink_unicity.end(); it++) {
+			if (it->is_superset(sol._existence))
+				throw EmptyBoxException();
+		}
+
+		// inner boxes of the input file (the unicity box is not stored)
+		const ManifoldFile* input=manif->input();
+		if (input) {
+			IntervalVector box(n);
+			for (int i=0; i<input->nb(SolverOutputBox::INNER); i++) {
+				input->box(i,box);
+				if (box.is_superset(sol._existence))
+					throw EmptyBoxException();
+			}
+		}
 	}
 
 	return sol;
@@ -415,8 +508,21 @@ bool Solver::is_too_large(const IntervalVector& box) {
 	return false;
 }
 
+void Solver::add_sink_unicity(const IntervalVector& box) {
+	if (sink_unicity_limit<0 || sink_unicity.size()<(size_t) sink_unicity_limit)
+		sink_unicity.push_back(box);
+}
+
 void Solver::store_sol(const SolverOutputBox& sol) {
 
+	if (sink) {
+		sink->add(sol);
+		if (eqs && n==m && sol.status==SolverOutputBox::INNER)
+			add_sink_unicity(sol.unicity());
+		if (trace >=1) cout << sol << endl;
+		return;
+	}
+
 	switch (sol.status) {
 	case SolverOutputBox::INNER    :
 		manif->inner.push_back(sol);
@@ -439,7 +545,10 @@ void Solver::flush() {
 		(SolverOutputBox::sol_status&) sol.status = SolverOutputBox::UNKNOWN;
 		sol._existence=cell->box;
 		sol._unicity=NULL;
-		manif->unknown.push_back(sol);
+		if (sink)
+			sink->add(sol);
+		else
+			manif->unknown.push_back(sol);
 		delete buffer.pop();
 	}
 }
@@ -460,9 +569,9 @@ void Solver::report() {
 
 	cout << "\033[0m" << endl;
 
-	cout << " number of inner boxes:\t\t" << manif->inner.size() << endl;
-	cout << " number of boundary boxes:\t" << manif->boundary.size() << endl;
-	cout << " number of unknown boxes:\t" << manif->unknown.size() << endl;
+	cout << " number of inner boxes:\t\t" << nb_sols(SolverOutputBox::INNER) << endl;
+	cout << " number of boundary boxes:\t" << nb_sols(SolverOutputBox::BOUNDARY) << endl;
+	cout << " number of unknown boxes:\t" << nb_sols(SolverOutputBox::UNKNOWN) << endl;
 	cout << " cpu time used:\t\t\t" << time << "s";
 	if (manif->time!=time)
 		cout << " [total=" << manif->time << "]";
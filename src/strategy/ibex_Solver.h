@@ -38,6 +38,7 @@ namespace ibex {
 class CellLimitException : public Exception {} ;
 
 class Manifold;
+class ManifoldSink;
 
 class Solver {
 public:
@@ -250,9 +251,40 @@ public:
 	 */
 	int trace;
 
+	/**
+	 * \brief Destination of the output boxes (NULL by default).
+	 *
+	 * If not NULL, the output boxes are passed to the sink as soon
+	 * as they are found instead of being stored in the manifold
+	 * (the vectors of #get_manifold() remain empty). If the search
+	 * starts from an input paving, the boxes of the paving that are
+	 * not processed again are also passed to the sink. The sink is not
+	 * deleted by the solver and must not be shared by two searches.
+	 *
+	 * In case of a well-constrained system (m=n), the unicity boxes
+	 * of the inner boxes are still kept in memory to discard duplicates
+	 * (see #sink_unicity_limit).
+	 *
+	 * See #ibex::ManifoldSink.
+	 */
+	ManifoldSink* sink;
+
+	/**
+	 * \brief Maximal number of unicity boxes kept in memory with a sink.
+	 *
+	 * In case of a well-constrained system (m=n), the unicity box of each
+	 * inner box passed to the #sink is kept in memory, to discard the
+	 * solutions found again. Beyond this number (100000 by default), the
+	 * unicity boxes are not stored anymore so that the memory remains
+	 * bounded, but a solution may then be passed several times to the sink.
+	 * A negative value means no limit.
+	 */
+	int sink_unicity_limit;
 
 protected:
 
+	friend class ParallelSolver;
+
 	/**
 	 * \brief Called by constructors.
 	 */
@@ -263,6 +295,19 @@ protected:
 	 */
 	Status solve();
 
+	/**
+	 * \brief Process a cell: contraction, certification and bisection.
+	 *
+	 * The cell is not deleted. If a new "solution" (output box) is found,
+	 * it is stored in the manifold.
+	 *
+	 * \param c         - the cell
+	 * \param new_cells - (output) the two subcells if the cell has been
+	 *                    bisected, (NULL,NULL) otherwise.
+	 * \return true if a new "solution" has been stored.
+	 */
+	bool handle_cell(Cell& c, std::pair<Cell*,Cell*>& new_cells);
+
 	/*
 	 * \brief Return a new "output box" that potentially contains solutions.
 	 * \throw An exception otherwise (no solution inside).
@@ -349,6 +394,15 @@ protected:
 	 */
 	Manifold* manif;
 
+	/*
+	 * \brief Memory arena of the cells.
+	 *
+	 * The cells created by this solver are allocated in its arena,
+	 * including in a parallel search (see #ibex::ParallelSolver),
+	 * where a worker may bisect a cell of another worker.
+	 */
+	CellArena* arena;
+
 	/*
 	 * \brief CPU running time used to obtain this manifold.
 	 */
@@ -358,6 +412,23 @@ protected:
 	 * \brief Number of cells used to obtain this manifold.
 	 */
 	unsigned int nb_cells;
+
+	/*
+	 * \brief Unicity boxes of the inner boxes passed to the sink
+	 * (only for well-constrained systems).
+	 */
+	std::vector<IntervalVector> sink_unicity;
+
+	/*
+	 * \brief Add a box to #sink_unicity (unless the limit is reached).
+	 */
+	void add_sink_unicity(const IntervalVector& box);
+
+	/*
+	 * \brief Number of output boxes with a given status (in the
+	 * manifold and the sink).
+	 */
+	int nb_sols(SolverOutputBox::sol_status status) const;
 };
 
 /*============================================ inline implementation ============================================ */
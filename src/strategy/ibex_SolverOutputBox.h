@@ -126,7 +126,9 @@ public:
 
 private:
 	friend class Solver;
+	friend class ParallelSolver;
 	friend class Manifold;
+	friend class ManifoldFile;
 
 	SolverOutputBox(int n);
 
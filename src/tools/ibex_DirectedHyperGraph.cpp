@@ -11,23 +11,106 @@
 
 #include "ibex_DirectedHyperGraph.h"
 #include <iterator>
+#include <algorithm>
+#include <cassert>
 
 namespace ibex {
 
+namespace {
+
+/*
+ * Pack an array of sets into a CSR structure.
+ */
+void pack(int size, const std::set<int>* adj, int*& start, int*& list) {
+	start = new int[size+1];
+	start[0]=0;
+	for (int i=0; i<size; i++)
+		start[i+1]=start[i]+adj[i].size();
+
+	list = new int[start[size]];
+	for (int i=0; i<size; i++)
+		std::copy(adj[i].begin(), adj[i].end(), list+start[i]);
+}
+
+}
+
+DirectedHyperGraph::DirectedHyperGraph(int nb_ctr, int nb_var) : m(nb_ctr), n(nb_var),
+		ctr_input_start(NULL),  ctr_input(NULL),  ctr_output_start(NULL), ctr_output(NULL),
+		var_input_start(NULL),  var_input(NULL),  var_output_start(NULL), var_output(NULL),
+		var_output_arc(NULL) {
+	ctr_input_adj = new std::set<int>[m];
+	ctr_output_adj = new std::set<int>[m];
+	var_input_adj = new std::set<int>[n];
+	var_output_adj = new std::set<int>[n];
+}
+
+DirectedHyperGraph::~DirectedHyperGraph() {
+	if (ctr_input_adj) {
+		delete[] ctr_input_adj;
+		delete[] ctr_output_adj;
+		delete[] var_input_adj;
+		delete[] var_output_adj;
+	} else {
+		delete[] ctr_input_start;  delete[] ctr_input;
+		delete[] ctr_output_start; delete[] ctr_output;
+		delete[] var_input_start;  delete[] var_input;
+		delete[] var_output_start; delete[] var_output;
+		delete[] var_output_arc;
+	}
+}
+
+void DirectedHyperGraph::add_arc(int ctr, int var, bool incoming) {
+	assert(ctr_input_adj); // not built yet
+	if (incoming) {
+		ctr_input_adj[ctr].insert(var);
+		var_output_adj[var].insert(ctr);
+	} else {
+		ctr_output_adj[ctr].insert(var);
+		var_input_adj[var].insert(ctr);
+	}
+}
+
+void DirectedHyperGraph::build() {
+	assert(ctr_input_adj); // not built yet
+
+	pack(m, ctr_input_adj,  ctr_input_start,  ctr_input);
+	pack(m, ctr_output_adj, ctr_output_start, ctr_output);
+	pack(n, var_input_adj,  var_input_start,  var_input);
+	pack(n, var_output_adj, var_output_start, var_output);
+
+	// number the arcs var->ctr
+	var_output_arc = new int[var_output_start[n]];
+	int* pos = new int[n]; // next position in var_output of each variable
+	for (int v=0; v<n; v++) pos[v]=var_output_start[v];
+	for (int c=0; c<m; c++) {
+		// the constraints are visited in increasing order so that
+		// each list var_output_arc[v] is consistent with var_output[v]
+		for (int k=ctr_input_start[c]; k<ctr_input_start[c+1]; k++)
+			var_output_arc[pos[ctr_input[k]]++]=k;
+	}
+	delete[] pos;
+
+	delete[] ctr_input_adj;
+	delete[] ctr_output_adj;
+	delete[] var_input_adj;
+	delete[] var_output_adj;
+	ctr_input_adj = ctr_output_adj = var_input_adj = var_output_adj = NULL;
+}
+
 std::ostream& operator<<(std::ostream& os, const DirectedHyperGraph& g) {
 	for (int c=0; c<g.m; c++) {
 		os << "ctr " << c << " input=( ";
-		copy(g.input_vars(c).begin(), g.input_vars(c).end(), std::ostream_iterator<int>(os, " "));
+		std::copy(g.input_vars(c), g.input_vars(c)+g.nb_input_vars(c), std::ostream_iterator<int>(os, " "));
 		os << ") output=( ";
-		copy(g.output_vars(c).begin(), g.output_vars(c).end(), std::ostream_iterator<int>(os, " "));
+		std::copy(g.output_vars(c), g.output_vars(c)+g.nb_output_vars(c), std::ostream_iterator<int>(os, " "));
 		os << ")\n";
 	}
 
 	for (int v=0; v<g.n; v++) {
 		os << "var " << v << " input=( ";
-		copy(g.input_ctrs(v).begin(), g.input_ctrs(v).end(), std::ostream_iterator<int>(os, " "));
+		std::copy(g.input_ctrs(v), g.input_ctrs(v)+g.nb_input_ctrs(v), std::ostream_iterator<int>(os, " "));
 		os << ") output=( ";
-		copy(g.output_ctrs(v).begin(), g.output_ctrs(v).end(), std::ostream_iterator<int>(os, " "));
+		std::copy(g.output_ctrs(v), g.output_ctrs(v)+g.nb_output_ctrs(v), std::ostream_iterator<int>(os, " "));
 		os << ")\n";
 	}
 	return os;
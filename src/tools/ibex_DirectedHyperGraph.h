@@ -1,5 +1,5 @@
 /* ============================================================================
- * I B E X - Directed hyper-graph (represented by an adjacency matrix)
+ * I B E X - Directed hyper-graph (represented by adjacency lists)
  * ============================================================================
  * Copyright   : Ecole des Mines de Nantes (FRANCE)
  * License     : This program can be distributed under the terms of the GNU LGPL.
@@ -21,6 +21,10 @@ namespace ibex {
  * \ingroup tools
  * \brief Directed hyper-graph.
  *
+ * The graph is built in two steps: arcs are first added one by one
+ * (see #add_arc()), then the adjacency lists are packed into flat arrays
+ * (see #build()), in the so-called "compressed sparse row" (CSR) format.
+ * Queries are only possible after the graph has been built.
  */
 class DirectedHyperGraph {
 public:
@@ -30,7 +34,7 @@ public:
 	 */
 	DirectedHyperGraph(int nb_ctr, int nb_var);
 
-		/**
+	/**
 	 * \brief Delete the graph.
 	 */
 	~DirectedHyperGraph();
@@ -51,34 +55,95 @@ public:
 	 * \param incoming True iff \a var is an incoming variable
 	 * (the arc is var->ctr). Otherwise, \a var is outgoing (the
 	 * arc is var<-ctr).
+	 *
+	 * \pre The graph is not built yet.
 	 */
 	void add_arc(int ctr, int var, bool incoming);
 
+	/**
+	 * \brief Pack the adjacency lists.
+	 *
+	 * Must be called once all the arcs are added.
+	 */
+	void build();
+
+	/**
+	 * \brief Return the number of input variables of a constraint \a ctr.
+	 */
+	int nb_input_vars(int ctr) const;
+
 	/**
 	 * \brief Return the input variables of a constraint \a ctr.
 	 *
+	 * The array is sorted and its size is #nb_input_vars(ctr).
 	 */
-	 const std::set<int>& input_vars(int ctr) const;
+	const int* input_vars(int ctr) const;
+
+	/**
+	 * \brief Return the number of output variables of a constraint \a ctr.
+	 */
+	int nb_output_vars(int ctr) const;
 
 	/**
 	 * \brief Return the output variables of a constraint \a ctr.
 	 *
+	 * The array is sorted and its size is #nb_output_vars(ctr).
+	 */
+	const int* output_vars(int ctr) const;
+
+	/**
+	 * \brief Return the number of input constraints of a variable \a var.
+	 *
+	 *  \pre 0 <= \a var < #nb_var().
 	 */
-	 const std::set<int>& output_vars(int ctr) const;
+	int nb_input_ctrs(int var) const;
 
 	/**
 	 * \brief Return the input constraints of a variable \a var.
 	 *
+	 * The array is sorted and its size is #nb_input_ctrs(var).
+	 *
+	 *  \pre 0 <= \a var < #nb_var().
+	 */
+	const int* input_ctrs(int var) const;
+
+	/**
+	 * \brief Return the number of output constraints of a variable \a var.
+	 *
 	 *  \pre 0 <= \a var < #nb_var().
 	 */
-	 const std::set<int>& input_ctrs(int var) const;
+	int nb_output_ctrs(int var) const;
 
 	/**
 	 * \brief Return the output constraints of a variable \a var.
 	 *
+	 * The array is sorted and its size is #nb_output_ctrs(var).
+	 *
 	 *  \pre 0 <= \a var < #nb_var().
 	 */
-	 const std::set<int>& output_ctrs(int var) const;
+	const int* output_ctrs(int var) const;
+
+	/**
+	 * \brief Return the total number of incoming arcs (var->ctr).
+	 */
+	int nb_input_arcs() const;
+
+	/**
+	 * \brief Return the number of the first input arc of a constraint \a ctr.
+	 *
+	 * The incoming arcs (var->ctr) are numbered from 0 to #nb_input_arcs()-1
+	 * in the order of the constraints: the ith input variable of \a ctr
+	 * is the extremity of the arc number first_input_arc(ctr)+i.
+	 */
+	int first_input_arc(int ctr) const;
+
+	/**
+	 * \brief Return the numbers of the output arcs of a variable \a var.
+	 *
+	 * The ith entry is the number of the arc var->c where c is the
+	 * ith output constraint of \a var (see #first_input_arc(int)).
+	 */
+	const int* output_arcs(int var) const;
 
 	/**
 	 * \brief Display the internal structure (matrix & tables).
@@ -92,28 +157,28 @@ private:
 
 	const int m;
 	const int n;
+
+	/* adjacency lists during construction (NULL once built) */
 	std::set<int> *ctr_input_adj;
 	std::set<int> *ctr_output_adj;
 	std::set<int> *var_input_adj;
 	std::set<int> *var_output_adj;
-};
 
+	/*
+	 * Packed adjacency lists: the list of the ith constraint (resp. variable) is
+	 * xxx_adj[xxx_start[i]]...xxx_adj[xxx_start[i+1]-1].
+	 */
+	int *ctr_input_start,  *ctr_input;
+	int *ctr_output_start, *ctr_output;
+	int *var_input_start,  *var_input;
+	int *var_output_start, *var_output;
 
-/*================================== inline implementations ========================================*/
+	/* var_output_arc[k]: number of the arc corresponding to var_output[k] */
+	int *var_output_arc;
+};
 
-inline DirectedHyperGraph::DirectedHyperGraph(int nb_ctr, int nb_var) : m(nb_ctr), n(nb_var) {
-	ctr_input_adj = new std::set<int>[m];
-	ctr_output_adj = new std::set<int>[m];
-	var_input_adj = new std::set<int>[n];
-	var_output_adj = new std::set<int>[n];
-}
 
-inline DirectedHyperGraph::~DirectedHyperGraph() {
-	delete[] ctr_input_adj;
-	delete[] ctr_output_adj;
-	delete[] var_input_adj;
-	delete[] var_output_adj;
-}
+/*================================== inline implementations ========================================*/
 
 inline int DirectedHyperGraph::nb_ctr() const {
 	return m;
@@ -123,30 +188,48 @@ inline int DirectedHyperGraph::nb_var() const {
 	return n;
 }
 
-inline void DirectedHyperGraph::add_arc(int ctr, int var, bool incoming) {
-	if (incoming) {
-		ctr_input_adj[ctr].insert(var);
-		var_output_adj[var].insert(ctr);
-	} else {
-		ctr_output_adj[ctr].insert(var);
-		var_input_adj[var].insert(ctr);
-	}
+inline int DirectedHyperGraph::nb_input_vars(int ctr) const {
+	return ctr_input_start[ctr+1]-ctr_input_start[ctr];
+}
+
+inline const int* DirectedHyperGraph::input_vars(int ctr) const {
+	return ctr_input+ctr_input_start[ctr];
+}
+
+inline int DirectedHyperGraph::nb_output_vars(int ctr) const {
+	return ctr_output_start[ctr+1]-ctr_output_start[ctr];
+}
+
+inline const int* DirectedHyperGraph::output_vars(int ctr) const {
+	return ctr_output+ctr_output_start[ctr];
+}
+
+inline int DirectedHyperGraph::nb_input_ctrs(int var) const {
+	return var_input_start[var+1]-var_input_start[var];
+}
+
+inline const int* DirectedHyperGraph::input_ctrs(int var) const {
+	return var_input+var_input_start[var];
+}
+
+inline int DirectedHyperGraph::nb_output_ctrs(int var) const {
+	return var_output_start[var+1]-var_output_start[var];
 }
 
-inline const std::set<int>& DirectedHyperGraph::input_vars(int ctr) const {
-	return ctr_input_adj[ctr];
+inline const int* DirectedHyperGraph::output_ctrs(int var) const {
+	return var_output+var_output_start[var];
 }
 
-inline const std::set<int>& DirectedHyperGraph::output_vars(int ctr) const {
-	return ctr_output_adj[ctr];
+inline int DirectedHyperGraph::nb_input_arcs() const {
+	return ctr_input_start[m];
 }
 
-inline const std::set<int>& DirectedHyperGraph::input_ctrs(int var) const {
-	return var_input_adj[var];
+inline int DirectedHyperGraph::first_input_arc(int ctr) const {
+	return ctr_input_start[ctr];
 }
 
-inline const std::set<int>& DirectedHyperGraph::output_ctrs(int var) const {
-	return var_output_adj[var];
+inline const int* DirectedHyperGraph::output_arcs(int var) const {
+	return var_output_arc+var_output_start[var];
 }
 
 } // namespace ibex
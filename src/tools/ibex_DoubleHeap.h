@@ -13,6 +13,8 @@
 #include "ibex_SharedHeap.h"
 #include "ibex_Random.h"
 
+#include <vector>
+
 namespace ibex {
 
 /**
@@ -105,6 +107,12 @@ public:
 	 */
 	void contract(double loup1);
 
+	/**
+	 * \brief Append all the data of the heap to a vector
+	 * (in no specific order).
+	 */
+	void elements(std::vector<T*>& v) const;
+
 	/**
 	 * \brief Delete this
 	 */
@@ -152,6 +160,11 @@ protected:
 	 */
 	void erase_subnodes(HeapNode<T>* node, bool percolate);
 
+	/**
+	 * Append the data of all the subnodes of node (including itself).
+	 */
+	void elements_rec(HeapNode<T>* node, std::vector<T*>& v) const;
+
 	std::ostream& print(std::ostream& os) const;
 };
 
@@ -245,6 +258,19 @@ void DoubleHeap<T>::erase_subnodes(HeapNode<T>* node, bool percolate) {
 	delete node;
 }
 
+template<class T>
+void DoubleHeap<T>::elements(std::vector<T*>& v) const {
+	v.reserve(v.size()+nb_nodes);
+	if (nb_nodes>0) elements_rec(heap1->root, v);
+}
+
+template<class T>
+void DoubleHeap<T>::elements_rec(HeapNode<T>* node, std::vector<T*>& v) const {
+	v.push_back(node->elt->data);
+	if (node->left) elements_rec(node->left, v);
+	if (node->right) elements_rec(node->right, v);
+}
+
 template<class T>
 bool DoubleHeap<T>::empty() const {
 	// if one buffer is empty, the other is also empty
@@ -0,0 +1,197 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Lock.cpp
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "ibex_Lock.h"
+#include "ibex_Timer.h"
+#include "ibex_LinearException.h"
+#include "ibex_NoBisectableVariableException.h"
+#include "ibex_Dim.h"
+
+#include <new>
+#include <stdexcept>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sched.h>
+#include <time.h>
+#endif
+
+#ifndef _OPENMP
+#include <sys/time.h>
+#endif
+
+namespace ibex {
+
+namespace {
+
+// number of calls to Backoff::pause() that only yield the processor
+const int NB_YIELDS=16;
+
+// maximal sleeping time of Backoff::pause() (in microseconds)
+const int MAX_SLEEP=1000;
+
+}
+
+void Backoff::pause() {
+	if (n<NB_YIELDS) {
+		n++;
+#ifdef _WIN32
+		Sleep(0);
+#else
+		sched_yield();
+#endif
+	} else {
+		// 10, 20, 40, ... microseconds (up to MAX_SLEEP)
+		int shift=n-NB_YIELDS;
+		int usec=shift<7 ? 10<<shift : MAX_SLEEP;
+		if (usec>MAX_SLEEP) usec=MAX_SLEEP;
+		else n++;
+#ifdef _WIN32
+		Sleep(1); // resolution of Sleep is the millisecond
+#else
+		struct timespec ts;
+		ts.tv_sec=0;
+		ts.tv_nsec=usec*1000L;
+		nanosleep(&ts,NULL);
+#endif
+	}
+}
+
+ExceptionCapture::ExceptionCapture() : holder(NULL) { }
+
+ExceptionCapture::~ExceptionCapture() {
+	delete holder;
+}
+
+void ExceptionCapture::capture() {
+	// the exception being handled is raised again to get its class
+	try {
+		throw;
+	} catch(TimeOutException& e) {
+		capture(e);
+	} catch(NoBisectableVariableException& e) {
+		capture(e);
+	} catch(NotSquareMatrixException& e) {
+		capture(e);
+	} catch(SingularMatrixException& e) {
+		capture(e);
+	} catch(NullPivotException& e) {
+		capture(e);
+	} catch(NotInversePositiveMatrixException& e) {
+		capture(e);
+	} catch(LinearException& e) {
+		capture(e);
+	} catch(DimException& e) {
+		capture(e);
+	} catch(Exception& e) {
+		capture(e);
+	} catch(std::bad_alloc& e) {
+		capture(e);
+	} catch(std::exception& e) {
+		capture(std::runtime_error(e.what()));
+	} catch(...) {
+		capture(Exception());
+	}
+}
+
+void ExceptionCapture::set(Holder* h) {
+	lock.lock();
+	if (holder==NULL) {
+		holder=h;
+		h=NULL;
+	}
+	lock.unlock();
+	delete h;
+}
+
+void ExceptionCapture::rethrow() {
+	if (!holder) return;
+
+	Holder* h=holder;
+	holder=NULL;
+
+	try {
+		h->raise();
+	} catch(...) {
+		delete h;
+		throw;
+	}
+}
+
+#ifdef _OPENMP
+
+Lock::Lock() : _lock(new omp_lock_t) {
+	omp_init_lock((omp_lock_t*) _lock);
+}
+
+Lock::~Lock() {
+	omp_destroy_lock((omp_lock_t*) _lock);
+	delete (omp_lock_t*) _lock;
+}
+
+void Lock::lock() {
+	omp_set_lock((omp_lock_t*) _lock);
+}
+
+void Lock::unlock() {
+	omp_unset_lock((omp_lock_t*) _lock);
+}
+
+bool Lock::try_lock() {
+	return omp_test_lock((omp_lock_t*) _lock);
+}
+
+int max_threads() {
+	return omp_get_max_threads();
+}
+
+int thread_num() {
+	return omp_get_thread_num();
+}
+
+double wall_time() {
+	return omp_get_wtime();
+}
+
+#else
+
+Lock::Lock() : _lock(NULL) { }
+
+Lock::~Lock() { }
+
+void Lock::lock() { }
+
+void Lock::unlock() { }
+
+bool Lock::try_lock() {
+	return true;
+}
+
+int max_threads() {
+	return 1;
+}
+
+int thread_num() {
+	return 0;
+}
+
+double wall_time() {
+	struct timeval tp;
+	gettimeofday(&tp, NULL);
+	return (double) tp.tv_sec + (double) tp.tv_usec / 1000000.0;
+}
+
+#endif
+
+} // end namespace ibex
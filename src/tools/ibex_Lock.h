@@ -0,0 +1,235 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Lock.h
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __IBEX_LOCK_H__
+#define __IBEX_LOCK_H__
+
+#include <cstddef>
+
+namespace ibex {
+
+/**
+ * \ingroup tools
+ *
+ * \brief Mutual exclusion lock.
+ *
+ * Thin wrapper of OpenMP locks used by the parallel strategies.
+ * If Ibex is compiled without OpenMP (see the --with-openmp option),
+ * all the operations are no-ops (there is only one thread).
+ *
+ * The OpenMP lock is hidden in the implementation so that the layout
+ * of this class does not depend on whether the client code is
+ * compiled with OpenMP or not.
+ */
+class Lock {
+public:
+	/**
+	 * \brief Create an unlocked lock.
+	 */
+	Lock();
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~Lock();
+
+	/**
+	 * \brief Wait until the lock is available and acquire it.
+	 */
+	void lock();
+
+	/**
+	 * \brief Release the lock.
+	 */
+	void unlock();
+
+	/**
+	 * \brief Try to acquire the lock without waiting.
+	 *
+	 * \return true if the lock has been acquired.
+	 */
+	bool try_lock();
+
+private:
+	Lock(const Lock&); // forbidden
+	Lock& operator=(const Lock&); // forbidden
+
+	void* _lock; // the OpenMP lock (NULL without OpenMP)
+};
+
+/**
+ * \ingroup tools
+ *
+ * \brief Lock acquired in a scope.
+ *
+ * The lock is released when the object is destroyed, including
+ * when an exception is raised.
+ */
+class ScopedLock {
+public:
+	ScopedLock(Lock& l) : l(l) { l.lock(); }
+
+	~ScopedLock() { l.unlock(); }
+
+private:
+	Lock& l;
+};
+
+/**
+ * \ingroup tools
+ *
+ * \brief Back-off of a thread waiting for work.
+ *
+ * An idle thread of a parallel strategy that repeatedly looks for
+ * work (e.g., a cell to steal) calls #pause() between two attempts,
+ * so as not to slow down the other threads by contending for their locks.
+ * The first calls only yield the processor, the following ones
+ * sleep for increasing (but short) durations.
+ */
+class Backoff {
+public:
+	/**
+	 * \brief Create a back-off.
+	 */
+	Backoff();
+
+	/**
+	 * \brief Wait (longer at each call).
+	 */
+	void pause();
+
+	/**
+	 * \brief Reset the back-off (to be called once work has been found).
+	 */
+	void reset();
+
+private:
+	int n; // number of calls to pause() since the last reset
+};
+
+/**
+ * \ingroup tools
+ *
+ * \brief Exception raised by a thread of a parallel region.
+ *
+ * An exception that escapes a parallel region terminates the process.
+ * The threads of the parallel strategies therefore catch the exceptions
+ * and record the first one in this object, which is raised again by
+ * the calling thread once the parallel region is over (see #rethrow()).
+ *
+ * The exception must be copied to be raised again. The class of the
+ * exception is kept for the exceptions of Ibex that are recorded by
+ * #capture(const E&) and, with #capture(), for the usual exceptions
+ * (TimeOutException, LinearException, etc.). Otherwise, an exception
+ * of Ibex is raised again as an #ibex::Exception and a standard
+ * exception as a std::runtime_error with the same message.
+ */
+class ExceptionCapture {
+public:
+	/**
+	 * \brief Create an empty capture.
+	 */
+	ExceptionCapture();
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~ExceptionCapture();
+
+	/**
+	 * \brief Record the exception being handled.
+	 *
+	 * Must be called in a catch block. Does nothing if an exception
+	 * has already been recorded (by any thread).
+	 */
+	void capture();
+
+	/**
+	 * \brief Record an exception.
+	 *
+	 * Does nothing if an exception has already been recorded (by any thread).
+	 */
+	template<class E>
+	void capture(const E& e);
+
+	/**
+	 * \brief True if an exception has been recorded.
+	 *
+	 * To be called once the parallel region is over.
+	 */
+	bool captured() const;
+
+	/**
+	 * \brief Raise the recorded exception, if any.
+	 *
+	 * The record is cleared.
+	 */
+	void rethrow();
+
+private:
+	ExceptionCapture(const ExceptionCapture&); // forbidden
+	ExceptionCapture& operator=(const ExceptionCapture&); // forbidden
+
+	/* Copy of an exception. */
+	class Holder {
+	public:
+		virtual ~Holder() { }
+		virtual void raise() const=0;
+	};
+
+	template<class E>
+	class HolderOf : public Holder {
+	public:
+		HolderOf(const E& e) : e(e) { }
+		virtual void raise() const { throw e; }
+		E e;
+	};
+
+	/* Record a copy (if none yet) and delete it otherwise. */
+	void set(Holder* h);
+
+	Holder* holder;
+	Lock lock;
+};
+
+/**
+ * \brief Wall-clock time in seconds, from an arbitrary origin.
+ *
+ * Unlike #ibex::Timer, this function can be called by any thread.
+ */
+double wall_time();
+
+/**
+ * \brief Maximal number of threads of a parallel region (1 without OpenMP).
+ */
+int max_threads();
+
+/**
+ * \brief Number of the current thread, in [0,max_threads()[ (0 without OpenMP).
+ */
+int thread_num();
+
+/*============================================ inline implementation ============================================ */
+
+inline Backoff::Backoff() : n(0) { }
+
+inline void Backoff::reset()   { n=0; }
+
+template<class E>
+inline void ExceptionCapture::capture(const E& e) {
+	set(new HolderOf<E>(e));
+}
+
+inline bool ExceptionCapture::captured() const {
+	return holder!=NULL;
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_LOCK_H__
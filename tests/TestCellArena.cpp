@@ -0,0 +1,181 @@
+/* ============================================================================
+ * I B E X - Cell arena Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestCellArena.h"
+#include "ibex_Cell.h"
+#include "ibex_Bsc.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+class Depth : public Backtrackable {
+public:
+	Depth() : depth(0) { }
+	Depth(int depth) : depth(depth) { }
+	std::pair<Backtrackable*,Backtrackable*> down() {
+		return std::pair<Backtrackable*,Backtrackable*>(new Depth(depth+1),new Depth(depth+1));
+	}
+	int depth;
+};
+
+}
+
+void TestCellArena::alloc01() {
+	CellArena* arena=new CellArena();
+
+	void* p1=arena->alloc(40);
+	void* p2=arena->alloc(40);
+	CPPUNIT_ASSERT(((size_t) p1)%16==0);
+	CPPUNIT_ASSERT(((size_t) p2)%16==0);
+	CPPUNIT_ASSERT(p1!=p2);
+	CPPUNIT_ASSERT(arena->nb_objects()==2);
+
+	// freed memory is reused by the next allocation of the same size
+	arena->free(p1,40);
+	CPPUNIT_ASSERT(arena->alloc(48)==p1);
+
+	arena->free(p1,48);
+	arena->free(p2,40);
+	CPPUNIT_ASSERT(arena->nb_objects()==0);
+	arena->release();
+}
+
+void TestCellArena::alloc02() {
+	CellArena* arena=new CellArena();
+
+	// no new slab once the maximal number of objects is reached
+	vector<void*> p(100);
+	for (int k=0; k<100; k++) {
+		for (int i=0; i<100; i++) p[i]=arena->alloc(256);
+		for (int i=0; i<100; i++) arena->free(p[i],256);
+	}
+	CPPUNIT_ASSERT(arena->nb_allocs()==10000);
+	CPPUNIT_ASSERT(arena->nb_slabs()==1);
+
+	// large blocks
+	void* q=arena->alloc(10000);
+	CPPUNIT_ASSERT(arena->nb_objects()==1);
+	arena->free(q,10000);
+	CPPUNIT_ASSERT(arena->nb_slabs()==1);
+	arena->release();
+}
+
+void TestCellArena::cell01() {
+	CellArena* arena=new CellArena();
+
+	IntervalVector box(3,Interval(0,1));
+	Cell* root=new (*arena) Cell(box,*arena);
+	root->add<BisectedVar>();
+	CPPUNIT_ASSERT(root->arena==arena);
+	CPPUNIT_ASSERT(root->box==box);
+
+	pair<IntervalVector,IntervalVector> boxes=box.bisect(1);
+	pair<Cell*,Cell*> p=root->bisect(boxes.first,boxes.second);
+	CPPUNIT_ASSERT(p.first->arena==arena);
+	CPPUNIT_ASSERT(p.second->arena==arena);
+	CPPUNIT_ASSERT(p.first->box[1]==Interval(0,0.5));
+	CPPUNIT_ASSERT(p.second->box[1]==Interval(0.5,1));
+	CPPUNIT_ASSERT(p.first->get<BisectedVar>().var==-1);
+
+	// the box of a cell is an ordinary vector
+	p.second->box=IntervalVector(4,Interval(2,3));
+	CPPUNIT_ASSERT(p.second->box.size()==4);
+
+	delete root;
+	delete p.first;
+	delete p.second;
+	CPPUNIT_ASSERT(arena->nb_objects()==0);
+	arena->release();
+}
+
+void TestCellArena::cell03() {
+	CellArena* a1=new CellArena();
+	CellArena* a2=new CellArena();
+
+	// a cell of a1 bisected by a worker that owns a2
+	Cell* root=new (*a1) Cell(IntervalVector(2,Interval(0,1)),*a1);
+	root->add<BisectedVar>();
+	unsigned long n1=a1->nb_objects();
+
+	pair<IntervalVector,IntervalVector> boxes=root->box.bisect(0);
+	pair<Cell*,Cell*> p=root->bisect(boxes.first,boxes.second,a2);
+	CPPUNIT_ASSERT(p.first->arena==a2);
+	CPPUNIT_ASSERT(p.second->arena==a2);
+	CPPUNIT_ASSERT(a1->nb_objects()==n1);
+	CPPUNIT_ASSERT(a2->nb_objects()==2*n1);
+	CPPUNIT_ASSERT(p.second->get<BisectedVar>().var==-1);
+
+	delete root;
+	CPPUNIT_ASSERT(a1->nb_objects()==0);
+	delete p.first;
+	delete p.second;
+	CPPUNIT_ASSERT(a2->nb_objects()==0);
+	a1->release();
+	a2->release();
+}
+
+void TestCellArena::cell02() {
+	CellArena* arena=new CellArena();
+
+	Cell* c=new (*arena) Cell(IntervalVector(2,Interval(-1,1)),*arena);
+	c->add<BisectedVar>();
+
+	// the arena is freed when the last cell is deleted
+	arena->release();
+	CPPUNIT_ASSERT(c->box==IntervalVector(2,Interval(-1,1)));
+	delete c;
+
+	// cells in the heap
+	Cell* d=new Cell(IntervalVector(2));
+	CPPUNIT_ASSERT(d->arena==NULL);
+	d->add<BisectedVar>();
+	pair<IntervalVector,IntervalVector> boxes=d->box.bisect(0);
+	pair<Cell*,Cell*> p=d->bisect(boxes.first,boxes.second);
+	CPPUNIT_ASSERT(p.first->arena==NULL);
+	delete d;
+	delete p.first;
+	delete p.second;
+}
+
+void TestCellArena::data01() {
+	CPPUNIT_ASSERT(Cell::slot<Depth>()!=Cell::slot<BisectedVar>());
+	CPPUNIT_ASSERT(Cell::slot<Depth>()==Cell::slot<Depth>());
+
+	CellArena* arena=new CellArena();
+
+	Cell* root=new (*arena) Cell(IntervalVector(2,Interval(0,1)),*arena);
+	root->add<Depth>();
+	root->add<BisectedVar>();
+	root->get<BisectedVar>().var=0;
+	root->add<Depth>(); // already added: no effect
+	CPPUNIT_ASSERT(root->get<Depth>().depth==0);
+
+	pair<IntervalVector,IntervalVector> boxes=root->box.bisect(0);
+	pair<Cell*,Cell*> p=root->bisect(boxes.first,boxes.second);
+	CPPUNIT_ASSERT(p.first->get<Depth>().depth==1);
+	CPPUNIT_ASSERT(p.second->get<Depth>().depth==1);
+	CPPUNIT_ASSERT(p.second->get<BisectedVar>().var==0);
+
+	// former access by class name
+	CPPUNIT_ASSERT(p.first->get_data(typeid(Depth).name())==&p.first->get<Depth>());
+	CPPUNIT_ASSERT(p.first->get_data("no such class")==NULL);
+
+	delete root;
+	delete p.first;
+	delete p.second;
+	CPPUNIT_ASSERT(arena->nb_objects()==0);
+	arena->release();
+}
+
+} // end namespace ibex
@@ -0,0 +1,47 @@
+/* ============================================================================
+ * I B E X - Cell arena Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_CELL_ARENA_H__
+#define __TEST_CELL_ARENA_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "ibex_CellArena.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestCellArena : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestCellArena);
+	CPPUNIT_TEST(alloc01);
+	CPPUNIT_TEST(alloc02);
+	CPPUNIT_TEST(cell01);
+	CPPUNIT_TEST(cell02);
+	CPPUNIT_TEST(cell03);
+	CPPUNIT_TEST(data01);
+	CPPUNIT_TEST_SUITE_END();
+
+	void alloc01();
+	void alloc02();
+	void cell01();
+	void cell02();
+	void cell03();
+	void data01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCellArena);
+
+} // namespace ibex
+
+#endif // __TEST_CELL_ARENA_H__
@@ -0,0 +1,113 @@
+/* ============================================================================
+ * I B E X - 3BCID and ACID Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestCtcAcid.h"
+#include "ibex_Ctc3BCid.h"
+#include "ibex_CtcHC4.h"
+#include "ibex_SystemFactory.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// intersection of two circles: x=1/2, y=+/-sqrt(3)/2
+System* circles() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	SystemFactory f;
+	f.add_var(x);
+	f.add_var(y);
+	f.add_ctr(sqr(x)+sqr(y)=1);
+	f.add_ctr(sqr(x-1)+sqr(y)=1);
+	return new System(f);
+}
+
+}
+
+void TestCtcAcid::parallel3bcid01() {
+	System* sys=circles();
+	System sys2(*sys,System::COPY);
+	System sys3(*sys,System::COPY);
+	CtcHC4 hc4_1(*sys), hc4_2(sys2), hc4_3(sys3);
+
+	Ctc3BCid cid2(Array<Ctc>(hc4_1,hc4_2));
+	Ctc3BCid cid3(Array<Ctc>(hc4_1,hc4_2,hc4_3));
+
+	IntervalVector box(2,Interval(-10,10));
+	hc4_1.contract(box);
+	IntervalVector box2(box);
+	IntervalVector box3(box);
+	cid2.contract(box2);
+	cid3.contract(box3);
+
+	// the result does not depend on the number of threads
+	CPPUNIT_ASSERT(box2==box3);
+
+	Vector sol(2);
+	sol[0]=0.5;
+	sol[1]=::sqrt(3)/2;
+	CPPUNIT_ASSERT(box2.contains(sol));
+	sol[1]=-sol[1];
+	CPPUNIT_ASSERT(box2.contains(sol));
+
+	// stronger than HC4 alone
+	CPPUNIT_ASSERT(box2.is_strict_subset(box));
+
+	delete sys;
+}
+
+void TestCtcAcid::parallel3bcid02() {
+	System* sys=circles();
+	System sys2(*sys,System::COPY);
+	CtcHC4 hc4_1(*sys), hc4_2(sys2);
+
+	Ctc3BCid cid(Array<Ctc>(hc4_1,hc4_2));
+
+	// no solution in this box
+	IntervalVector box(2);
+	box[0]=Interval(2,3);
+	box[1]=Interval(-10,10);
+	cid.contract(box);
+	CPPUNIT_ASSERT(box.is_empty());
+
+	delete sys;
+}
+
+void TestCtcAcid::parallelacid01() {
+	System* sys=circles();
+	System sys2(*sys,System::COPY);
+	System sys3(*sys,System::COPY);
+	CtcHC4 hc4_1(*sys), hc4_2(sys2), hc4_3(sys3);
+
+	CtcAcid acid2(*sys,Array<Ctc>(hc4_1,hc4_2));
+	CtcAcid acid3(*sys,Array<Ctc>(hc4_1,hc4_2,hc4_3));
+
+	// more calls than the first tuning phase, so that
+	// the number of variables to be shaved is adapted.
+	for (int i=0; i<100; i++) {
+		IntervalVector box(2);
+		box[0]=Interval(-1-i*0.1,1+i*0.05);
+		box[1]=Interval(0,1+i*0.1);
+		IntervalVector box2(box);
+		IntervalVector box3(box);
+		acid2.contract(box2);
+		acid3.contract(box3);
+		CPPUNIT_ASSERT(box2==box3);
+		CPPUNIT_ASSERT(box2[0].contains(0.5));
+		CPPUNIT_ASSERT(box2[1].contains(::sqrt(3)/2));
+	}
+
+	delete sys;
+}
+
+} // namespace ibex
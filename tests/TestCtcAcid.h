@@ -0,0 +1,41 @@
+/* ============================================================================
+ * I B E X - 3BCID and ACID Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_CTC_ACID_H__
+#define __TEST_CTC_ACID_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "ibex_CtcAcid.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestCtcAcid : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestCtcAcid);
+	CPPUNIT_TEST(parallel3bcid01);
+	CPPUNIT_TEST(parallel3bcid02);
+	CPPUNIT_TEST(parallelacid01);
+	CPPUNIT_TEST_SUITE_END();
+
+	void parallel3bcid01();
+	void parallel3bcid02();
+	void parallelacid01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestCtcAcid);
+
+} // namespace ibex
+
+#endif // __TEST_CTC_ACID_H__
@@ -14,8 +14,46 @@
 #include "ibex_CtcHC4.h"
 #include "ibex_Array.h"
 
+#include <vector>
+
+using namespace std;
+
 namespace ibex {
 
+namespace {
+
+/*
+ * x[out] := x[out] \cap factor * sum of x[in]
+ * and record the impacts.
+ */
+class CtcTest : public Ctc {
+public:
+	CtcTest(int n, const BitSet& in, int out, double factor) : Ctc(n), out(out), factor(factor) {
+		input = new BitSet(in);
+		output = new BitSet(BitSet::singleton(n,out));
+	}
+
+	~CtcTest() {
+		delete input;
+		delete output;
+	}
+
+	void contract(IntervalVector& box) {
+		if (impact()) impacts.push_back(*impact());
+		Interval sum=0;
+		for (int i=input->min(); i<=input->max(); i++)
+			if ((*input)[i]) sum+=box[i];
+		box[out] &= factor*sum;
+		if (box[out].is_empty()) box.set_empty();
+	}
+
+	int out;
+	double factor;
+	vector<BitSet> impacts;
+};
+
+}
+
 void TestCtcHC4::ponts30() {
 	Ponts30 p30;
 	IntervalVector box = p30.init_box;
@@ -55,4 +93,32 @@ void TestCtcHC4::ponts30() {
 	}
 }
 
+void TestCtcHC4::impact01() {
+	BitSet in0=BitSet::singleton(3,0);
+	BitSet in1=BitSet::empty(3);
+	in1.add(1);
+	in1.add(2);
+
+	CtcTest c0(3,in0,1,0.5); // x1 = x0/2
+	CtcTest c1(3,in1,2,0.5); // x2 = (x1+x2)/2
+
+	CtcPropag propag(Array<Ctc>(c0,c1),0.01,true);
+
+	IntervalVector box(3,Interval(0,1));
+	// only x0 is impacted
+	((Ctc&) propag).contract(box,BitSet::singleton(3,0));
+
+	CPPUNIT_ASSERT(box[1]==Interval(0,0.5));
+	CPPUNIT_ASSERT(box[2].is_subset(Interval(0,0.75)));
+
+	CPPUNIT_ASSERT(c0.impacts.size()==1);
+	CPPUNIT_ASSERT(c0.impacts[0]==BitSet::singleton(3,0));
+
+	// c1 is only told that x1 has been modified
+	CPPUNIT_ASSERT(c1.impacts.size()>=2);
+	CPPUNIT_ASSERT(c1.impacts[0]==BitSet::singleton(3,1));
+	// then, that x2 has been modified by itself
+	CPPUNIT_ASSERT(c1.impacts[1]==BitSet::singleton(3,2));
+}
+
 } // end namespace ibex
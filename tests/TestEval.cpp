@@ -13,6 +13,7 @@
 #include "ibex_Function.h"
 #include "ibex_Expr.h"
 #include "ibex_Eval.h"
+#include "ibex_BatchEval.h"
 
 using namespace std;
 
@@ -270,4 +271,97 @@ void TestEval::eval_components02() {
 	CPPUNIT_ASSERT(res[3]==19);
 }
 
+void TestEval::batch01() {
+	const ExprSymbol& x = ExprSymbol::new_("x");
+	const ExprSymbol& y = ExprSymbol::new_("y");
+	Function f(x,y,sqr(x)*y-abs(x-2*y)+max(x,-y)*min(y,1.5)+sqrt(x)/y+exp(sin(x*y))+pow(y,3));
+
+	BatchEval e(f,8); // small blocks to test several (incomplete) blocks
+	CPPUNIT_ASSERT(e.vectorized());
+
+	int n=21;
+	IntervalMatrix boxes(n,2);
+	for (int i=0; i<n; i++) {
+		boxes[i][0]=Interval(i-10,i-10+0.1*i);
+		boxes[i][1]=Interval(-1-0.5*i,0.25*i+1);
+	}
+	boxes[3][0]=Interval(-2,-1);        // outside the domain of sqrt
+	boxes[5].set_empty();               // empty box
+	boxes[7][1]=Interval(NEG_INFINITY,2);
+	boxes[8][0]=Interval::ZERO;         // 0*oo
+	boxes[8][1]=Interval(1,POS_INFINITY);
+
+	IntervalVector res=e.eval(boxes);
+	CPPUNIT_ASSERT(res.size()==n);
+	for (int i=0; i<n; i++) {
+		CPPUNIT_ASSERT(res[i]==f.eval(boxes[i]));
+	}
+	CPPUNIT_ASSERT(res[3].is_empty());
+	CPPUNIT_ASSERT(res[5].is_empty());
+}
+
+void TestEval::batch02() {
+	const ExprSymbol& x = ExprSymbol::new_("x",Dim::col_vec(3));
+	const ExprSymbol& y = ExprSymbol::new_("y");
+	Function f(x,y,Return(x[0]*x[1]-y,sqr(x[2])+cos(y),-x[1]));
+
+	BatchEval e(f);
+	CPPUNIT_ASSERT(e.vectorized());
+
+	int n=10;
+	IntervalMatrix boxes(n,4);
+	for (int i=0; i<n; i++)
+		for (int j=0; j<4; j++)
+			boxes[i][j]=Interval(i-j,i+j*0.5);
+
+	IntervalMatrix res=e.eval_vector(boxes);
+	CPPUNIT_ASSERT(res.nb_rows()==n);
+	CPPUNIT_ASSERT(res.nb_cols()==3);
+	for (int i=0; i<n; i++) {
+		CPPUNIT_ASSERT(res[i]==f.eval_vector(boxes[i]));
+	}
+}
+
+void TestEval::batch03() {
+	// function calls and vector operations are not supported in batch mode
+	Function g("x","y","x*y");
+	const ExprSymbol& x = ExprSymbol::new_("x",Dim::col_vec(2));
+	Function f(x,g(x[0],x[1])+(x+x)[1]);
+
+	BatchEval e(f);
+	CPPUNIT_ASSERT(!e.vectorized());
+
+	IntervalMatrix boxes(3,2);
+	for (int i=0; i<3; i++) {
+		boxes[i][0]=Interval(i,i+1);
+		boxes[i][1]=Interval(-i,1);
+	}
+
+	IntervalVector res=e.eval(boxes);
+	for (int i=0; i<3; i++)
+		CPPUNIT_ASSERT(res[i]==f.eval(boxes[i]));
+}
+
+void TestEval::batch04() {
+	// operations performed box by box (division, sqrt, power) after
+	// SIMD operations: the rounding mode must be the one of the interval library
+	const ExprSymbol& x = ExprSymbol::new_("x");
+	const ExprSymbol& y = ExprSymbol::new_("y");
+	Function f(x,y,sqrt(x*y)/(x+y)+pow(x-y,3)*exp(y));
+
+	BatchEval e(f);
+
+	int n=1000;
+	IntervalMatrix boxes(n,2);
+	for (int i=0; i<n; i++) {
+		boxes[i][0]=Interval(0.1*(i+1));
+		boxes[i][1]=Interval(0.3/(i+1));
+	}
+
+	IntervalVector res=e.eval(boxes);
+	for (int i=0; i<n; i++) {
+		CPPUNIT_ASSERT(res[i]==f.eval(boxes[i]));
+	}
+}
+
 }
@@ -35,6 +35,10 @@ public:
 	CPPUNIT_TEST(issue242);
 	CPPUNIT_TEST(eval_components01);
 	CPPUNIT_TEST(eval_components02);
+	CPPUNIT_TEST(batch01);
+	CPPUNIT_TEST(batch02);
+	CPPUNIT_TEST(batch03);
+	CPPUNIT_TEST(batch04);
 
 	CPPUNIT_TEST_SUITE_END();
 
@@ -52,6 +56,11 @@ public:
 	void eval_components01();
 	void eval_components02();
 
+	void batch01();
+	void batch02();
+	void batch03();
+	void batch04();
+
 private:
 	void check_deco(Function& f, const ExprNode& e);
 };
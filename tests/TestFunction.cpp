@@ -495,4 +495,138 @@ void TestFunction::issue43_bis() {
 	Function g(x,y,f(x,y));
 }
 
+void TestFunction::context01() {
+	Variable x("x"),y("y");
+	Function f(x,y,Return(sin(x*y)+sqr(x),x-y,exp(y)));
+
+	int n=100;
+	vector<IntervalVector> box;
+	vector<IntervalVector> eval(n,IntervalVector(3));
+	vector<IntervalMatrix> J(n,IntervalMatrix(3,2));
+	vector<IntervalVector> proj;
+
+	for (int i=0; i<n; i++) {
+		box.push_back(IntervalVector(2,Interval(-1-i*0.01,1+i*0.02)));
+		proj.push_back(box[i]);
+	}
+
+#pragma omp parallel for num_threads(4)
+	for (int i=0; i<n; i++) {
+		eval[i]=f.eval_vector(box[i]);
+		f.jacobian(box[i],J[i]);
+		f[0].backward(Interval(0,0.5),proj[i]);
+	}
+
+	for (int i=0; i<n; i++) {
+		CPPUNIT_ASSERT(eval[i]==f.eval_vector(box[i]));
+		CPPUNIT_ASSERT(J[i]==f.jacobian(box[i]));
+		IntervalVector p=box[i];
+		f[0].backward(Interval(0,0.5),p);
+		CPPUNIT_ASSERT(proj[i]==p);
+	}
+
+	CPPUNIT_ASSERT(&f.context()==&f.context());
+	CPPUNIT_ASSERT(&f.basic_evaluator()==&f.context().eval);
+}
+
+void TestFunction::cache01() {
+	Variable x,y,z;
+	Function f(x,y,z,Return(sqr(x)*y,x+z,y*z));
+	const EvalCache& cache=f.context().cache();
+
+	double _box[][2]={{1,2},{-1,3},{0,1}};
+	IntervalVector box(3,_box);
+	IntervalVector mid=box.mid();
+
+	IntervalMatrix J(3,3);
+	f.cached_jacobian(box,J);
+	unsigned long misses=cache.nb_misses();
+	unsigned long hits=cache.nb_hits();
+
+	// same box (another object)
+	IntervalVector box2(box);
+	IntervalMatrix J1(3,3);
+	f.cached_jacobian(box2,J1);
+	CPPUNIT_ASSERT(J1==J);
+	CPPUNIT_ASSERT(cache.nb_hits()==hits+1);
+
+	// the midpoint has its own entry: the box entry is kept
+	IntervalMatrix Jmid(3,3);
+	f.cached_jacobian(mid,Jmid);
+	f.cached_jacobian(box,J1);
+	CPPUNIT_ASSERT(J1==J);
+	CPPUNIT_ASSERT(cache.nb_misses()==misses+1);
+	CPPUNIT_ASSERT(cache.nb_hits()==hits+2);
+
+	// components
+	BitSet c=BitSet::empty(3);
+	c.add(0); c.add(2);
+	IntervalMatrix Jc(2,3);
+	f.cached_jacobian(box,Jc,c);
+	CPPUNIT_ASSERT(Jc.nb_rows()==2);
+	CPPUNIT_ASSERT(Jc[0]==J[0]);
+	CPPUNIT_ASSERT(Jc[1]==J[2]);
+	CPPUNIT_ASSERT(cache.nb_misses()==misses+1);
+
+	// image: only the missing components are calculated
+	IntervalVector y1=f.cached_eval_vector(mid,c);
+	CPPUNIT_ASSERT(cache.nb_misses()==misses+2);
+	IntervalVector y2=f.cached_eval_vector(mid);
+	CPPUNIT_ASSERT(cache.nb_misses()==misses+3);
+	CPPUNIT_ASSERT(f.cached_eval_vector(mid)==y2);
+	CPPUNIT_ASSERT(cache.nb_misses()==misses+3);
+	CPPUNIT_ASSERT(y1[0]==y2[0] && y1[1]==y2[2]);
+
+	// a different box
+	box[0]=Interval(1,1.5);
+	IntervalMatrix J2(3,3);
+	f.cached_jacobian(box,J2);
+	CPPUNIT_ASSERT(cache.nb_misses()==misses+4);
+	CPPUNIT_ASSERT(J2[0][0]==Interval(-3,9)); // 2*x*y with x in [1,1.5] and y in [-1,3]
+	f.cached_jacobian(mid,J1);
+	CPPUNIT_ASSERT(J1==Jmid);
+
+	// the cache is not used by the other evaluations
+	CPPUNIT_ASSERT(f.jacobian(box)==J2);
+	CPPUNIT_ASSERT(f.eval_vector(mid)==y2);
+	CPPUNIT_ASSERT(cache.nb_misses()==misses+4);
+	CPPUNIT_ASSERT(cache.nb_hits()==hits+5);
+}
+
+void TestFunction::cache02() {
+	Variable x,y;
+	Function f(x,y,Return(sqrt(x),y+1));
+	const EvalCache& cache=f.context().cache();
+
+	double _box[][2]={{-2,-1},{0,1}};
+	IntervalVector box(2,_box);
+	BitSet c=BitSet::singleton(2,1);
+
+	// outside of the definition domain: empty results are not cached
+	IntervalMatrix J(2,2);
+	f.cached_jacobian(box,J);
+	CPPUNIT_ASSERT(J.is_empty());
+	CPPUNIT_ASSERT(f.cached_eval_vector(box).is_empty());
+	unsigned long misses=cache.nb_misses();
+
+	// the second row is still calculated (as in a direct evaluation)
+	IntervalMatrix Jc(1,2);
+	f.cached_jacobian(box,Jc,c);
+	CPPUNIT_ASSERT(Jc==f.jacobian(box,c));
+	CPPUNIT_ASSERT(Jc[0][0]==Interval::ZERO && Jc[0][1]==Interval::ONE);
+	CPPUNIT_ASSERT(f.cached_eval_vector(box,c)==f.eval_vector(box,c));
+	CPPUNIT_ASSERT(f.cached_eval_vector(box,c)[0]==Interval(1,2));
+	CPPUNIT_ASSERT(cache.nb_misses()==misses+2);
+
+	f.cached_jacobian(box,J);
+	CPPUNIT_ASSERT(J.is_empty());
+	CPPUNIT_ASSERT(cache.nb_misses()==misses+3);
+
+	// the cache is not used on empty boxes
+	box.set_empty();
+	f.cached_jacobian(box,J);
+	CPPUNIT_ASSERT(J.is_empty());
+	CPPUNIT_ASSERT(cache.nb_misses()==misses+3);
+}
+
 } // end namespace
@@ -88,6 +88,9 @@ public:
 	CPPUNIT_TEST(minibex01);
 	CPPUNIT_TEST(minibex02);
 	CPPUNIT_TEST(minibex03);
+	CPPUNIT_TEST(context01);
+	CPPUNIT_TEST(cache01);
+	CPPUNIT_TEST(cache02);
 	CPPUNIT_TEST_SUITE_END();
 
 	void parser_symbol_01();
@@ -145,6 +148,13 @@ public:
 	void minibex01();
 	void minibex02();
 	void minibex03();
+
+	// concurrent evaluations (evaluation contexts)
+	void context01();
+
+	// cache of the image and the Jacobian matrix
+	void cache01();
+	void cache02();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestFunction);
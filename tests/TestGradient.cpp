@@ -665,5 +665,154 @@ void TestGradient::jacobian_components02() {
 
 }
 
-} // end namespace
+void TestGradient::sparse_jacobian01() {
+	Ponts30 p30;
+	const Function& f=*p30.f;
+	IntervalVector box(30,BOX1);
+
+	const std::vector<std::vector<int> >& pattern=f.jacobian_pattern();
+	CPPUNIT_ASSERT(pattern[0].size()==4);
+	CPPUNIT_ASSERT(pattern[0][0]==0 && pattern[0][1]==1 && pattern[0][2]==2 && pattern[0][3]==3);
+
+	SparseIntervalMatrix J=f.sparse_jacobian(box);
+	CPPUNIT_ASSERT(J.nb_nonzeros()<30*30/4);
+	CPPUNIT_ASSERT(J.dense()==f.jacobian(box));
+}
+
+void TestGradient::sparse_jacobian02() {
+	const ExprSymbol& x = ExprSymbol::new_("x",Dim::col_vec(3));
+	const ExprSymbol& y = ExprSymbol::new_("y",Dim::col_vec(3));
+	const ExprSymbol& z = ExprSymbol::new_("z",Dim::col_vec(3));
+	Function f(x,y,z,Return(x+y,x+z,y+z));
+	IntervalVector box(9);
+	for (int i=0; i<9; i++) box[i]=Interval(i,i);
+
+	SparseIntervalMatrix J=f.sparse_jacobian(box);
+	CPPUNIT_ASSERT(J.nb_nonzeros()==18);
+	CPPUNIT_ASSERT(J.dense()==f.jacobian(box));
+}
+
+void TestGradient::sparse_jacobian03() {
+	Variable x(2),y(2);
+	Function f(x,y,Return(sqr(x[0])*y,x[1]*y));
+	IntervalVector box(4);
+	box[0]=Interval(1,2);
+	box[1]=Interval(-1,3);
+	box[2]=Interval(0,1);
+	box[3]=Interval(2,5);
+
+	SparseIntervalMatrix J=f.sparse_jacobian(box);
+	CPPUNIT_ASSERT(J.nb_nonzeros()==8);
+	CPPUNIT_ASSERT(J.find(0,1)==-1);
+	CPPUNIT_ASSERT(J.dense()==f.jacobian(box));
+
+	box[0]=Interval::EMPTY_SET;
+	box[1]=Interval::EMPTY_SET;
+	f.jacobian(box,J);
+	CPPUNIT_ASSERT(J.is_empty());
+}
+
+void TestGradient::forward01() {
+	const ExprSymbol& x = ExprSymbol::new_("x");
+	const ExprSymbol& y = ExprSymbol::new_("y");
+	const ExprSymbol& z = ExprSymbol::new_("z");
+	const ExprNode& e=sqr(x)+y*z;
+
+	Function f(x,y,z,Return(e*x,exp(e)-y,e/z+sin(x)));
+	Gradient& grad=f.deriv_calculator();
+
+	IntervalVector box(3);
+	box[0]=Interval(1,2);
+	box[1]=Interval(-1,1);
+	box[2]=Interval(2,3);
+	IntervalVector pt=box.mid();
+
+	IntervalMatrix Jr(3,3), Jf(3,3), Jr_pt(3,3), Jf_pt(3,3);
 
+	grad.set_mode(Gradient::REVERSE);
+	CPPUNIT_ASSERT(grad.jacobian_mode()==Gradient::REVERSE);
+	grad.jacobian(box,Jr);
+	grad.jacobian(pt,Jr_pt);
+
+	grad.set_mode(Gradient::FORWARD);
+	CPPUNIT_ASSERT(grad.jacobian_mode()==Gradient::FORWARD);
+	grad.jacobian(box,Jf);
+	grad.jacobian(pt,Jf_pt);
+
+	CPPUNIT_ASSERT(almost_eq(Jf_pt,Jr_pt,1e-10));
+	CPPUNIT_ASSERT(Jr_pt.is_subset(Jf));
+	CPPUNIT_ASSERT(almost_eq(Jf,Jr,1e-10));
+
+	// some components only
+	BitSet components=BitSet::empty(3);
+	components.add(0);
+	components.add(2);
+	IntervalMatrix J2(2,3);
+	grad.jacobian(pt,J2,components);
+	CPPUNIT_ASSERT(J2[0]==Jf_pt[0]);
+	CPPUNIT_ASSERT(J2[1]==Jf_pt[2]);
+
+	// outside the definition domain
+	box[2]=Interval::ZERO;
+	grad.jacobian(box,Jf);
+	CPPUNIT_ASSERT(Jf.is_empty());
+
+	grad.set_mode(Gradient::AUTO);
+}
+
+void TestGradient::forward02() {
+	int n=20;
+	Variable x(n);
+	Array<const ExprNode> c(n-1);
+	for (int i=0; i<n-1; i++)
+		c.set_ref(i, i==0? sqr(x[0])-x[1] : sqr(x[i])*cos(x[i-1])-x[i+1]);
+
+	Function f(x,ExprVector::new_(c,false));
+	Gradient& grad=f.deriv_calculator();
+
+	// each variable appears in at most 3 consecutive components:
+	// the forward mode requires 3 colors instead of n-1 backward sweeps
+	CPPUNIT_ASSERT(grad.jacobian_mode()==Gradient::FORWARD);
+
+	IntervalVector box(n,Interval(-1,2));
+	SparseIntervalMatrix Jf=f.sparse_jacobian(box);
+	IntervalMatrix Jf_dense(n-1,n);
+	grad.jacobian(box,Jf_dense);
+
+	grad.set_mode(Gradient::REVERSE);
+	IntervalMatrix Jr(n-1,n);
+	grad.jacobian(box,Jr);
+
+	CPPUNIT_ASSERT(Jf_dense==Jr);
+	CPPUNIT_ASSERT(Jf.dense()==Jr);
+	CPPUNIT_ASSERT(Jf.nb_nonzeros()==3*(n-1)-1);
+
+	grad.set_mode(Gradient::AUTO);
+}
+
+void TestGradient::forward03() {
+	Variable x(2);
+	IntervalMatrix A(2,2);
+	A[0][0]=1; A[0][1]=2;
+	A[1][0]=3; A[1][1]=4;
+
+	Function f(x,Return((A*x)[0]*x[1],sqr(x[0])));
+	Gradient& grad=f.deriv_calculator();
+
+	grad.set_mode(Gradient::FORWARD);
+	CPPUNIT_ASSERT(grad.jacobian_mode()==Gradient::REVERSE);
+
+	IntervalVector box(2);
+	box[0]=Interval(1,1);
+	box[1]=Interval(2,2);
+	IntervalMatrix J(2,2);
+	grad.jacobian(box,J);
+	CPPUNIT_ASSERT(J[0][0]==2);
+	CPPUNIT_ASSERT(J[0][1]==9);
+	CPPUNIT_ASSERT(J[1][0]==2);
+	CPPUNIT_ASSERT(J[1][1]==0);
+
+	grad.set_mode(Gradient::AUTO);
+}
+
+} // end namespace
@@ -45,6 +45,12 @@ public:
 	CPPUNIT_TEST(mulVM02);
 	CPPUNIT_TEST(jacobian_components01);
 	CPPUNIT_TEST(jacobian_components02);
+	CPPUNIT_TEST(sparse_jacobian01);
+	CPPUNIT_TEST(sparse_jacobian02);
+	CPPUNIT_TEST(sparse_jacobian03);
+	CPPUNIT_TEST(forward01);
+	CPPUNIT_TEST(forward02);
+	CPPUNIT_TEST(forward03);
 	CPPUNIT_TEST_SUITE_END();
 
 	void deco01();
@@ -70,6 +76,20 @@ public:
 
 	void jacobian_components01();
 	void jacobian_components02();
+
+	// vector of expressions
+	void sparse_jacobian01();
+	// linear components
+	void sparse_jacobian02();
+	// vector-valued arguments
+	void sparse_jacobian03();
+
+	// forward mode with shared subexpressions
+	void forward01();
+	// forward mode on a sparse system (coloring)
+	void forward02();
+	// non-scalar operations (reverse mode)
+	void forward03();
 private:
 	void check_deco(const ExprNode& e);
 };
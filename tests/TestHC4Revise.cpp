@@ -15,6 +15,8 @@
 #include "ibex_NumConstraint.h"
 #include "ibex_HC4Revise.h"
 
+#include <cstdlib>
+
 using namespace std;
 
 namespace ibex {
@@ -131,5 +133,64 @@ void TestHC4Revise::dist02() {
 	check(box, boxR);
 }
 
-} // end namespace
+void TestHC4Revise::incr01() {
+	const ExprSymbol& x = ExprSymbol::new_("x",Dim::col_vec(4));
+	const ExprSymbol& A = ExprSymbol::new_("A",Dim::matrix(2,2));
+	const ExprSymbol& z = ExprSymbol::new_("z");
+
+	// shared subexpressions
+	const ExprNode& e1=sqr(x[0]-x[1]);
+	const ExprNode& e2=exp(A[1][0]*x[2])+e1;
+	Function f(x,A,z,e1*e2+A[0][1]*sin(e2)-z*x[3]);
+
+	Domain y(Dim::scalar());
+	y.i()=Interval(-1,1);
+
+	srand(1);
+	IntervalVector box(9,Interval(-1,1));
+	for (int k=0; k<200; k++) {
+		// modify one or two components
+		for (int l=0; l<1+k%2; l++) {
+			int i=rand()%9;
+			double a=-2+4*((double) rand())/RAND_MAX;
+			box[i]=Interval(a,a+((double) rand())/RAND_MAX);
+		}
+
+		IntervalVector box1(box);
+		IntervalVector box2(box);
+		bool inner1=f.hc4revise().proj(y,box1,true);
+		bool inner2=f.hc4revise().proj(y,box2,false);
+		CPPUNIT_ASSERT(inner1==inner2);
+		CPPUNIT_ASSERT(box1==box2 || (box1.is_empty() && box2.is_empty()));
+
+		// sometimes, continue with the contracted box
+		if (k%3==0 && !box1.is_empty()) box=box1;
+	}
+}
+
+void TestHC4Revise::incr02() {
+	Variable x,y;
+	Function f(x,y,sqrt(x)+y);
 
+	Domain zero(Dim::scalar());
+	zero.i()=Interval(0,0);
+
+	double _box[][2] = { {0,4}, {-10,10} };
+	IntervalVector box(2,_box);
+	IntervalVector box1(box);
+	f.hc4revise().proj(zero,box1,true);
+	CPPUNIT_ASSERT(box1[1]==Interval(-2,0));
+
+	// outside the definition domain
+	box[0]=Interval(-2,-1);
+	IntervalVector box2(box);
+	f.hc4revise().proj(zero,box2,true);
+	CPPUNIT_ASSERT(box2.is_empty());
+
+	box[0]=Interval(1,9);
+	IntervalVector box3(box);
+	f.hc4revise().proj(zero,box3,true);
+	CPPUNIT_ASSERT(box3[1]==Interval(-3,-1));
+}
+
+} // end namespace
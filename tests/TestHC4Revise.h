@@ -33,6 +33,8 @@ public:
 		CPPUNIT_TEST(min01);
 		CPPUNIT_TEST(dist01);
 		CPPUNIT_TEST(dist02);
+		CPPUNIT_TEST(incr01);
+		CPPUNIT_TEST(incr02);
 	CPPUNIT_TEST_SUITE_END();
 	void id01();
 	void add01();
@@ -45,6 +47,9 @@ public:
 
 	void dist01();
 	void dist02();
+
+	void incr01();
+	void incr02();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestHC4Revise);
@@ -0,0 +1,138 @@
+//============================================================================
+//                                  I B E X
+// File        : TestHessian.cpp
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#include "TestHessian.h"
+#include "ibex_Function.h"
+
+using namespace std;
+
+namespace ibex {
+
+void TestHessian::poly01() {
+	Variable x,y;
+	// f(x,y)=x^2*y+sin(x)*y^3
+	Function f(x,y,sqr(x)*y+sin(x)*pow(y,3));
+
+	double _x=0.5, _y=-2;
+	IntervalVector pt(2);
+	pt[0]=_x;
+	pt[1]=_y;
+
+	IntervalMatrix H=f.hessian(pt);
+	CPPUNIT_ASSERT(almost_eq(H[0][0], 2*_y-::sin(_x)*_y*_y*_y, 1e-12));
+	CPPUNIT_ASSERT(almost_eq(H[0][1], 2*_x+3*::cos(_x)*_y*_y, 1e-12));
+	CPPUNIT_ASSERT(almost_eq(H[1][1], 6*::sin(_x)*_y, 1e-12));
+	CPPUNIT_ASSERT(H[1][0]==H[0][1]);
+
+	IntervalVector box(2);
+	box[0]=Interval(0,1);
+	box[1]=Interval(-3,-1);
+	IntervalMatrix Hbox=f.hessian(box);
+	CPPUNIT_ASSERT(H.is_subset(Hbox));
+}
+
+void TestHessian::index01() {
+	Variable x(4);
+	// f(x)=x0*x1*x2+x0^2 (x3 is not used)
+	Function f(x,x[0]*x[1]*x[2]+x[0]*x[0]);
+
+	IntervalVector box(4);
+	box[0]=Interval(1,2);
+	box[1]=Interval(3,4);
+	box[2]=Interval(-1,0);
+	box[3]=Interval(5,6);
+
+	IntervalMatrix H=f.hessian(box);
+
+	IntervalMatrix expected(4,4,Interval::ZERO);
+	expected[0][0]=2;
+	expected[0][1]=expected[1][0]=box[2];
+	expected[0][2]=expected[2][0]=box[1];
+	expected[1][2]=expected[2][1]=box[0];
+
+	CPPUNIT_ASSERT(H==expected);
+}
+
+void TestHessian::symbolic01() {
+	Variable x,y,z;
+	Function f(x,y,z,exp(x*y)/(1+sqr(z))+atan2(x,z)+sqrt(1+sqr(y))*log(2+x)-cosh(z)*tanh(y));
+
+	IntervalVector box(3);
+	box[0]=Interval(0.5,0.6);
+	box[1]=Interval(-0.2,0.1);
+	box[2]=Interval(1,1.2);
+
+	IntervalVector pt=box.mid();
+
+	IntervalMatrix H=f.hessian(pt);
+	IntervalMatrix Hs=f.diff().jacobian(pt);
+	CPPUNIT_ASSERT(almost_eq(H,Hs,1e-10));
+
+	IntervalMatrix Hbox=f.hessian(box);
+	CPPUNIT_ASSERT(H.is_subset(Hbox));
+	CPPUNIT_ASSERT(Hs.is_subset(Hbox));
+}
+
+void TestHessian::vector_op01() {
+	Variable x(2);
+	IntervalMatrix A(2,2);
+	A[0][0]=1; A[0][1]=2;
+	A[1][0]=3; A[1][1]=4;
+
+	// f(x)=x^T*A*x
+	Function f(x,transpose(x)*(A*x));
+
+	IntervalMatrix H=f.hessian(IntervalVector(2,Interval(-1,1)));
+	CPPUNIT_ASSERT(H==A+A.transpose());
+}
+
+void TestHessian::point01() {
+	Variable x,y;
+	Function f(x,y,sqr(x)*y+exp(y));
+
+	Vector pt(2);
+	pt[0]=1;
+	pt[1]=0;
+	Matrix H=f.hessian(pt);
+	CPPUNIT_ASSERT(::fabs(H[0][0]-0)<1e-12);
+	CPPUNIT_ASSERT(::fabs(H[0][1]-2)<1e-12);
+	CPPUNIT_ASSERT(::fabs(H[1][0]-2)<1e-12);
+	CPPUNIT_ASSERT(::fabs(H[1][1]-1)<1e-12);
+}
+
+void TestHessian::nondiff01() {
+	Variable x,y;
+	Function f(x,y,abs(x)*y);
+
+	IntervalVector box(2);
+	box[0]=Interval(1,2);
+	box[1]=Interval(3,4);
+	IntervalMatrix H=f.hessian(box);
+	CPPUNIT_ASSERT(H[0][0]==Interval::ZERO);
+	CPPUNIT_ASSERT(H[0][1]==Interval::ONE);
+	CPPUNIT_ASSERT(H[1][1]==Interval::ZERO);
+
+	box[0]=Interval(-1,1);
+	H=f.hessian(box);
+	CPPUNIT_ASSERT(H[0][0]==Interval::ALL_REALS);
+	CPPUNIT_ASSERT(H[0][1]==Interval(-1,1));
+	CPPUNIT_ASSERT(H[1][1]==Interval::ZERO);
+}
+
+void TestHessian::empty01() {
+	Variable x,y;
+	Function f(x,y,sqrt(x)*y);
+
+	IntervalVector box(2);
+	box[0]=Interval(-2,-1);
+	box[1]=Interval(3,4);
+	CPPUNIT_ASSERT(f.hessian(box).is_empty());
+}
+
+} // end namespace
@@ -0,0 +1,58 @@
+//============================================================================
+//                                  I B E X
+// File        : TestHessian.h
+// Author      : agent
+// Copyright   : IMT Atlantique (France)
+// License     : See the LICENSE file
+// Created     : Oct 18, 2026
+//============================================================================
+
+#ifndef __TEST_HESSIAN_H__
+#define __TEST_HESSIAN_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "utils.h"
+
+namespace ibex {
+
+class TestHessian : public CppUnit::TestFixture {
+public:
+
+	CPPUNIT_TEST_SUITE(TestHessian);
+		CPPUNIT_TEST(poly01);
+		CPPUNIT_TEST(index01);
+		CPPUNIT_TEST(symbolic01);
+		CPPUNIT_TEST(vector_op01);
+		CPPUNIT_TEST(point01);
+		CPPUNIT_TEST(nondiff01);
+		CPPUNIT_TEST(empty01);
+	CPPUNIT_TEST_SUITE_END();
+
+	// polynomial and trigonometric function
+	void poly01();
+
+	// indexed variables (the same variable indexed twice, unused variable)
+	void index01();
+
+	// comparison with the Jacobian matrix of the symbolic gradient
+	void symbolic01();
+
+	// vector operations (symbolic gradient)
+	void vector_op01();
+
+	// point Hessian
+	void point01();
+
+	// non-differentiable functions
+	void nondiff01();
+
+	// box outside the definition domain
+	void empty01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestHessian);
+
+} // end namespace
+
+#endif // __TEST_HESSIAN_H__
@@ -13,6 +13,8 @@
 #include "ibex_IntervalMatrix.h"
 #include "ibex_Random.h"
 #include "utils.h"
+#include "ibex_PackedInterval.h"
+#include "ibex_SparseIntervalMatrix.h"
 
 using namespace std;
 
@@ -437,3 +439,139 @@ void TestIntervalMatrix::diam01() {
 	CPPUNIT_ASSERT(R[1][0]==M[1][0].diam());
 	CPPUNIT_ASSERT(R[1][1]==M[1][1].diam());
 }
+
+namespace {
+
+IntervalMatrix rand_matrix(int m, int n) {
+	IntervalMatrix M(m,n);
+	for (int i=0; i<m; i++)
+		for (int j=0; j<n; j++) {
+			double a=RNG::rand(-10,10);
+			M[i][j]=Interval(a,a+RNG::rand(0,1));
+		}
+	return M;
+}
+
+// product with the same order of summation as the generic one
+template<class M1, class M2>
+IntervalMatrix naive_mul(const M1& m1, const M2& m2) {
+	IntervalMatrix m3(m1.nb_rows(),m2.nb_cols());
+	for (int i=0; i<m1.nb_rows(); i++)
+		for (int j=0; j<m2.nb_cols(); j++) {
+			m3[i][j]=0;
+			for (int k=0; k<m1.nb_cols(); k++)
+				m3[i][j]+=m1[i][k]*m2[k][j];
+		}
+	return m3;
+}
+
+template<class M>
+IntervalVector naive_mul(const M& m, const IntervalVector& x) {
+	IntervalVector y(m.nb_rows());
+	for (int i=0; i<m.nb_rows(); i++) {
+		y[i]=0;
+		for (int j=0; j<m.nb_cols(); j++)
+			y[i]+=m[i][j]*x[j];
+	}
+	return y;
+}
+
+}
+
+// Matrix x IntervalMatrix
+void TestIntervalMatrix::packed01() {
+	RNG::srand(1);
+	Matrix C=2*Matrix::rand(12)-Matrix::ones(12);
+	IntervalMatrix A=rand_matrix(12,12);
+	CPPUNIT_ASSERT(C*A==naive_mul(C,A));
+	CPPUNIT_ASSERT((C*PackedIntervalMatrix(A)).unpack()==naive_mul(C,A));
+}
+
+// IntervalMatrix x IntervalMatrix
+void TestIntervalMatrix::packed02() {
+	RNG::srand(2);
+	IntervalMatrix A=rand_matrix(9,10);
+	IntervalMatrix B=rand_matrix(10,11);
+	CPPUNIT_ASSERT(A*B==naive_mul(A,B));
+}
+
+// matrix x vector
+void TestIntervalMatrix::packed03() {
+	RNG::srand(3);
+	Matrix C=2*Matrix::rand(10)-Matrix::ones(10);
+	IntervalMatrix A=rand_matrix(10,10);
+	IntervalVector x=rand_matrix(1,10)[0];
+	CPPUNIT_ASSERT(C*x==naive_mul(C,x));
+	CPPUNIT_ASSERT(A*x==naive_mul(A,x));
+
+	PackedIntervalMatrix PA(A);
+	PackedIntervalVector px(x);
+	CPPUNIT_ASSERT((PA*px).unpack()==naive_mul(A,x));
+
+}
+
+// unbounded and empty operands
+void TestIntervalMatrix::packed04() {
+	RNG::srand(4);
+	IntervalMatrix A=rand_matrix(8,8);
+	IntervalVector x=rand_matrix(1,8)[0];
+	x[2]=Interval::POS_REALS;
+	A[3][2]=0;
+	CPPUNIT_ASSERT(A*x==naive_mul(A,x));
+	CPPUNIT_ASSERT((PackedIntervalMatrix(A)*PackedIntervalVector(x)).unpack()==naive_mul(A,x));
+
+	x.set_empty();
+	CPPUNIT_ASSERT((A*x).is_empty());
+	CPPUNIT_ASSERT((PackedIntervalMatrix(A)*PackedIntervalVector(x)).is_empty());
+}
+
+void TestIntervalMatrix::sparse01() {
+	RNG::srand(5);
+	IntervalMatrix A=rand_matrix(10,12);
+	for (int i=0; i<10; i++)
+		for (int j=0; j<12; j++)
+			if ((i+j)%3!=0) A[i][j]=0;
+
+	SparseIntervalMatrix S(A);
+	CPPUNIT_ASSERT(S.nb_rows()==10);
+	CPPUNIT_ASSERT(S.nb_cols()==12);
+	CPPUNIT_ASSERT(S.nb_nonzeros()==40);
+	CPPUNIT_ASSERT(S.dense()==A);
+	CPPUNIT_ASSERT(S.find(0,0)==0);
+	CPPUNIT_ASSERT(S.find(0,1)==-1);
+	CPPUNIT_ASSERT(S(2,1)==A[2][1]);
+	CPPUNIT_ASSERT(S(2,2)==Interval::ZERO);
+
+	IntervalVector x=rand_matrix(1,12)[0];
+	CPPUNIT_ASSERT(S*x==naive_mul(A,x));
+
+	x.set_empty();
+	CPPUNIT_ASSERT((S*x).is_empty());
+}
+
+void TestIntervalMatrix::sparse02() {
+	std::vector<std::vector<int> > pattern(3);
+	pattern[0].push_back(0); pattern[0].push_back(2);
+	pattern[2].push_back(1);
+
+	SparseIntervalMatrix S(3,3,pattern);
+	CPPUNIT_ASSERT(S.nb_nonzeros()==3);
+	CPPUNIT_ASSERT(S.row_begin(1)==S.row_end(1));
+	CPPUNIT_ASSERT(S.dense()==Matrix::zeros(3));
+
+	S.val(S.find(0,2))=Interval(1,2);
+	S.val(S.find(2,1))=Interval(-1,1);
+
+	SparseIntervalMatrix S2(S);
+	CPPUNIT_ASSERT(S2(0,2)==Interval(1,2));
+	CPPUNIT_ASSERT(S2(2,1)==Interval(-1,1));
+
+	S2.set_empty();
+	CPPUNIT_ASSERT(S2.dense().is_empty());
+	S2=S;
+	CPPUNIT_ASSERT(!S2.is_empty());
+	CPPUNIT_ASSERT(S2.dense()==S.dense());
+
+	S.clear();
+	CPPUNIT_ASSERT(S.dense()==Matrix::zeros(3));
+}
@@ -76,6 +76,14 @@ public:
 	CPPUNIT_TEST(rad01);
 	CPPUNIT_TEST(diam01);
 
+	CPPUNIT_TEST(packed01);
+	CPPUNIT_TEST(packed02);
+	CPPUNIT_TEST(packed03);
+	CPPUNIT_TEST(packed04);
+
+	CPPUNIT_TEST(sparse01);
+	CPPUNIT_TEST(sparse02);
+
 	CPPUNIT_TEST_SUITE_END();
 
 	// test:
@@ -172,6 +180,16 @@ public:
 	void put01();
 	void rad01();
 	void diam01();
+
+	// test: products with packed bounds
+	void packed01();
+	void packed02();
+	void packed03();
+	void packed04();
+
+	// test: sparse matrices
+	void sparse01();
+	void sparse02();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestIntervalMatrix);
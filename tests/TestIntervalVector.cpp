@@ -12,6 +12,8 @@
 #include "TestIntervalVector.h"
 #include "ibex_Interval.h"
 #include "utils.h"
+#include "ibex_PackedInterval.h"
+#include "ibex_Random.h"
 
 using namespace std;
 
@@ -1057,3 +1059,78 @@ void TestIntervalVector::random02() {
 
 	CPPUNIT_ASSERT(b==r);
 }
+
+// diameters and inclusion
+void TestIntervalVector::packed01() {
+	RNG::srand(1);
+	IntervalVector x(20);
+	for (int i=0; i<20; i++) {
+		double a=RNG::rand(-10,10);
+		x[i]=Interval(a,a+RNG::rand(0,1));
+	}
+	PackedIntervalVector px(x);
+
+	CPPUNIT_ASSERT(px.unpack()==x);
+	CPPUNIT_ASSERT(px.diam()==x.diam());
+	CPPUNIT_ASSERT(px.max_diam()==x.max_diam());
+	CPPUNIT_ASSERT(px.min_diam()==x.min_diam());
+	CPPUNIT_ASSERT(px.extr_diam_index(true)==x.extr_diam_index(true));
+	CPPUNIT_ASSERT(px.extr_diam_index(false)==x.extr_diam_index(false));
+
+	IntervalVector y=x;
+	y[7]=Interval(y[7].lb(),y[7].mid());
+	PackedIntervalVector py(y);
+	CPPUNIT_ASSERT(py.is_subset(px));
+	CPPUNIT_ASSERT(!px.is_subset(py));
+
+	py.set_empty();
+	CPPUNIT_ASSERT(py.is_subset(px));
+	CPPUNIT_ASSERT(!px.is_subset(py));
+}
+
+// unbounded components
+void TestIntervalVector::packed02() {
+	double _x[][2]={{0,1},{NEG_INFINITY,2},{-1,POS_INFINITY},{3,3}};
+	IntervalVector x(4,_x);
+	PackedIntervalVector px(x);
+
+	CPPUNIT_ASSERT(px.is_unbounded());
+	CPPUNIT_ASSERT(px.max_diam()==x.max_diam());
+	CPPUNIT_ASSERT(px.min_diam()==x.min_diam());
+	CPPUNIT_ASSERT(px.extr_diam_index(true)==x.extr_diam_index(true));
+	CPPUNIT_ASSERT(px.extr_diam_index(false)==x.extr_diam_index(false));
+
+	Vector v(4,1.0);
+	v[3]=POS_INFINITY;
+	CPPUNIT_ASSERT((px+=v).is_empty());
+}
+
+// additions
+void TestIntervalVector::packed03() {
+	RNG::srand(2);
+	IntervalVector x(15), y(15);
+	Vector v(15);
+	for (int i=0; i<15; i++) {
+		double a=RNG::rand(-10,10);
+		double b=RNG::rand(-1e-3,1e-3);
+		x[i]=Interval(a,a+RNG::rand(0,1));
+		y[i]=Interval(b,b+RNG::rand(0,1e-3));
+		v[i]=RNG::rand(-1,1)/3;
+	}
+
+	PackedIntervalVector px(x);
+	px+=PackedIntervalVector(y);
+	CPPUNIT_ASSERT(px.unpack()==x+y);
+
+	px=x;
+	px-=PackedIntervalVector(y);
+	CPPUNIT_ASSERT(px.unpack()==x-y);
+
+	px=x;
+	px+=v;
+	CPPUNIT_ASSERT(px.unpack()==x+v);
+
+	px=x;
+	px-=v;
+	CPPUNIT_ASSERT(px.unpack()==x-v);
+}
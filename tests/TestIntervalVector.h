@@ -171,6 +171,10 @@ public:
 	CPPUNIT_TEST(random01);
 	CPPUNIT_TEST(random02);
 
+	CPPUNIT_TEST(packed01);
+	CPPUNIT_TEST(packed02);
+	CPPUNIT_TEST(packed03);
+
 	CPPUNIT_TEST_SUITE_END();
 
 	/* test:
@@ -412,6 +416,11 @@ public:
 	void random01();
 	void random02();
 
+	// test: PackedIntervalVector
+	void packed01();
+	void packed02();
+	void packed03();
+
 private:
 	bool test_diff(int n, double x[][2], double y[][2], int m, double z[][2], bool compactness=true, bool debug=false);
 };
@@ -0,0 +1,230 @@
+/* ============================================================================
+ * I B E X - Native code of functions Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestJitFunction.h"
+
+#include <cstdlib>
+#include <sstream>
+
+#ifdef _IBEX_WITH_JIT_
+#include <unistd.h>
+#include <sys/stat.h>
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// a random box of size n (some components may be degenerated)
+IntervalVector random_box(int n) {
+	IntervalVector box(n);
+	for (int i=0; i<n; i++) {
+		double x=-2+4*((double) rand())/RAND_MAX;
+		double w=(rand()%4==0)? 0 : 2*((double) rand())/RAND_MAX;
+		box[i]=Interval(x,x+w);
+	}
+	return box;
+}
+
+// a function with all kinds of scalar operations and shared subexpressions
+Function* scalar_function() {
+	const ExprSymbol& x=ExprSymbol::new_("x",Dim::col_vec(2));
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	const ExprNode& e=sqr(x[0]-y);
+	return new Function(x,y,sin(x[0]*x[1])+exp(-e)/(1+sqr(y))-pow(x[1],3)+abs(x[0]-y)
+			+max(x[0],x[1])-min(y,2*x[1])+atan2(y,x[0])+sqrt(e+1)+log(e+2)+chi(x[1],y,x[0])
+			+cos(y)*tanh(x[0])-atan(e));
+}
+
+}
+
+void TestJitFunction::eval01() {
+	Function* f=scalar_function();
+	JitFunction jit(*f);
+
+#ifdef _IBEX_WITH_JIT_
+	CPPUNIT_ASSERT(jit.compiled());
+#endif
+
+	srand(1);
+	for (int i=0; i<100; i++) {
+		IntervalVector box=random_box(3);
+		CPPUNIT_ASSERT(jit.eval(box)==f->eval(box));
+	}
+	delete f;
+}
+
+void TestJitFunction::eval02() {
+	// vector-valued function and empty images
+	Variable x,y;
+	Function f(x,y,Return(sqrt(x)+y, log(y)*x, x, 1.5*y));
+	JitFunction jit(f);
+
+#ifdef _IBEX_WITH_JIT_
+	CPPUNIT_ASSERT(jit.compiled());
+#endif
+
+	srand(1);
+	for (int i=0; i<100; i++) {
+		IntervalVector box=random_box(2);
+		if (box[0].lb()<=0 || box[1].lb()<=0) continue;
+		CPPUNIT_ASSERT(jit.eval_vector(box)==f.eval_vector(box));
+	}
+
+	// outside of the definition domain
+	IntervalVector box(2,Interval(-2,-1));
+	CPPUNIT_ASSERT(jit.eval_vector(box).is_empty());
+}
+
+void TestJitFunction::backward01() {
+	Function* f=scalar_function();
+	JitFunction jit(*f);
+
+	srand(1);
+	for (int i=0; i<100; i++) {
+		IntervalVector box=random_box(3);
+		IntervalVector box2(box);
+		Interval y=Interval(-1,1)+((double) rand())/RAND_MAX;
+		bool inner1=jit.backward(y,box);
+		bool inner2=f->backward(y,box2);
+		CPPUNIT_ASSERT(inner1==inner2);
+		CPPUNIT_ASSERT(box==box2);
+	}
+	delete f;
+}
+
+void TestJitFunction::backward02() {
+	Variable x,y;
+	Function f(x,y,Return(sqr(x)+sqr(y), x-y));
+	JitFunction jit(f);
+
+	IntervalVector box(2,Interval(-10,10));
+	IntervalVector img(2);
+	img[0]=Interval(0,1);
+	img[1]=Interval(0,0.5);
+	CPPUNIT_ASSERT(!jit.backward(img,box));
+	CPPUNIT_ASSERT(box.is_subset(IntervalVector(2,Interval(-1,1))));
+
+	IntervalVector box2(2,Interval(-10,10));
+	f.backward(img,box2);
+	CPPUNIT_ASSERT(box==box2);
+
+	// inner box
+	IntervalVector box3(2,Interval(0.1,0.2));
+	CPPUNIT_ASSERT(jit.backward(IntervalVector(2,Interval(-1,1)),box3));
+
+	// empty box
+	img[0]=Interval(-2,-1);
+	CPPUNIT_ASSERT(!jit.backward(img,box));
+	CPPUNIT_ASSERT(box.is_empty());
+}
+
+void TestJitFunction::gradient01() {
+	Function* f=scalar_function();
+	JitFunction jit(*f);
+
+	srand(1);
+	for (int i=0; i<100; i++) {
+		IntervalVector box=random_box(3);
+		IntervalVector g1(3), g2(3);
+		jit.gradient(box,g1);
+		f->gradient(box,g2);
+		CPPUNIT_ASSERT(g1==g2);
+	}
+	delete f;
+}
+
+void TestJitFunction::cache01() {
+	// same structure, different constants
+	Variable x1,y1,x2,y2,x3;
+	Function f1(x1,y1,sqr(x1)+2*y1);
+	Function f2(x2,y2,sqr(x2)+3*y2);
+	Function f3(x3,3*sqr(x3));
+	JitFunction jit1(f1), jit2(f2), jit3(f3);
+
+#ifdef _IBEX_WITH_JIT_
+	CPPUNIT_ASSERT(jit1.compiled() && jit2.compiled() && jit3.compiled());
+#endif
+
+	CPPUNIT_ASSERT(jit1.hash()==jit2.hash());
+	CPPUNIT_ASSERT(jit1.hash()!=jit3.hash());
+
+	IntervalVector box(2,Interval(1,2));
+	CPPUNIT_ASSERT(jit1.eval(box)==Interval(3,8));
+	CPPUNIT_ASSERT(jit2.eval(box)==Interval(4,10));
+
+	// a second object for the same function
+	JitFunction jit4(f1);
+	CPPUNIT_ASSERT(jit4.hash()==jit1.hash());
+	CPPUNIT_ASSERT(jit4.eval(box)==Interval(3,8));
+}
+
+void TestJitFunction::unsupported01() {
+	// vector operations: the standard algorithms are used
+	const ExprSymbol& x=ExprSymbol::new_("x",Dim::col_vec(2));
+	Function f(x,(x+x)[0]*x[1]);
+	JitFunction jit(f);
+
+	CPPUNIT_ASSERT(!jit.compiled());
+	CPPUNIT_ASSERT(jit.hash().empty());
+
+	IntervalVector box(2,Interval(1,2));
+	CPPUNIT_ASSERT(jit.eval(box)==Interval(2,8));
+
+	IntervalVector g(2);
+	jit.gradient(box,g);
+	CPPUNIT_ASSERT(g==IntervalVector(2,Interval(2,4)));
+}
+
+void TestJitFunction::private_dir01() {
+#ifdef _IBEX_WITH_JIT_
+	const char* env=getenv("IBEX_JIT_DIR");
+	string old_dir=env? env : "";
+
+	// a directory that any user can write in
+	char dir[]="/tmp/ibex-jit-testXXXXXX";
+	CPPUNIT_ASSERT(mkdtemp(dir)!=NULL);
+	chmod(dir,0777);
+	setenv("IBEX_JIT_DIR",dir,1);
+
+	// (a structure not used by the other tests, which is not in the cache)
+	Variable x;
+	Function f(x,sinh(x)*acosh(x)-asinh(x));
+	JitFunction jit(f);
+	CPPUNIT_ASSERT(!jit.compiled());
+	CPPUNIT_ASSERT(jit.eval(IntervalVector(1,Interval(1,2)))==f.eval(IntervalVector(1,Interval(1,2))));
+
+	rmdir(dir);
+
+	if (env)
+		setenv("IBEX_JIT_DIR",old_dir.c_str(),1);
+	else {
+		unsetenv("IBEX_JIT_DIR");
+
+		// the default directory is private
+		Function g(x,cosh(x)*asinh(x)-acosh(x));
+		JitFunction jit2(g);
+		CPPUNIT_ASSERT(jit2.compiled());
+
+		ostringstream s;
+		const char* tmp=getenv("TMPDIR");
+		s << (tmp && *tmp? tmp : "/tmp") << "/ibex-jit-" << geteuid();
+		struct stat st;
+		CPPUNIT_ASSERT(stat(s.str().c_str(),&st)==0);
+		CPPUNIT_ASSERT(st.st_uid==geteuid());
+		CPPUNIT_ASSERT((st.st_mode & 0777)==0700);
+	}
+#endif
+}
+
+} // namespace ibex
@@ -0,0 +1,51 @@
+/* ============================================================================
+ * I B E X - Native code of functions Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_JIT_FUNCTION_H__
+#define __TEST_JIT_FUNCTION_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "ibex_JitFunction.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestJitFunction : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestJitFunction);
+	CPPUNIT_TEST(eval01);
+	CPPUNIT_TEST(eval02);
+	CPPUNIT_TEST(backward01);
+	CPPUNIT_TEST(backward02);
+	CPPUNIT_TEST(gradient01);
+	CPPUNIT_TEST(cache01);
+	CPPUNIT_TEST(unsupported01);
+	CPPUNIT_TEST(private_dir01);
+	CPPUNIT_TEST_SUITE_END();
+
+	void eval01();
+	void eval02();
+	void backward01();
+	void backward02();
+	void gradient01();
+	void cache01();
+	void unsupported01();
+	void private_dir01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestJitFunction);
+
+} // namespace ibex
+
+#endif // __TEST_JIT_FUNCTION_H__
@@ -189,4 +189,62 @@ void TestLinear::is_diagonal_dominant01() {
 	CPPUNIT_ASSERT(!is_diagonal_dominant(M));
 }
 
+void TestLinear::sparse_gauss_seidel01() {
+	int n=20;
+	IntervalMatrix A(n,n,Interval::ZERO);
+	IntervalVector b(n);
+	for (int i=0; i<n; i++) {
+		A[i][i]=Interval(3.9,4.1);
+		if (i>0) A[i][i-1]=Interval(-1,-0.9);
+		if (i<n-1) A[i][i+1]=Interval(-1,-0.9);
+		b[i]=Interval(i%3,i%3+0.1);
+	}
+
+	IntervalVector x(n,Interval(-10,10));
+	IntervalVector x2(x);
+
+	gauss_seidel(A,b,x);
+	gauss_seidel(SparseIntervalMatrix(A),b,x2);
+	CPPUNIT_ASSERT(x.max_diam()<5);
+	CPPUNIT_ASSERT(x==x2);
+
+	// the sparse preconditioning keeps the pattern
+	SparseIntervalMatrix S(A);
+	precond(S,b);
+	CPPUNIT_ASSERT(S.nb_nonzeros()==3*n-2);
+	CPPUNIT_ASSERT(S(0,0).contains(1));
+
+	A[n-1][n-1]=Interval(-1,1);
+	SparseIntervalMatrix S2(A);
+	CPPUNIT_ASSERT_THROW(precond(S2,b),SingularMatrixException);
+}
+
+void TestLinear::sparse_gauss_elimination01() {
+	int n=100;
+	IntervalMatrix A(n,n,Interval::ZERO);
+	for (int i=0; i<n; i++) {
+		A[i][i]=-2;
+		if (i>0) A[i][i-1]=1;
+		if (i<n-1) A[i][i+1]=1;
+	}
+	// solution: x=(1,...,1)
+	IntervalVector b(n,Interval::ZERO);
+	b[0]=-1;
+	b[n-1]=-1;
+
+	IntervalVector x(n,Interval(-10,10));
+	IntervalVector x2(x);
+	gauss_seidel(SparseIntervalMatrix(A),b,x2);
+	CPPUNIT_ASSERT(x2[n/2].diam()>1);
+
+	gauss_elimination(SparseIntervalMatrix(A),b,x);
+	CPPUNIT_ASSERT(x.contains(Vector::ones(n)));
+	CPPUNIT_ASSERT(x.max_diam()<1e-8);
+
+	A[0][0]=Interval(-1,1);
+	IntervalVector x3(n,Interval(-10,10));
+	CPPUNIT_ASSERT_THROW(gauss_elimination(SparseIntervalMatrix(A),b,x3),SingularMatrixException);
+	CPPUNIT_ASSERT(x3==IntervalVector(n,Interval(-10,10)));
+}
+
 } // end namespace ibex
@@ -27,6 +27,8 @@ public:
 	CPPUNIT_TEST(inflating_gauss_seidel01);
 	CPPUNIT_TEST(inflating_gauss_seidel02);
 	CPPUNIT_TEST(inflating_gauss_seidel03);
+	CPPUNIT_TEST(sparse_gauss_seidel01);
+	CPPUNIT_TEST(sparse_gauss_elimination01);
 	CPPUNIT_TEST(det01);
 	CPPUNIT_TEST(det02);
 	CPPUNIT_TEST(is_posdef_sylvester01);
@@ -45,6 +47,11 @@ public:
 	// divergence, start with thick vector
 	void inflating_gauss_seidel03();
 
+	// sparse variant gives the same result as the dense one
+	void sparse_gauss_seidel01();
+	// discretized Laplacian (where Gauss-Seidel hardly contracts)
+	void sparse_gauss_elimination01();
+
 	void det01();
 	void det02();
 
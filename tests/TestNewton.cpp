@@ -157,4 +157,54 @@ void TestNewton::ctc_parameter01() {
 	CPPUNIT_ASSERT(box[0].diam()<=0.1);
 	CPPUNIT_ASSERT(box[1].diam()<=0.1);
 }
+void TestNewton::sparse_newton01() {
+	int n=150;
+	Variable x(n);
+	Array<const ExprNode> eqs(n);
+	for (int i=0; i<n; i++) {
+		const ExprNode* e=&(-4*x[i]+0.1*sqr(x[i]));
+		if (i>0) e=&(*e+x[i-1]);
+		if (i<n-1) e=&(*e+x[i+1]);
+		eqs.set_ref(i,*e);
+	}
+	Function f(x,ExprVector::new_(eqs,false));
+
+	CtcNewton newton(f,1.0,default_newton_prec,default_gauss_seidel_ratio,true);
+	CPPUNIT_ASSERT(newton.sparse);
+	CPPUNIT_ASSERT(!CtcNewton(f,1.0).sparse); // not by default
+
+	IntervalVector box(n,Interval(-0.1,0.1));
+	newton.contract(box);
+	CPPUNIT_ASSERT(!box.is_empty());
+	CPPUNIT_ASSERT(box.contains(Vector::zeros(n)));
+	CPPUNIT_ASSERT(box.max_diam()<1e-8);
+}
+
+void TestNewton::sparse_newton02() {
+	// the equations are shifted w.r.t. the variables:
+	// the diagonal of the Jacobian matrix is null
+	int n=150;
+	Variable x(n);
+	Array<const ExprNode> eqs(n);
+	for (int i=0; i<n; i++) {
+		int j=(i+1)%n;
+		int k=(i+2)%n;
+		eqs.set_ref(i,-4*x[j]+0.1*sqr(x[j])+x[k]);
+	}
+	Function f(x,ExprVector::new_(eqs,false));
+
+	CtcNewton newton(f,1.0,default_newton_prec,default_gauss_seidel_ratio,true);
+	CPPUNIT_ASSERT(newton.sparse);
+
+	IntervalVector box(n,Interval(-0.1,0.1));
+	IntervalVector box2(box);
+	CPPUNIT_ASSERT(!sparse_newton(f,box2));
+	CPPUNIT_ASSERT(box2==box); // no contraction
+
+	newton.contract(box);
+	CPPUNIT_ASSERT(!box.is_empty());
+	CPPUNIT_ASSERT(box.contains(Vector::zeros(n)));
+	CPPUNIT_ASSERT(box.max_diam()<1e-8);
+}
+
 } // end namespace ibex
@@ -0,0 +1,195 @@
+/* ============================================================================
+ * I B E X - Paver Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestPaver.h"
+#include "ibex_CtcFwdBwd.h"
+#include "ibex_CtcCompo.h"
+#include "ibex_CtcUnion.h"
+#include "ibex_CtcEmpty.h"
+#include "ibex_PdcDiameterLT.h"
+#include "ibex_LargestFirst.h"
+#include "ibex_CellStack.h"
+#include "ibex_Timer.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * The SIVIA example (see examples/doc-sivia.cpp):
+ * everything a paver needs, for one thread.
+ */
+class Sivia {
+public:
+	Sivia() : x(), y(), f(x,y,sin(x+y)-0.1*x*y),
+		c1(x,y,f(x,y)<=2), c2(x,y,f(x,y)>=0), c3(x,y,f(x,y)>2), c4(x,y,f(x,y)<0),
+		out1(c1), out2(c2), in1(c3), in2(c4),
+		outside(out1,out2), inside(in1,in2), prec(0.1), boundary(prec),
+		lf(0.1), paver(Array<Ctc>(inside,outside,boundary), lf, stack) {
+		paver.trace=0;
+		paver.ctc_loop=false;
+	}
+
+	Variable x,y;
+	Function f;
+	NumConstraint c1,c2,c3,c4;
+	CtcFwdBwd out1,out2,in1,in2;
+	CtcCompo outside;
+	CtcUnion inside;
+	PdcDiameterLT prec;
+	CtcEmpty boundary;
+	LargestFirst lf;
+	CellStack stack;
+	Paver paver;
+};
+
+IntervalVector init_box() {
+	IntervalVector box(2);
+	box[0]=Interval(-10,10);
+	box[1]=Interval(-10,10);
+	return box;
+}
+
+// total volume removed by a contractor
+double removed(const SubPaving& p) {
+	double v=0;
+	for (vector<pair<IntervalVector,IntervalVector> >::const_iterator it=p.traces.begin(); it!=p.traces.end(); it++) {
+		v+=it->first.volume();
+		if (!it->second.is_empty()) v-=it->second.volume();
+	}
+	return v;
+}
+
+// total volume of a list of boxes
+double volume(const vector<IntervalVector>& l) {
+	double v=0;
+	for (vector<IntervalVector>::const_iterator it=l.begin(); it!=l.end(); it++)
+		v+=it->volume();
+	return v;
+}
+
+void check_same_paving(int nb_threads, int tasks_per_thread) {
+	Sivia serial;
+	serial.paver.timeout=10;
+	SubPaving* p1=serial.paver.pave(init_box());
+
+	Sivia** sivia=new Sivia*[nb_threads];
+	Array<Paver> workers(nb_threads);
+	for (int t=0; t<nb_threads; t++) {
+		sivia[t]=new Sivia();
+		workers.set_ref(t,sivia[t]->paver);
+	}
+
+	ParallelPaver pp(workers);
+	pp.tasks_per_thread=tasks_per_thread;
+	SubPaving* p2=pp.pave(init_box());
+
+	for (int i=0; i<3; i++) {
+		CPPUNIT_ASSERT(p1[i].size()==p2[i].size());
+		CPPUNIT_ASSERT(almost_eq(removed(p1[i]),removed(p2[i]),1e-07));
+	}
+
+	delete[] p1;
+	delete[] p2;
+	for (int t=0; t<nb_threads; t++) delete sivia[t];
+	delete[] sivia;
+}
+
+}
+
+void TestPaver::parallel01() {
+	check_same_paving(1,1);
+}
+
+void TestPaver::parallel02() {
+	check_same_paving(4,8);
+}
+
+void TestPaver::capacity01() {
+	Sivia s1,s2;
+	ParallelPaver pp(Array<Paver>(s1.paver,s2.paver));
+	pp.capacity=100;
+	CPPUNIT_ASSERT_THROW(pp.pave(init_box()), CapacityException);
+}
+
+void TestPaver::set_image01() {
+	Variable x,y;
+	Function f1(x,y,Return(x+y,x-sqr(y)));
+	Function f2(x,y,Return(x+y,x-sqr(y)));
+	Function f3(x,y,Return(x+y,x-sqr(y)));
+
+	IntervalVector box(2,Interval(0,1));
+
+	SetImage serial(f1,box);
+	serial.pave(box,0.05);
+
+	SetImage w1(f2,box);
+	SetImage w2(f3,box);
+	ParallelSetImage par(Array<SetImage>(w1,w2));
+	par.pave(box,0.05);
+
+	CPPUNIT_ASSERT(serial.interior().size()==par.interior().size());
+	CPPUNIT_ASSERT(serial.boundary().size()==par.boundary().size());
+	CPPUNIT_ASSERT(serial.interior().size()>0);
+	CPPUNIT_ASSERT(almost_eq(volume(serial.interior()),volume(par.interior()),1e-07));
+	CPPUNIT_ASSERT(almost_eq(volume(serial.boundary()),volume(par.boundary()),1e-07));
+}
+
+void TestPaver::timeout01() {
+	Variable x,y;
+	Function f1(x,y,Return(x+y,x-sqr(y)));
+	Function f2(x,y,Return(x+y,x-sqr(y)));
+
+	IntervalVector box(2,Interval(0,1));
+
+	SetImage w1(f1,box);
+	SetImage w2(f2,box);
+	ParallelSetImage par(Array<SetImage>(w1,w2));
+	// one task per thread: the time limit is checked by each
+	// thread until the end of its own task
+	par.tasks_per_thread=1;
+	par.timeout=0.01;
+	CPPUNIT_ASSERT_THROW(par.pave(box,1e-05), TimeOutException);
+	CPPUNIT_ASSERT(par.interior().empty());
+}
+
+namespace {
+
+// a contractor that raises an exception at the nth call
+class CtcFail : public Ctc {
+public:
+	CtcFail(int nb_var, int n) : Ctc(nb_var), n(n) { }
+
+	virtual void contract(IntervalVector& box) {
+		if (--n==0) throw Exception();
+	}
+
+	int n;
+};
+
+}
+
+void TestPaver::exception01() {
+	CtcFail c1(2,50), c2(2,50);
+	LargestFirst lf1(0.1), lf2(0.1);
+	CellStack s1, s2;
+	Paver p1(Array<Ctc>(c1),lf1,s1);
+	Paver p2(Array<Ctc>(c2),lf2,s2);
+	p1.trace=p2.trace=0;
+
+	// the exception of a thread is raised by the parallel paver
+	ParallelPaver pp(Array<Paver>(p1,p2));
+	CPPUNIT_ASSERT_THROW(pp.pave(init_box()), Exception);
+}
+
+} // end namespace ibex
@@ -0,0 +1,48 @@
+/* ============================================================================
+ * I B E X - Paver Tests
+ * ============================================================================
+ * Copyright   : IMT Atlantique (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 18, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_PAVER_H__
+#define __TEST_PAVER_H__
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include "ibex_ParallelPaver.h"
+#include "ibex_ParallelSetImage.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestPaver : public CppUnit::TestFixture {
+
+public:
+
+	CPPUNIT_TEST_SUITE(TestPaver);
+	CPPUNIT_TEST(parallel01);
+	CPPUNIT_TEST(parallel02);
+	CPPUNIT_TEST(capacity01);
+	CPPUNIT_TEST(set_image01);
+	CPPUNIT_TEST(timeout01);
+	CPPUNIT_TEST(exception01);
+	CPPUNIT_TEST_SUITE_END();
+
+	void parallel01();
+	void parallel02();
+	void capacity01();
+	void set_image01();
+	void timeout01();
+	void exception01();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestPaver);
+
+} // namespace ibex
+
+#endif // __TEST_PAVER_H__
@@ -11,6 +11,9 @@
 #include "ibex_Set.h"
 #include "ibex_SetLeaf.h"
 #include "ibex_SetBisect.h"
+#include "ibex_SepFwdBwd.h"
+#include "ibex_FlatSet.h"
+#include <sstream>
 
 using namespace std;
 
@@ -420,4 +423,145 @@ void TestSet::diff15() {
 	CPPUNIT_ASSERT(leaf->status==MAYBE);
 
 }
+
+namespace {
+
+string to_string(const Set& set) {
+	stringstream ss;
+	ss << set;
+	return ss.str();
+}
+
+// print the nodes and leaves in the order of the visit
+class SetPrinter : public SetVisitor {
+public:
+	void visit_node(const IntervalVector& nodebox) {
+		ss << "* " << nodebox << endl;
+	}
+	void visit_leaf(const IntervalVector& nodebox, BoolInterval status) {
+		ss << nodebox << " " << status << endl;
+	}
+	stringstream ss;
+};
+
+// ring centered on (0,0)
+Set* ring(Function& f) {
+	SepFwdBwd sep(f,Interval(1,4));
+	Set* set=new Set(IntervalVector(2,Interval(-3,3)));
+	sep.contract(*set,0.05);
+	return set;
+}
+
+}
+
+void TestSet::parallel01() {
+	// functions are not thread-safe: one per separator
+	Variable x,y;
+	Function f1(x,y,sqr(x)+sqr(y));
+	Function f2(x,y,sqr(x)+sqr(y));
+	Function f3(x,y,sqr(x)+sqr(y));
+
+	SepFwdBwd sep1(f1,Interval(1,4));
+	SepFwdBwd sep2(f2,Interval(1,4));
+	SepFwdBwd sep3(f3,Interval(1,4));
+
+	IntervalVector box(2,Interval(-3,3));
+	Set s1(box);
+	sep1.contract(s1,0.05);
+
+	Set s2(box);
+	Array<Sep> seps(sep2,sep3);
+	s2.contract(seps,0.05,0.5);
+
+	CPPUNIT_ASSERT(to_string(s1)==to_string(s2));
+}
+
+void TestSet::parallel02() {
+	Variable x,y;
+	Function f(x,y,sqr(x)+sqr(y));
+	Function g(x,y,sqr(x-1)+sqr(y));
+
+	Set a1(f,LEQ,0.05);
+	Set a2(f,LEQ,0.05);
+	Set b(g,LEQ,0.05);
+
+	a1 &= b;
+	a2.inter(b,2,0.5);
+
+	CPPUNIT_ASSERT(to_string(a1)==to_string(a2));
+}
+
+void TestSet::parallel03() {
+	Variable x,y;
+	Function f(x,y,sqr(x)+sqr(y));
+	Function g(x,y,sqr(x-1)+sqr(y));
+
+	Set a1(f,LEQ,0.05);
+	Set a2(f,LEQ,0.05);
+	Set b(g,LEQ,0.05);
+
+	a1 |= b;
+	a2.union_(b,2,0.5);
+
+	CPPUNIT_ASSERT(to_string(a1)==to_string(a2));
+}
+
+void TestSet::flat01() {
+	Variable x,y;
+	Function f(x,y,sqr(x)+sqr(y));
+	Set* set=ring(f);
+	FlatSet flat(*set);
+
+	SetPrinter p1,p2;
+	set->visit(p1);
+	flat.visit(p2);
+	CPPUNIT_ASSERT(p1.ss.str()==p2.ss.str());
+	CPPUNIT_ASSERT(!flat.is_empty());
+	CPPUNIT_ASSERT(flat.nb_var()==2);
+
+	delete set;
+}
+
+void TestSet::flat02() {
+	Variable x,y;
+	Function f(x,y,sqr(x)+sqr(y));
+	Set* set=ring(f);
+	FlatSet flat(*set);
+
+	srand(1);
+	for (int i=0; i<100; i++) {
+		Vector pt(2);
+		pt[0]=-4+8*((double) rand())/RAND_MAX;
+		pt[1]=-4+8*((double) rand())/RAND_MAX;
+		CPPUNIT_ASSERT(set->dist(pt,true)==flat.dist(pt,true));
+		CPPUNIT_ASSERT(set->dist(pt,false)==flat.dist(pt,false));
+
+		IntervalVector box(pt);
+		box.inflate(0.2);
+		CPPUNIT_ASSERT(set->is_superset(box)==flat.is_superset(box));
+	}
+
+	delete set;
+}
+
+void TestSet::flat03() {
+	Variable x,y;
+	Function f(x,y,sqr(x)+sqr(y));
+	Set* set=ring(f);
+
+	set->save("__tmp__.set");
+	FlatSet flat("__tmp__.set");
+	flat.save("__tmp__.set");
+	Set set2("__tmp__.set");
+	remove("__tmp__.set");
+
+	CPPUNIT_ASSERT(to_string(*set)==to_string(set2));
+
+	FlatSet flat2(set2);
+	CPPUNIT_ASSERT(flat2.nb_leaves()==flat.nb_leaves());
+	CPPUNIT_ASSERT(flat2.memory()>0);
+
+	delete set;
+}
+
 } // end namespace ibex
@@ -36,6 +36,12 @@ public:
 //		CPPUNIT_TEST(diff13);
 //		CPPUNIT_TEST(diff14);
 		CPPUNIT_TEST(diff15);
+		CPPUNIT_TEST(parallel01);
+		CPPUNIT_TEST(parallel02);
+		CPPUNIT_TEST(parallel03);
+		CPPUNIT_TEST(flat01);
+		CPPUNIT_TEST(flat02);
+		CPPUNIT_TEST(flat03);
 	CPPUNIT_TEST_SUITE_END();
 
 	void diff01();
@@ -53,6 +59,12 @@ public:
 	void diff13();
 	void diff14();
 	void diff15();
+	void parallel01();
+	void parallel02();
+	void parallel03();
+	void flat01();
+	void flat02();
+	void flat03();
 
 };
 
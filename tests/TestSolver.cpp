@@ -16,6 +16,8 @@
 #include "ibex_CellStack.h"
 #include "ibex_CtcHC4.h"
 #include "ibex_Manifold.h"
+#include "ibex_ManifoldSink.h"
+#include "ibex_ParallelSolver.h"
 
 using namespace std;
 
@@ -189,5 +191,296 @@ void TestSolver::circle4() {
 	CPPUNIT_ASSERT(res==false);
 }
 
+void TestSolver::parallel01() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+
+	SystemFactory f;
+	f.add_var(x);
+	f.add_var(y);
+	f.add_ctr(sqr(x)+sqr(y)=1);
+	f.add_ctr(sqr(x-1)+sqr(y)=1);
+	System sys1(f);
+	System sys2(sys1,System::COPY);
+
+	RoundRobin rr1(1e-3), rr2(1e-3);
+	CellStack stack1, stack2;
+	CtcHC4 hc4_1(sys1), hc4_2(sys2);
+	Vector prec(2,1e-3);
+
+	Solver solver1(sys1,hc4_1,rr1,stack1,prec,prec);
+	Solver solver2(sys2,hc4_2,rr2,stack2,prec,prec);
+
+	ParallelSolver psolver(Array<Solver>(solver1,solver2));
+
+	IntervalVector box(2,Interval(-10,10));
+	Solver::Status status=psolver.solve(box);
+	CPPUNIT_ASSERT(status==Solver::SUCCESS);
+
+	CellStack stack;
+	CtcHC4 hc4(sys1);
+	RoundRobin rr(1e-3);
+	Solver solver(sys1,hc4,rr,stack,prec,prec);
+	solver.solve(box);
+
+	const Manifold& manif=psolver.get_manifold();
+	CPPUNIT_ASSERT(manif.inner.size()==2);
+	CPPUNIT_ASSERT(manif.boundary.size()==0);
+	CPPUNIT_ASSERT(manif.unknown.size()==0);
+
+	for (vector<SolverOutputBox>::const_iterator it=manif.inner.begin(); it!=manif.inner.end(); it++) {
+		bool found=false;
+		for (vector<SolverOutputBox>::const_iterator it2=solver.get_manifold().inner.begin();
+				it2!=solver.get_manifold().inner.end(); it2++) {
+			if (it->existence()==it2->existence()) found=true;
+		}
+		CPPUNIT_ASSERT(found);
+	}
+	CPPUNIT_ASSERT(psolver.get_nb_cells()==solver.get_nb_cells());
+}
+
+namespace {
+
+// a contractor that raises an exception at the nth call
+class CtcFail : public Ctc {
+public:
+	CtcFail(int nb_var, int n) : Ctc(nb_var), n(n) { }
+
+	virtual void contract(IntervalVector& box) {
+		if (--n==0) throw Exception();
+	}
+
+	int n;
+};
+
+}
+
+void TestSolver::parallel02() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+
+	SystemFactory f;
+	f.add_var(x);
+	f.add_var(y);
+	f.add_ctr(sqr(x)+sqr(y)=1);
+	System sys(f);
+
+	RoundRobin rr1(1e-3), rr2(1e-3);
+	CellStack stack1, stack2;
+	CtcFail ctc1(2,10), ctc2(2,10);
+	Vector prec(2,1e-3);
+
+	Solver solver1(sys,ctc1,rr1,stack1,prec,prec);
+	Solver solver2(sys,ctc2,rr2,stack2,prec,prec);
+
+	// the exception of a thread is raised by the parallel solver
+	ParallelSolver psolver(Array<Solver>(solver1,solver2));
+	IntervalVector box(2,Interval(-10,10));
+	CPPUNIT_ASSERT_THROW(psolver.solve(box), Exception);
+}
+
+namespace {
+
+// the unit circle (parametric proof with one parameter)
+System* circle() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	SystemFactory f;
+	f.add_var(x);
+	f.add_var(y);
+	f.add_ctr(sqr(x)+sqr(y)=1);
+	return new System(f);
+}
+
+// a sink that only keeps the boxes in memory
+class SinkVector : public ManifoldSink {
+public:
+	SinkVector() : ManifoldSink(10), nb_flush(0) { }
+	void flush() { nb_flush++; }
+	void write(const SolverOutputBox& sol) { boxes.push_back(sol.existence()); }
+	vector<IntervalVector> boxes;
+	int nb_flush;
+};
+
+bool same_boxes(const vector<SolverOutputBox>& v, const ManifoldFile& file, int first) {
+	IntervalVector box(file.n);
+	for (size_t i=0; i<v.size(); i++) {
+		file.box(first+i,box);
+		if (box!=v[i].existence() || file.box_status(first+i)!=v[i].status) return false;
+		const int* p=file.params(first+i);
+		if (v[i].varset) {
+			if (p==NULL || p[0]!=v[i].varset->param(0)+1) return false;
+		} else if (p!=NULL && p[0]!=0) return false;
+	}
+	return true;
+}
+
+}
+
+void TestSolver::manifold01() {
+	System* sys=circle();
+	RoundRobin rr(1e-3);
+	CellStack stack;
+	CtcHC4 hc4(*sys);
+	Vector prec(2,1e-2);
+	Solver solver(*sys,hc4,rr,stack,prec,prec);
+	solver.solve(IntervalVector(2,Interval(-2,2)));
+	const Manifold& manif=solver.get_manifold();
+	CPPUNIT_ASSERT(manif.inner.size()>0);
+
+	manif.write("__tmp__.mnf");
+	CPPUNIT_ASSERT(ManifoldFile::version("__tmp__.mnf")==2);
+
+	{
+		ManifoldFile file("__tmp__.mnf");
+		CPPUNIT_ASSERT(file.n==2 && file.m==1 && file.nb_ineq==0);
+		CPPUNIT_ASSERT(file.status==manif.status);
+		CPPUNIT_ASSERT(file.nb_cells==manif.nb_cells);
+		CPPUNIT_ASSERT(file.size()==manif.size());
+		CPPUNIT_ASSERT(file.nb(SolverOutputBox::INNER)==(int) manif.inner.size());
+		CPPUNIT_ASSERT(file.nb(SolverOutputBox::BOUNDARY)==(int) manif.boundary.size());
+		CPPUNIT_ASSERT(same_boxes(manif.inner,file,file.first(SolverOutputBox::INNER)));
+		CPPUNIT_ASSERT(same_boxes(manif.boundary,file,file.first(SolverOutputBox::BOUNDARY)));
+		CPPUNIT_ASSERT(same_boxes(manif.unknown,file,file.first(SolverOutputBox::UNKNOWN)));
+	}
+
+	// full load
+	Manifold manif2(2,1,0);
+	manif2.load("__tmp__.mnf");
+	CPPUNIT_ASSERT(manif2.input()==NULL);
+	CPPUNIT_ASSERT(manif2.inner.size()==manif.inner.size());
+	for (size_t i=0; i<manif.inner.size(); i++) {
+		CPPUNIT_ASSERT(manif2.inner[i].existence()==manif.inner[i].existence());
+		CPPUNIT_ASSERT(manif2.inner[i].varset->param(0)==manif.inner[i].varset->param(0));
+	}
+
+	// lazy load: the boxes remain in the file
+	Manifold manif3(2,1,0);
+	manif3.load("__tmp__.mnf",true);
+	CPPUNIT_ASSERT(manif3.input()!=NULL);
+	CPPUNIT_ASSERT(manif3.inner.empty());
+	CPPUNIT_ASSERT(manif3.nb_inner()==(int) manif.inner.size());
+
+	// overwrite the mapped file
+	manif3.write("__tmp__.mnf");
+	{
+		ManifoldFile file("__tmp__.mnf");
+		CPPUNIT_ASSERT(same_boxes(manif.inner,file,0));
+	}
+
+	remove("__tmp__.mnf");
+	delete sys;
+}
+
+void TestSolver::manifold02() {
+	System* sys=circle();
+	RoundRobin rr(1e-3);
+	CellStack stack;
+	CtcHC4 hc4(*sys);
+	Vector prec(2,1e-2);
+	IntervalVector box(2,Interval(-2,2));
+
+	Solver solver(*sys,hc4,rr,stack,prec,prec);
+	solver.solve(box);
+
+	// interrupted and resumed from the file
+	Solver solver1(*sys,hc4,rr,stack,prec,prec);
+	solver1.cell_limit=50;
+	CPPUNIT_ASSERT(solver1.solve(box)==Solver::CELL_OVERFLOW);
+	CPPUNIT_ASSERT(solver1.get_manifold().nb_unknown()>0);
+	solver1.get_manifold().write("__tmp__.mnf");
+
+	Solver solver2(*sys,hc4,rr,stack,prec,prec);
+	CPPUNIT_ASSERT(solver2.solve("__tmp__.mnf")==Solver::SUCCESS);
+	const Manifold& manif=solver2.get_manifold();
+	CPPUNIT_ASSERT(manif.input()!=NULL);
+	CPPUNIT_ASSERT(manif.nb_inner()==(int) solver.get_manifold().inner.size());
+	CPPUNIT_ASSERT(manif.nb_boundary()==(int) solver.get_manifold().boundary.size());
+	CPPUNIT_ASSERT(manif.nb_unknown()==0);
+	CPPUNIT_ASSERT(manif.nb_cells==solver.get_manifold().nb_cells);
+
+	manif.write("__tmp__.mnf");
+	ManifoldFile file("__tmp__.mnf");
+	CPPUNIT_ASSERT(file.nb(SolverOutputBox::INNER)==manif.nb_inner());
+	CPPUNIT_ASSERT(file.status==Solver::SUCCESS);
+
+	remove("__tmp__.mnf");
+	delete sys;
+}
+
+void TestSolver::sink01() {
+	System* sys=circle();
+	RoundRobin rr(1e-3);
+	CellStack stack;
+	CtcHC4 hc4(*sys);
+	Vector prec(2,1e-2);
+	IntervalVector box(2,Interval(-2,2));
+
+	Solver solver(*sys,hc4,rr,stack,prec,prec);
+	solver.solve(box);
+	const Manifold& manif=solver.get_manifold();
+
+	SinkVector sink;
+	Solver solver2(*sys,hc4,rr,stack,prec,prec);
+	solver2.sink=&sink;
+	CPPUNIT_ASSERT(solver2.solve(box)==manif.status);
+	CPPUNIT_ASSERT(solver2.get_manifold().size()==0);
+	CPPUNIT_ASSERT(sink.nb(SolverOutputBox::INNER)==(int) manif.inner.size());
+	CPPUNIT_ASSERT(sink.nb(SolverOutputBox::BOUNDARY)==(int) manif.boundary.size());
+	CPPUNIT_ASSERT(sink.nb(SolverOutputBox::UNKNOWN)==(int) manif.unknown.size());
+	CPPUNIT_ASSERT(sink.size()==(int) sink.boxes.size());
+	CPPUNIT_ASSERT(sink.nb_flush==sink.size()/10+1);
+
+	for (size_t i=0; i<manif.inner.size(); i++)
+		CPPUNIT_ASSERT(sink.boxes[i]==manif.inner[i].existence());
+
+	delete sys;
+}
+
+void TestSolver::sink02() {
+	System* sys=circle();
+	RoundRobin rr(1e-3);
+	CellStack stack;
+	CtcHC4 hc4(*sys);
+	Vector prec(2,1e-2);
+	IntervalVector box(2,Interval(-2,2));
+
+	Solver solver(*sys,hc4,rr,stack,prec,prec);
+	solver.solve(box);
+
+	// interrupted search streamed into a file
+	{
+		ManifoldStream stream("__tmp__.mnf",2,1,0,7);
+		Solver solver1(*sys,hc4,rr,stack,prec,prec);
+		solver1.sink=&stream;
+		solver1.cell_limit=50;
+		CPPUNIT_ASSERT(solver1.solve(box)==Solver::CELL_OVERFLOW);
+		CPPUNIT_ASSERT(stream.nb(SolverOutputBox::UNKNOWN)>0);
+	}
+
+	// resumed from the file and streamed into another one
+	{
+		ManifoldStream stream("__tmp2__.mnf",2,1,0);
+		Solver solver2(*sys,hc4,rr,stack,prec,prec);
+		solver2.sink=&stream;
+		CPPUNIT_ASSERT(solver2.solve("__tmp__.mnf")==Solver::SUCCESS);
+		CPPUNIT_ASSERT(stream.nb(SolverOutputBox::INNER)==(int) solver.get_manifold().inner.size());
+		stream.close();
+	}
+
+	Manifold manif(2,1,0);
+	manif.load("__tmp2__.mnf");
+	CPPUNIT_ASSERT(manif.status==Solver::SUCCESS);
+	CPPUNIT_ASSERT(manif.inner.size()==solver.get_manifold().inner.size());
+	CPPUNIT_ASSERT(manif.boundary.size()==solver.get_manifold().boundary.size());
+	CPPUNIT_ASSERT(manif.unknown.size()==0);
+	CPPUNIT_ASSERT(manif.nb_cells==solver.get_manifold().nb_cells);
+	for (size_t i=0; i<manif.inner.size(); i++)
+		CPPUNIT_ASSERT(manif.inner[i].varset!=NULL);
+
+	remove("__tmp__.mnf");
+	remove("__tmp2__.mnf");
+	delete sys;
+}
 
 } // end namespace
@@ -28,12 +28,24 @@ public:
 	CPPUNIT_TEST(circle2);
 	CPPUNIT_TEST(circle3);
 	CPPUNIT_TEST(circle4);
+	CPPUNIT_TEST(parallel01);
+	CPPUNIT_TEST(parallel02);
+	CPPUNIT_TEST(manifold01);
+	CPPUNIT_TEST(manifold02);
+	CPPUNIT_TEST(sink01);
+	CPPUNIT_TEST(sink02);
 	CPPUNIT_TEST_SUITE_END();
 
 	void circle1();
 	void circle2();
 	void circle3();
 	void circle4();
+	void parallel01();
+	void parallel02();
+	void manifold01();
+	void manifold02();
+	void sink01();
+	void sink02();
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestSolver);